@@ -19,8 +19,10 @@ function(tinyorm_sources out_headers out_sources)
 
     list(APPEND headers
         basegrammar.hpp
+        concerns/capturesslowqueries.hpp
         concerns/countsqueries.hpp
         concerns/detectslostconnections.hpp
+        concerns/dispatchesqueryevents.hpp
         concerns/hasconnectionresolver.hpp
         concerns/logsqueries.hpp
         concerns/managestransactions.hpp
@@ -51,8 +53,10 @@ function(tinyorm_sources out_headers out_sources)
         exceptions/logicerror.hpp
         exceptions/lostconnectionerror.hpp
         exceptions/multiplerecordsfounderror.hpp
+        exceptions/nontransactionalcommanderror.hpp
         exceptions/ormerror.hpp
         exceptions/queryerror.hpp
+        exceptions/querytimeouterror.hpp
         exceptions/recordsnotfounderror.hpp
         exceptions/runtimeerror.hpp
         exceptions/searchpathemptyerror.hpp
@@ -103,9 +107,19 @@ function(tinyorm_sources out_headers out_sources)
         schema/schematypes.hpp
         schema/sqliteschemabuilder.hpp
         sqliteconnection.hpp
+        support/cachedsqlresult.hpp
+        support/connectionworkers.hpp
         support/databaseconfiguration.hpp
         support/databaseconnectionsmap.hpp
+        support/querycache.hpp
+        support/querycacheinterface.hpp
+        support/repeatedqueriesreporter.hpp
+        types/batchstatement.hpp
+        types/bindingsmap.hpp
         types/log.hpp
+        types/querycancelhandle.hpp
+        types/queryevents.hpp
+        types/slowquery.hpp
         types/sqlquery.hpp
         types/statementscounter.hpp
         utils/configuration.hpp
@@ -133,12 +147,16 @@ function(tinyorm_sources out_headers out_sources)
             tiny/concerns/hasrelationstore.hpp
             tiny/concerns/hastimestamps.hpp
             tiny/concerns/hidesattributes.hpp
+            tiny/concerns/preventslazyloading.hpp
             tiny/concerns/queriesrelationships.hpp
+            tiny/exceptions/lazyloadingviolationerror.hpp
             tiny/exceptions/massassignmenterror.hpp
             tiny/exceptions/modelnotfounderror.hpp
             tiny/exceptions/mutatormappingnotfounderror.hpp
             tiny/exceptions/relationmappingnotfounderror.hpp
             tiny/exceptions/relationnotloadederror.hpp
+            tiny/factory.hpp
+            tiny/identitymap.hpp
             tiny/macros/crtpmodel.hpp
             tiny/macros/crtpmodelwithbase.hpp
             tiny/macros/relationstoresaliases.hpp
@@ -173,6 +191,7 @@ function(tinyorm_sources out_headers out_sources)
             tiny/types/connectionoverride.hpp
             tiny/types/modelattributes.hpp
             tiny/types/modelscollection.hpp
+            tiny/types/modelskeyedview.hpp
             tiny/types/syncchanges.hpp
             tiny/utils/attribute.hpp
         )
@@ -190,8 +209,10 @@ function(tinyorm_sources out_headers out_sources)
 
     list(APPEND sources
         basegrammar.cpp
+        concerns/capturesslowqueries.cpp
         concerns/countsqueries.cpp
         concerns/detectslostconnections.cpp
+        concerns/dispatchesqueryevents.cpp
         concerns/hasconnectionresolver.cpp
         concerns/logsqueries.cpp
         concerns/managestransactions.cpp
@@ -240,6 +261,12 @@ function(tinyorm_sources out_headers out_sources)
         schema/schemabuilder.cpp
         schema/sqliteschemabuilder.cpp
         sqliteconnection.cpp
+        support/cachedsqlresult.cpp
+        support/connectionworkers.cpp
+        support/querycache.cpp
+        support/repeatedqueriesreporter.cpp
+        types/bindingsmap.cpp
+        types/querycancelhandle.cpp
         types/sqlquery.cpp
         utils/configuration.cpp
         utils/fs.cpp
@@ -254,9 +281,12 @@ function(tinyorm_sources out_headers out_sources)
     if(ORM)
         list(APPEND sources
             tiny/concerns/guardedmodel.cpp
+            tiny/concerns/preventslazyloading.cpp
+            tiny/exceptions/lazyloadingviolationerror.cpp
             tiny/exceptions/modelnotfounderror.cpp
             tiny/exceptions/relationmappingnotfounderror.cpp
             tiny/exceptions/relationnotloadederror.cpp
+            tiny/identitymap.cpp
             tiny/tinytypes.cpp
             tiny/utils/attribute.cpp
         )
@@ -295,6 +325,7 @@ function(tinytom_sources out_headers out_sources)
         commands/command.hpp
         commands/completecommand.hpp
         commands/database/seedcommand.hpp
+        commands/database/snapshotcommand.hpp
         commands/database/wipecommand.hpp
         commands/environmentcommand.hpp
         commands/helpcommand.hpp
@@ -327,6 +358,7 @@ function(tinytom_sources out_headers out_sources)
         commands/migrations/rollbackcommand.hpp
         commands/migrations/statuscommand.hpp
         commands/migrations/uninstallcommand.hpp
+        commands/schema/dumpcommand.hpp
         commands/stubs/integratestubs.hpp
         concerns/callscommands.hpp
         concerns/confirmable.hpp
@@ -342,8 +374,13 @@ function(tinytom_sources out_headers out_sources)
         exceptions/runtimeerror.hpp
         exceptions/tomerror.hpp
         migration.hpp
+        migrationreport.hpp
         migrationrepository.hpp
         migrator.hpp
+        schema/mysqlschemastate.hpp
+        schema/postgresschemastate.hpp
+        schema/schemastate.hpp
+        schema/sqliteschemastate.hpp
         seeder.hpp
         terminal.hpp
         tomconstants.hpp
@@ -368,6 +405,7 @@ function(tinytom_sources out_headers out_sources)
         commands/command.cpp
         commands/completecommand.cpp
         commands/database/seedcommand.cpp
+        commands/database/snapshotcommand.cpp
         commands/database/wipecommand.cpp
         commands/environmentcommand.cpp
         commands/helpcommand.cpp
@@ -393,6 +431,7 @@ function(tinytom_sources out_headers out_sources)
         commands/migrations/rollbackcommand.cpp
         commands/migrations/statuscommand.cpp
         commands/migrations/uninstallcommand.cpp
+        commands/schema/dumpcommand.cpp
         concerns/callscommands.cpp
         concerns/confirmable.cpp
         concerns/guesscommandname.cpp
@@ -402,8 +441,13 @@ function(tinytom_sources out_headers out_sources)
         concerns/usingconnection.cpp
         exceptions/tomlogicerror.cpp
         exceptions/tomruntimeerror.cpp
+        migrationreport.cpp
         migrationrepository.cpp
         migrator.cpp
+        schema/mysqlschemastate.cpp
+        schema/postgresschemastate.cpp
+        schema/schemastate.cpp
+        schema/sqliteschemastate.cpp
         seeder.cpp
         terminal.cpp
         tomutils.cpp
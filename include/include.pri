@@ -11,8 +11,10 @@ else: \
 
 headersList += \
     $$PWD/orm/basegrammar.hpp \
+    $$PWD/orm/concerns/capturesslowqueries.hpp \
     $$PWD/orm/concerns/countsqueries.hpp \
     $$PWD/orm/concerns/detectslostconnections.hpp \
+    $$PWD/orm/concerns/dispatchesqueryevents.hpp \
     $$PWD/orm/concerns/hasconnectionresolver.hpp \
     $$PWD/orm/concerns/logsqueries.hpp \
     $$PWD/orm/concerns/managestransactions.hpp \
@@ -43,8 +45,10 @@ headersList += \
     $$PWD/orm/exceptions/logicerror.hpp \
     $$PWD/orm/exceptions/lostconnectionerror.hpp \
     $$PWD/orm/exceptions/multiplerecordsfounderror.hpp \
+    $$PWD/orm/exceptions/nontransactionalcommanderror.hpp \
     $$PWD/orm/exceptions/ormerror.hpp \
     $$PWD/orm/exceptions/queryerror.hpp \
+    $$PWD/orm/exceptions/querytimeouterror.hpp \
     $$PWD/orm/exceptions/recordsnotfounderror.hpp \
     $$PWD/orm/exceptions/runtimeerror.hpp \
     $$PWD/orm/exceptions/searchpathemptyerror.hpp \
@@ -95,9 +99,19 @@ headersList += \
     $$PWD/orm/schema/schematypes.hpp \
     $$PWD/orm/schema/sqliteschemabuilder.hpp \
     $$PWD/orm/sqliteconnection.hpp \
+    $$PWD/orm/support/cachedsqlresult.hpp \
+    $$PWD/orm/support/connectionworkers.hpp \
     $$PWD/orm/support/databaseconfiguration.hpp \
     $$PWD/orm/support/databaseconnectionsmap.hpp \
+    $$PWD/orm/support/querycache.hpp \
+    $$PWD/orm/support/querycacheinterface.hpp \
+    $$PWD/orm/support/repeatedqueriesreporter.hpp \
+    $$PWD/orm/types/batchstatement.hpp \
+    $$PWD/orm/types/bindingsmap.hpp \
     $$PWD/orm/types/log.hpp \
+    $$PWD/orm/types/querycancelhandle.hpp \
+    $$PWD/orm/types/queryevents.hpp \
+    $$PWD/orm/types/slowquery.hpp \
     $$PWD/orm/types/sqlquery.hpp \
     $$PWD/orm/types/statementscounter.hpp \
     $$PWD/orm/utils/configuration.hpp \
@@ -124,12 +138,16 @@ headersList += \
         $$PWD/orm/tiny/concerns/hasrelationstore.hpp \
         $$PWD/orm/tiny/concerns/hastimestamps.hpp \
         $$PWD/orm/tiny/concerns/hidesattributes.hpp \
+        $$PWD/orm/tiny/concerns/preventslazyloading.hpp \
         $$PWD/orm/tiny/concerns/queriesrelationships.hpp \
+        $$PWD/orm/tiny/exceptions/lazyloadingviolationerror.hpp \
         $$PWD/orm/tiny/exceptions/massassignmenterror.hpp \
         $$PWD/orm/tiny/exceptions/modelnotfounderror.hpp \
         $$PWD/orm/tiny/exceptions/mutatormappingnotfounderror.hpp \
         $$PWD/orm/tiny/exceptions/relationmappingnotfounderror.hpp \
         $$PWD/orm/tiny/exceptions/relationnotloadederror.hpp \
+        $$PWD/orm/tiny/factory.hpp \
+        $$PWD/orm/tiny/identitymap.hpp \
         $$PWD/orm/tiny/macros/crtpmodel.hpp \
         $$PWD/orm/tiny/macros/crtpmodelwithbase.hpp \
         $$PWD/orm/tiny/macros/relationstoresaliases.hpp \
@@ -164,6 +182,7 @@ headersList += \
         $$PWD/orm/tiny/types/connectionoverride.hpp \
         $$PWD/orm/tiny/types/modelattributes.hpp \
         $$PWD/orm/tiny/types/modelscollection.hpp \
+        $$PWD/orm/tiny/types/modelskeyedview.hpp \
         $$PWD/orm/tiny/types/syncchanges.hpp \
         $$PWD/orm/tiny/utils/attribute.hpp \
 
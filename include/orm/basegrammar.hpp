@@ -5,6 +5,10 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <array>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include "orm/macros/export.hpp"
 #include "orm/ormconcepts.hpp"
 #include "orm/ormtypes.hpp"
@@ -45,7 +49,7 @@ namespace Query
         /*! Get the format for database stored dates. */
         virtual const QString &getDateFormat() const;
 
-        /*! Wrap a value in keyword identifiers. */
+        /*! Wrap a value in keyword identifiers (cached). */
         QString wrap(const QString &value, bool prefixAlias = false) const;
         /*! Wrap a value in keyword identifiers. */
         QString wrap(const Column &value) const;
@@ -102,6 +106,8 @@ namespace Query
         /*! Get the appropriate query parameter place-holder for a value. */
         static QString parameter(const QVariant &value);
 
+        /*! Wrap a value in keyword identifiers, bypasses the wrap cache. */
+        QString wrapUncached(const QString &value, bool prefixAlias) const;
         /*! Wrap a value that has an alias. */
         QString wrapAliasedValue(const QString &value, bool prefixAlias = false) const;
         /*! Wrap a single string in keyword identifiers. */
@@ -117,6 +123,18 @@ namespace Query
         // FEATURE qt6, use everywhere QLatin1String("") instead of = "", BUT Qt6 has char8_t ctor, so u"" can be used, I will wait with this problem silverqx
         /*! The grammar table prefix. */
         QString m_tablePrefix {};
+
+    private:
+        /*! Maximum number of identifiers in the wrap cache (for one prefixAlias). */
+        constexpr static std::size_t WrapCacheMaxSize = 1024;
+
+        /*! Wrapped identifiers keyed by the raw identifier, the index is
+            the prefixAlias flag. */
+        mutable std::array<std::unordered_map<QString, QString>, 2> m_wrapCache {};
+        /*! Generation of the wrap cache, incremented when the cache is invalidated. */
+        mutable std::size_t m_wrapCacheGeneration = 0;
+        /*! Guards the wrap cache, grammars can be shared across threads. */
+        mutable std::shared_mutex m_wrapCacheMutex;
     };
 
     /* public */
@@ -0,0 +1,162 @@
+#pragma once
+#ifndef ORM_CONCERNS_CAPTURESSLOWQUERIES_HPP
+#define ORM_CONCERNS_CAPTURESSLOWQUERIES_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlDriver>
+#include <QtSql/QSqlQuery>
+
+#include <deque>
+
+#include "orm/macros/export.hpp"
+#include "orm/types/slowquery.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+
+class DatabaseConnection;
+
+namespace Concerns
+{
+
+    /*! Captures queries exceeding the slow query threshold into the bounded buffer,
+        optionally with the query plan obtained by the EXPLAIN statement. */
+    class SHAREDLIB_EXPORT CapturesSlowQueries
+    {
+        Q_DISABLE_COPY(CapturesSlowQueries)
+
+    public:
+        /*! Default maximum number of captured slow queries. */
+        constexpr static std::size_t DefaultSlowQueriesLimit = 100;
+
+        /*! Default constructor. */
+        inline CapturesSlowQueries() = default;
+        /*! Pure virtual destructor, to pass -Weffc++. */
+        inline virtual ~CapturesSlowQueries() = 0;
+
+        /*! Determine whether the slow queries are being captured. */
+        inline bool capturingSlowQueries() const noexcept;
+        /*! Set the slow query threshold in milliseconds (-1 to disable capturing). */
+        DatabaseConnection &setSlowQueryThreshold(qint64 milliseconds);
+        /*! Get the slow query threshold in milliseconds (-1 if disabled). */
+        inline qint64 getSlowQueryThreshold() const noexcept;
+
+        /*! Determine whether the slow queries are explained. */
+        inline bool explainingSlowQueries() const noexcept;
+        /*! Obtain the query plan of every captured slow query. */
+        DatabaseConnection &explainSlowQueries(bool value = true);
+
+        /*! Set the maximum number of captured slow queries, the oldest are dropped. */
+        DatabaseConnection &setSlowQueriesLimit(std::size_t limit);
+        /*! Get the maximum number of captured slow queries. */
+        inline std::size_t getSlowQueriesLimit() const noexcept;
+
+        /*! Register a callback invoked for every captured slow query. */
+        DatabaseConnection &onSlowQuery(SlowQueryCallback callback);
+
+        /*! Get the captured slow queries, the oldest first. */
+        inline const std::deque<SlowQuery> &getSlowQueries() const noexcept;
+        /*! Obtain and forget the captured slow queries. */
+        std::deque<SlowQuery> takeSlowQueries();
+        /*! Forget the captured slow queries. */
+        DatabaseConnection &flushSlowQueries();
+
+        /*! Get the name of the side connection used to explain the slow queries. */
+        static QString explainConnectionName(const QString &connection);
+
+    protected:
+        /*! Configure the slow queries capturing from the connection configuration. */
+        void configureSlowQueries(const QVariantHash &config);
+
+        /*! Determine whether the query with the given execution time is slow. */
+        inline bool isSlowQuery(qint64 elapsed) const noexcept;
+        /*! Capture the slow query (the elapsed time is in nanoseconds). */
+        void captureSlowQuery(const QString &queryString,
+                              const QVector<QVariant> &preparedBindings,
+                              qint64 elapsed, const QString &error = {});
+
+    private:
+        /*! Obtain the query plan for the given query (on the side connection if not
+            in the transaction). */
+        QString explainSlowQuery(const QString &queryString,
+                                 const QVector<QVariant> &preparedBindings);
+        /*! Execute the EXPLAIN statement on the current connection inside
+            the savepoint (used in the transaction). */
+        QString explainInSavepoint(const QString &explainQuery);
+        /*! Execute the EXPLAIN statement and format the query plan. */
+        static QString executeExplain(QSqlQuery &query, const QString &explainQuery);
+        /*! Get the side connection used to explain the slow queries. */
+        DatabaseConnection &explainConnection();
+
+        /*! Throw if the given slow query threshold is invalid. */
+        static qint64 validateSlowQueryThreshold(qint64 milliseconds);
+        /*! Determine whether the given query can be explained. */
+        static bool isExplainable(const QString &queryString,
+                                  const QVector<QVariant> &bindings);
+        /*! Replace the placeholders with bindings formatted by the given driver. */
+        static QString
+        inlineBindings(const QString &queryString, const QVector<QVariant> &bindings,
+                       const QSqlDriver &driver);
+
+        /*! Dynamic cast *this to the DatabaseConnection & derived type. */
+        DatabaseConnection &databaseConnection();
+
+        /*! The slow query threshold in milliseconds (-1 if disabled). */
+        qint64 m_slowQueryThreshold = -1;
+        /*! Indicates whether the slow queries are explained. */
+        bool m_explainSlowQueries = false;
+        /*! The maximum number of captured slow queries. */
+        std::size_t m_slowQueriesLimit = DefaultSlowQueriesLimit;
+        /*! The captured slow queries, the oldest first. */
+        std::deque<SlowQuery> m_slowQueries;
+        /*! Callback invoked for every captured slow query. */
+        SlowQueryCallback m_slowQueryCallback = nullptr;
+    };
+
+    /* public */
+
+    CapturesSlowQueries::~CapturesSlowQueries() = default;
+
+    bool CapturesSlowQueries::capturingSlowQueries() const noexcept
+    {
+        return m_slowQueryThreshold >= 0;
+    }
+
+    qint64 CapturesSlowQueries::getSlowQueryThreshold() const noexcept
+    {
+        return m_slowQueryThreshold;
+    }
+
+    bool CapturesSlowQueries::explainingSlowQueries() const noexcept
+    {
+        return m_explainSlowQueries;
+    }
+
+    std::size_t CapturesSlowQueries::getSlowQueriesLimit() const noexcept
+    {
+        return m_slowQueriesLimit;
+    }
+
+    const std::deque<SlowQuery> &
+    CapturesSlowQueries::getSlowQueries() const noexcept
+    {
+        return m_slowQueries;
+    }
+
+    /* protected */
+
+    bool CapturesSlowQueries::isSlowQuery(const qint64 elapsed) const noexcept
+    {
+        return capturingSlowQueries() && elapsed > m_slowQueryThreshold * 1'000'000;
+    }
+
+} // namespace Concerns
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_CONCERNS_CAPTURESSLOWQUERIES_HPP
@@ -0,0 +1,116 @@
+#pragma once
+#ifndef ORM_CONCERNS_DISPATCHESQUERYEVENTS_HPP
+#define ORM_CONCERNS_DISPATCHESQUERYEVENTS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlQuery>
+
+#include <vector>
+
+#include "orm/macros/export.hpp"
+#include "orm/types/queryevents.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+
+class DatabaseConnection;
+
+namespace Concerns
+{
+
+    /*! Dispatches the query executed and connection events to registered listeners. */
+    class SHAREDLIB_EXPORT DispatchesQueryEvents
+    {
+        Q_DISABLE_COPY(DispatchesQueryEvents)
+
+        // To access dispatchConnectionEvent() method
+        friend class ManagesTransactions;
+
+    public:
+        /*! Default constructor. */
+        inline DispatchesQueryEvents() = default;
+        /*! Pure virtual destructor, to pass -Weffc++. */
+        inline virtual ~DispatchesQueryEvents() = 0;
+
+        /*! Register a listener invoked after every executed query. */
+        DatabaseConnection &listen(QueryListener listener);
+        /*! Register a listener invoked when the connection or transaction state
+            changes. */
+        DatabaseConnection &listenForConnectionEvents(ConnectionEventListener listener);
+        /*! Remove all registered listeners. */
+        DatabaseConnection &forgetListeners();
+
+        /*! Register a listener invoked after every executed query and return its ID. */
+        std::size_t addQueryListener(QueryListener listener);
+        /*! Remove the query listener with the given ID. */
+        bool removeQueryListener(std::size_t id);
+
+        /*! Determine whether any query listener is registered. */
+        inline bool hasQueryListeners() const noexcept;
+        /*! Determine whether any connection event listener is registered. */
+        inline bool hasConnectionEventListeners() const noexcept;
+
+    protected:
+        /*! Dispatch the query executed event to all query listeners. */
+        void dispatchQueryExecuted(
+                const QSqlQuery &query, const QString &queryString,
+                const QVector<QVariant> &preparedBindings, qint64 elapsed,
+                const QString &type) const;
+        /*! Dispatch the query executed event to all query listeners. */
+        inline void dispatchQueryExecuted(
+                const std::tuple<int, QSqlQuery> &queryResult,
+                const QString &queryString, const QVector<QVariant> &preparedBindings,
+                qint64 elapsed, const QString &type) const;
+
+        /*! Dispatch the connection event to all connection event listeners. */
+        void dispatchConnectionEvent(ConnectionEvent::Type type) const;
+
+    private:
+        /*! Dynamic cast *this to the DatabaseConnection & derived type. */
+        DatabaseConnection &databaseConnection();
+        /*! Dynamic cast *this to the DatabaseConnection & derived type, const version. */
+        const DatabaseConnection &databaseConnection() const;
+
+        /*! Listeners invoked after every executed query (ID and listener). */
+        std::vector<std::pair<std::size_t, QueryListener>> m_queryListeners;
+        /*! ID of the last registered query listener. */
+        std::size_t m_queryListenerId = 0;
+        /*! Listeners invoked when the connection or transaction state changes. */
+        std::vector<ConnectionEventListener> m_connectionEventListeners;
+    };
+
+    /* public */
+
+    DispatchesQueryEvents::~DispatchesQueryEvents() = default;
+
+    bool DispatchesQueryEvents::hasQueryListeners() const noexcept
+    {
+        return !m_queryListeners.empty();
+    }
+
+    bool DispatchesQueryEvents::hasConnectionEventListeners() const noexcept
+    {
+        return !m_connectionEventListeners.empty();
+    }
+
+    /* protected */
+
+    void DispatchesQueryEvents::dispatchQueryExecuted(
+            const std::tuple<int, QSqlQuery> &queryResult, const QString &queryString,
+            const QVector<QVariant> &preparedBindings, const qint64 elapsed,
+            const QString &type) const
+    {
+        dispatchQueryExecuted(std::get<1>(queryResult), queryString, preparedBindings,
+                              elapsed, type);
+    }
+
+} // namespace Concerns
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_CONCERNS_DISPATCHESQUERYEVENTS_HPP
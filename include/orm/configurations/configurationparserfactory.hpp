@@ -6,8 +6,11 @@
 TINY_SYSTEM_HEADER
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "orm/configurations/configurationparserinterface.hpp"
+#include "orm/macros/threadlocal.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -33,7 +36,24 @@ namespace Orm::Configurations
         static std::unique_ptr<ConfigurationParserInterface>
         make(const QString &driver);
 
+        /*! Destroy cached configuration parsers of the current thread. */
+        static void removeCurrentThreadCache();
+
     private:
+        /*! Type used to cache configuration parsers (driver name => parser). */
+        using ParsersCacheType =
+                std::unordered_map<QString, std::unique_ptr<ConfigurationParserInterface>>;
+
+        /*! Get configuration parsers cache for the current thread. */
+        static ParsersCacheType &parsersCache();
+#ifndef TINYORM_HAS_THREAD_LOCAL
+        /*! Get configuration parsers caches for all threads (keyed by the thread
+            ordinal). */
+        static std::unordered_map<quint64, ParsersCacheType> &parsersCaches();
+        /*! Get the mutex that guards the parsersCaches(). */
+        static std::mutex &cachesMutex();
+#endif
+
         /*! Get a normalized driver name (using the toUpper()). */
         static QString getDriverName(const QVariantHash &config);
     };
@@ -5,6 +5,8 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <unordered_set>
+
 #include "orm/configurations/configurationparser.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -29,6 +31,14 @@ namespace Orm::Configurations
         void parseDriverSpecificOptions() const final;
         /*! Parse the driver-specific 'options' configuration option. */
         void parseDriverSpecificOptionsOption(QVariantHash &options) const final;
+
+    private:
+        /*! Throw if the pragma configuration option contains an unsupported value. */
+        void throwIfPragmaHasWrongValue(
+                const QString &pragma, const std::unordered_set<QString> &allowed) const;
+        /*! Throw if the pragma configuration option isn't an integer number. */
+        void throwIfPragmaIsNotInteger(const QString &pragma,
+                                       bool allowNegative = false) const;
     };
 
 } // namespace Orm::Configurations
@@ -31,6 +31,9 @@ namespace Orm::Connectors
         createConnection(const QString &name, const QVariantHash &config,
                          const QString &options);
 
+        /*! Get the QSqlDatabase connection name for the current thread. */
+        static QString qtConnectionName(const QString &connection);
+
         /*! Get the QSqlDatabase connection options based on the configuration. */
         QString getOptions(const QVariantHash &config) const;
 
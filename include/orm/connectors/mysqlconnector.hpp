@@ -32,30 +32,34 @@ namespace Orm::Connectors
         const QVariantHash &getConnectorOptions() const override;
 
     protected:
-        /*! Set the connection transaction isolation level. */
-        static void configureIsolationLevel(const QSqlDatabase &connection,
-                                            const QVariantHash &config);
-        /*! Set the connection character set and collation. */
-        static void configureEncoding(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
+        /*! Configure the connection session using one SET statement. */
+        static void configureSession(const QSqlDatabase &connection,
+                                     const QVariantHash &config);
+        /*! Get all session variable assignments for the SET statement. */
+        static QStringList getSessionAssignments(const QSqlDatabase &connection,
+                                                 const QVariantHash &config);
+
+        /*! Compile the connection transaction isolation level assignment. */
+        static QString compileIsolationLevel(const QSqlDatabase &connection,
+                                             const QVariantHash &config);
+        /*! Compile the connection character set and collation assignment. */
+        static QString compileEncoding(const QVariantHash &config);
         /*! Get the collation for the configuration. */
         static QString getCollation(const QVariantHash &config);
-        /*! Set the timezone on the connection. */
-        static void configureTimezone(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
-
-        /*! Set the modes for the connection. */
-        static void setModes(const QSqlDatabase &connection,
-                             const QVariantHash &config);
-        /*! Get the query to enable strict mode. */
+        /*! Compile the timezone assignment. */
+        static QString compileTimezone(const QVariantHash &config);
+
+        /*! Compile the modes assignment for the connection. */
+        static QString compileModes(const QSqlDatabase &connection,
+                                    const QVariantHash &config);
+        /*! Get the assignment to enable strict mode. */
         static QString strictMode(const QSqlDatabase &connection,
                                   const QVariantHash &config);
-        /*! Get the MySQL server version. */
+        /*! Get the MySQL server version (cached for every host). */
         static QString getMySqlVersion(const QSqlDatabase &connection,
                                        const QVariantHash &config);
-        /*! Set the custom modes on the connection. */
-        static void setCustomModes(const QSqlDatabase &connection,
-                                   const QVariantHash &config);
+        /*! Compile the custom modes assignment. */
+        static QString compileCustomModes(const QVariantHash &config);
 
     private:
         /*! Get the MySQL server version querying the database server. */
@@ -36,28 +36,18 @@ namespace Orm::Connectors
         const QVariantHash &getConnectorOptions() const override;
 
     protected:
-        /*! Set the connection transaction isolation level. */
-        static void configureIsolationLevel(const QSqlDatabase &connection,
-                                            const QVariantHash &config);
-        /*! Set the connection character set and collation. */
-        static void configureEncoding(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
-        /*! Set the timezone on the connection. */
-        static void configureTimezone(const QSqlDatabase &connection,
-                                      const QVariantHash &config);
+        /*! Add the session configuration to the connection startup options. */
+        static void addStartupOptions(QString &options, const QVariantHash &config);
+        /*! Get the -c command-line options for the 'options' startup option. */
+        static QStringList getSessionSettings(const QVariantHash &config);
 
-        /*! Set the 'search_path' on the database connection. */
-        static void configureSearchPath(const QSqlDatabase &connection,
-                                        const QVariantHash &config);
-        /*! Format the 'search_path' for the database query or DSN. */
+        /*! Format the 'search_path' for the startup option or DSN. */
         static QString quoteSearchPath(const QStringList &searchPath);
 
-        /*! Set an application name for the connection. */
-        static void configureApplicationName(const QSqlDatabase &connection,
-                                             const QVariantHash &config);
-        /*! Configure the synchronous_commit setting. */
-        static void configureSynchronousCommit(const QSqlDatabase &connection,
-                                               const QVariantHash &config);
+        /*! Compile the -c command-line option for the configuration parameter. */
+        static QString compileSessionSetting(const QString &name, QString value);
+        /*! Compile the libpq connection startup option. */
+        static QString compileStartupOption(const QString &name, QString value);
 
     private:
         /*! The default QSqlDatabase connection options for the SQLiteConnector. */
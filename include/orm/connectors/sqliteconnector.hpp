@@ -8,6 +8,8 @@ TINY_SYSTEM_HEADER
 #include "orm/connectors/connector.hpp"
 #include "orm/connectors/connectorinterface.hpp"
 
+class QSqlQuery;
+
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 namespace Orm::Connectors
@@ -35,8 +37,14 @@ namespace Orm::Connectors
         /*! Set the connection foreign key constraints. */
         static void configureForeignKeyConstraints(const QSqlDatabase &connection,
                                                    const QVariantHash &config);
+        /*! Set the performance pragmas on the connection. */
+        static void configurePragmas(const QSqlDatabase &connection,
+                                     const QVariantHash &config);
 
     private:
+        /*! Warn if the journal mode returned by the journal_mode pragma differs. */
+        static void checkJournalMode(QSqlQuery &query, const QString &expected,
+                                     const QString &connectionName);
         /*! Check whether the SQLite database file exists. */
         static void checkDatabaseExists(const QVariantHash &config);
 
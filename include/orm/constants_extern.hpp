@@ -122,6 +122,18 @@ namespace Orm::Constants
     SHAREDLIB_EXPORT extern const QString application_name;
     SHAREDLIB_EXPORT extern const QString synchronous_commit;
     SHAREDLIB_EXPORT extern const QString spatial_ref_sys;
+    SHAREDLIB_EXPORT extern const QString query_timeout;
+    SHAREDLIB_EXPORT extern const QString slow_query_threshold;
+    SHAREDLIB_EXPORT extern const QString explain_slow_queries;
+
+    // SQLite pragmas
+    SHAREDLIB_EXPORT extern const QString journal_mode;
+    SHAREDLIB_EXPORT extern const QString synchronous;
+    SHAREDLIB_EXPORT extern const QString busy_timeout;
+    SHAREDLIB_EXPORT extern const QString cache_size;
+    SHAREDLIB_EXPORT extern const QString mmap_size;
+    SHAREDLIB_EXPORT extern const QString temp_store;
+    SHAREDLIB_EXPORT extern const QString wal_autocheckpoint;
 
     SHAREDLIB_EXPORT extern const QString H127001;
     SHAREDLIB_EXPORT extern const QString LOCALHOST;
@@ -129,6 +129,28 @@ namespace Orm::Constants
     synchronous_commit      = QStringLiteral("synchronous_commit");
     inline const QString
     spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    inline const QString
+    query_timeout           = QStringLiteral("query_timeout");
+    inline const QString
+    slow_query_threshold    = QStringLiteral("slow_query_threshold");
+    inline const QString
+    explain_slow_queries    = QStringLiteral("explain_slow_queries");
+
+    // SQLite pragmas
+    inline const QString
+    journal_mode            = QStringLiteral("journal_mode");
+    inline const QString
+    synchronous             = QStringLiteral("synchronous");
+    inline const QString
+    busy_timeout            = QStringLiteral("busy_timeout");
+    inline const QString
+    cache_size              = QStringLiteral("cache_size");
+    inline const QString
+    mmap_size               = QStringLiteral("mmap_size");
+    inline const QString
+    temp_store              = QStringLiteral("temp_store");
+    inline const QString
+    wal_autocheckpoint      = QStringLiteral("wal_autocheckpoint");
 
     inline const QString H127001   = QStringLiteral("127.0.0.1");
     inline const QString LOCALHOST = QStringLiteral("localhost");
@@ -5,8 +5,13 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <QFuture>
+#include <QScopedValueRollback>
+
+#include "orm/concerns/capturesslowqueries.hpp"
 #include "orm/concerns/countsqueries.hpp"
 #include "orm/concerns/detectslostconnections.hpp"
+#include "orm/concerns/dispatchesqueryevents.hpp"
 #include "orm/concerns/logsqueries.hpp"
 #include "orm/concerns/managestransactions.hpp"
 #include "orm/connectors/connectorinterface.hpp"
@@ -15,6 +20,9 @@ TINY_SYSTEM_HEADER
 #include "orm/query/processors/processor.hpp"
 #include "orm/schema/grammars/schemagrammar.hpp"
 #include "orm/schema/schemabuilder.hpp"
+#include "orm/support/querycacheinterface.hpp"
+#include "orm/types/batchstatement.hpp"
+#include "orm/types/querycancelhandle.hpp"
 #include "orm/types/sqlquery.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -48,6 +56,8 @@ namespace Orm
             public Concerns::ManagesTransactions,
             public Concerns::LogsQueries,
             public Concerns::CountsQueries,
+            public Concerns::DispatchesQueryEvents,
+            public Concerns::CapturesSlowQueries,
             // Needed to suppress the -Wnon-virtual-dtor diagnostic
             public std::enable_shared_from_this<DatabaseConnection>
     {
@@ -137,6 +147,52 @@ namespace Orm
         /*! Run a raw, unprepared query against the database (good for DDL queries). */
         SqlQuery unprepared(const QString &queryString);
 
+        /*! Run the given statements back-to-back in one transaction and get
+            the number of rows affected and an error for every statement. */
+        QVector<BatchResult> batch(const QVector<BatchStatement> &statements);
+
+        /* Async queries */
+        /*! Run a select statement on the connection's worker thread. */
+        QFuture<QVector<QSqlRecord>>
+        selectAsync(const QString &queryString, QVector<QVariant> bindings = {}) const;
+        /*! Run an SQL statement on the connection's worker thread and get the number
+            of rows affected. */
+        QFuture<int>
+        affectingStatementAsync(const QString &queryString,
+                                QVector<QVariant> bindings = {}) const;
+
+        /* Query timeouts and cancellation */
+        /*! Get the default statement timeout in milliseconds (0 for no timeout). */
+        inline int getQueryTimeout() const noexcept;
+        /*! Set the default statement timeout in milliseconds (0 for no timeout). */
+        DatabaseConnection &setQueryTimeout(int milliseconds);
+        /*! Run the callback with the given statement timeout in milliseconds. */
+        template<typename F>
+        decltype(auto) withQueryTimeout(std::optional<int> milliseconds, F &&callback);
+
+        /*! Get the handle that cancels a query running on this connection from
+            another thread. */
+        QueryCancelHandle getCancelHandle();
+        /*! Cancel the query running on the connection with the given server process ID,
+            returns false if the database driver doesn't support cancellation. */
+        virtual bool cancelQuery(const QVariant &backendId);
+        /*! Determine whether the statement timeout also applies to the update and
+            delete statements (MySQL applies it to the select statements only). */
+        virtual bool supportsWriteQueryTimeout();
+
+        /* Query cache */
+        /*! Run a select statement and cache its result for the ttl seconds, the result
+            is invalidated when a statement writes to any of the given tables (to any
+            table if no tables are given). */
+        SqlQuery
+        selectRemembered(const QString &queryString, QVector<QVariant> bindings,
+                         int ttl, const QStringList &tables = {});
+        /*! Get the query cache used by the connection. */
+        Support::QueryCacheInterface &getQueryCache();
+        /*! Set the query cache used by the connection (can be shared by connections). */
+        DatabaseConnection &
+        setQueryCache(std::shared_ptr<Support::QueryCacheInterface> cache) noexcept;
+
         /* Obtain connection instance */
         /*! Get underlying database connection (QSqlDatabase). */
         QSqlDatabase getQtConnection();
@@ -161,6 +217,9 @@ namespace Orm
         inline bool isOpen();
         /*! Check database connection and show warnings when the state changed. */
         virtual bool pingDatabase();
+        /*! Determine whether the insert statement can return the inserted rows
+            (insert ... returning). */
+        virtual bool supportsInsertReturning();
 
         /*! Returns the database driver used to access the database connection. */
         QSqlDriver *driver();
@@ -261,6 +320,14 @@ namespace Orm
         /*! Get the default post processor instance. */
         virtual std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const = 0;
 
+        /*! Get the database server's process ID for the current connection. */
+        virtual QVariant getBackendId();
+        /*! Compile the statement that sets the statement timeout for the session,
+            returns an empty string if the database driver doesn't support it. */
+        virtual QString compileQueryTimeout(int milliseconds);
+        /*! Determine whether the given error was caused by the statement timeout. */
+        virtual bool causedByQueryTimeout(const QSqlError &error) const;
+
         /*! Callback type used in the run() method. */
         template<typename Return>
         using RunCallback =
@@ -309,6 +376,22 @@ namespace Orm
         /*! Indicates if the connection is in a "dry run". */
         bool m_pretending = false;
 
+        /* Query timeouts */
+        /*! The default statement timeout in milliseconds (0 for no timeout). */
+        int m_queryTimeout = 0;
+        /*! The statement timeout set by the withQueryTimeout() method. */
+        std::optional<int> m_queryTimeoutOverride = std::nullopt;
+        /*! The statement timeout set on the database session (nullopt if the server's
+            default is used, -1 if unknown eg. after a rollback). */
+        std::optional<int> m_sessionQueryTimeout = std::nullopt;
+        /*! The database server's process ID for the current connection. */
+        QVariant m_backendId;
+        /*! Determine whether the statement timeout is currently being applied. */
+        bool m_applyingQueryTimeout = false;
+
+        /*! The query result cache, created lazily. */
+        std::shared_ptr<Support::QueryCacheInterface> m_queryCache = nullptr;
+
     private:
         /*! Prepare an SQL statement and return the query object. */
         QSqlQuery prepareQuery(const QString &queryString);
@@ -318,18 +401,37 @@ namespace Orm
         /*! Prepare the QDateTime query binding for execution. */
         QDateTime prepareBinding(const QDateTime &binding) const;
 
+        /*! Throw the QueryError or QueryTimeoutError for the failed query. */
+        [[noreturn]] void
+        throwQueryError(const char *message, const QSqlQuery &query,
+                        const QVector<QVariant> &bindings = {}) const;
+
+        /*! Set the statement timeout on the database session if it has changed. */
+        void applyQueryTimeout();
+        /*! Invalidate the cached results that read from the table written by
+            the given statement. */
+        void invalidateQueryCache(const QString &queryString);
+        /*! Get the query cache key prefix that identifies the connection and
+            its database. */
+        QString queryCacheScope() const;
+        /*! Forget the state that may be reverted by a rollback (the session's
+            statement timeout and the cached results). */
+        void resetRolledBackState();
+        /*! Reset the database session state cached for the current connection. */
+        inline void resetSessionState() noexcept;
+
         /*! Handle a query exception. */
         template<typename Return>
         Return handleQueryException(
                 const std::exception_ptr &ePtr, const Exceptions::QueryError &e,
                 const QString &queryString, const QVector<QVariant> &preparedBindings,
-                const RunCallback<Return> &callback) const;
+                const RunCallback<Return> &callback);
         /*! Handle a query exception that occurred during query execution. */
         template<typename Return>
         Return tryAgainIfCausedByLostConnection(
                 const std::exception_ptr &ePtr, const Exceptions::QueryError &e,
                 const QString &queryString, const QVector<QVariant> &preparedBindings,
-                const RunCallback<Return> &callback) const;
+                const RunCallback<Return> &callback);
 
         /*! Determine if the elapsed time for queries should be counted. */
         inline bool shouldCountElapsed() const;
@@ -407,6 +509,28 @@ namespace Orm
         return affectingStatement(queryString, std::move(bindings));
     }
 
+    /* Query timeouts and cancellation */
+
+    int DatabaseConnection::getQueryTimeout() const noexcept
+    {
+        return m_queryTimeout;
+    }
+
+    template<typename F>
+    decltype(auto)
+    DatabaseConnection::withQueryTimeout(const std::optional<int> milliseconds,
+                                         F &&callback)
+    {
+        if (!milliseconds)
+            return std::invoke(std::forward<F>(callback));
+
+        // Restore the previous statement timeout, also when an exception is thrown
+        const QScopedValueRollback<std::optional<int>> rollback(m_queryTimeoutOverride,
+                                                                milliseconds);
+
+        return std::invoke(std::forward<F>(callback));
+    }
+
     /* Obtain connection instance */
 
     const std::function<Connectors::ConnectionName()> &
@@ -520,9 +644,13 @@ namespace Orm
 
         // Elapsed timer needed
         const auto countElapsed = shouldCountElapsed();
+        // Nothing is dispatched and measured if there are no query listeners
+        const auto dispatchEvents = !m_pretending && hasQueryListeners();
+        // Pretended queries are never slow
+        const auto captureSlowQueries = !m_pretending && capturingSlowQueries();
 
         QElapsedTimer timer;
-        if (countElapsed)
+        if (countElapsed || dispatchEvents || captureSlowQueries)
             timer.start();
 
         Return result;
@@ -536,13 +664,33 @@ namespace Orm
            caused by a connection that has been lost. If that is the cause, we'll try
            to re-establish connection and re-run the query with a fresh connection. */
         try {
+            if (!m_pretending)
+                applyQueryTimeout();
+
             result = runQueryCallback(queryString, preparedBindings, callback);
 
         }  catch (const Exceptions::QueryError &e) {
-            result = handleQueryException(std::current_exception(), e,
-                                          queryString, preparedBindings, callback);
+            try {
+                result = handleQueryException(std::current_exception(), e,
+                                              queryString, preparedBindings, callback);
+
+            } catch (const std::exception &error) {
+                /* The failed queries are captured too, eg. queries cancelled by
+                   the query timeout are the slowest queries of all. */
+                if (const auto elapsedNs = captureSlowQueries ? timer.nsecsElapsed() : -1;
+                    captureSlowQueries && isSlowQuery(elapsedNs)
+                )
+                    captureSlowQuery(queryString, preparedBindings, elapsedNs,
+                                     QString::fromUtf8(error.what()));
+
+                throw;
+            }
         }
 
+        // Query listeners and slow queries obtain the execution time in nanoseconds
+        const auto elapsedNs = dispatchEvents || captureSlowQueries
+                               ? timer.nsecsElapsed() : -1;
+
         std::optional<qint64> elapsed;
         if (countElapsed) {
             // Hit elapsed timer
@@ -560,6 +708,12 @@ namespace Orm
         else
             logQuery(result, elapsed, type);
 
+        if (dispatchEvents)
+            dispatchQueryExecuted(result, queryString, preparedBindings, elapsedNs, type);
+
+        if (captureSlowQueries && isSlowQuery(elapsedNs))
+            captureSlowQuery(queryString, preparedBindings, elapsedNs);
+
         return result;
     }
 
@@ -582,12 +736,18 @@ namespace Orm
         return QSqlQuery(QSqlDatabase());
     }
 
+    void DatabaseConnection::resetSessionState() noexcept
+    {
+        m_sessionQueryTimeout.reset();
+        m_backendId.clear();
+    }
+
     template<typename Return>
     Return
     DatabaseConnection::handleQueryException(
             const std::exception_ptr &ePtr, const Exceptions::QueryError &e,
             const QString &queryString, const QVector<QVariant> &preparedBindings,
-            const RunCallback<Return> &callback) const
+            const RunCallback<Return> &callback)
     {
         // FUTURE add info about in transaction into the exception that it was a reason why connection was not reconnected/recovered silverqx
         if (inTransaction())
@@ -602,13 +762,18 @@ namespace Orm
     DatabaseConnection::tryAgainIfCausedByLostConnection(
             const std::exception_ptr &ePtr, const Exceptions::QueryError &e,
             const QString &queryString, const QVector<QVariant> &preparedBindings,
-            const RunCallback<Return> &callback) const
+            const RunCallback<Return> &callback)
     {
         // TODO would be good to call KILL on lost connection to free locks, https://dev.mysql.com/doc/c-api/8.0/en/c-api-auto-reconnect.html silverqx
         if (causedByLostConnection(e)) {
             reconnect();
 
             // BUG rethrow e when causedByLostConnection to correctly inform user, causedByLostConnection state lost during second runQueryCallback(), because it internally tries to connect to DB and throws "Unable to connect to database" instead of "Lost connection", probably another try-catch and if catched "Unable to connect to database" then rethrow e (Lost connection)? silverqx
+            /* The new database session doesn't have the statement timeout set,
+               the reconnect resets the session state so it's set again. */
+            if (!m_pretending)
+                applyQueryTimeout();
+
             /* After the second failed attempt will be isOpen() == false because
                the m_qtConnection == std::nullopt. */
             return runQueryCallback(queryString, preparedBindings, callback);
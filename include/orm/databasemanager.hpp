@@ -114,6 +114,11 @@ namespace Query
         /*! Run a raw, unprepared query against the database. */
         SqlQuery unprepared(const QString &query, const QString &connection = "");
 
+        /*! Run the given statements back-to-back in one transaction. */
+        QVector<BatchResult>
+        batch(const QVector<BatchStatement> &statements,
+              const QString &connection = "");
+
         /*! Start a new database transaction. */
         bool beginTransaction(const QString &connection = "");
         /*! Commit the active database transaction. */
@@ -165,6 +170,9 @@ namespace Query
         bool removeConnection(const QString &name = "");
         /*! Determine whether a given connection is already registered. */
         bool containsConnection(const QString &name = "");
+        /*! Remove database connections of the current thread including their Qt
+            connections (configurations are kept), call it before a thread exits. */
+        void removeThreadConnections();
 
         /*! Reconnect to the given database. */
         DatabaseConnection &reconnect(const QString &name = "");
@@ -174,6 +182,14 @@ namespace Query
             to be called before querying a database. */
         void connectEagerly(const QString &name = "");
 
+        /*! Create a snapshot of the given database (replaces an existing snapshot). */
+        void createSnapshot(const QString &snapshot, const QString &connection = "");
+        /*! Restore the given database from the snapshot (fast database reset). */
+        void restoreSnapshot(const QString &snapshot, const QString &connection = "");
+        /*! Drop the given database snapshot if the snapshot exists. */
+        void dropSnapshotIfExists(const QString &snapshot,
+                                  const QString &connection = "");
+
         /*! Returns a list containing the names of all connections. */
         QStringList connectionNames() const;
         /*! Returns a list containing the names of opened connections. */
@@ -229,7 +245,7 @@ namespace Query
                                      const QString &connection = "") const;
         /*! Get an original configuration for the given connection
             (passed to the DB::create, original/unchanged). */
-        const QVariantHash &originalConfig(const QString &connection = "") const;
+        QVariantHash originalConfig(const QString &connection = "") const;
         /*! Get the number of registered connection configurations. */
         std::size_t originalConfigsSize() const;
 
@@ -275,6 +291,18 @@ namespace Query
         /*! The current order value for a query log record. */
         std::size_t getQueryLogOrder() const noexcept;
 
+        /* Query events */
+        /*! Register a listener invoked after every executed query. */
+        DatabaseConnection &
+        listen(QueryListener listener, const QString &connection = "");
+        /*! Register a listener invoked when the connection or transaction state
+            changes. */
+        DatabaseConnection &
+        listenForConnectionEvents(ConnectionEventListener listener,
+                                  const QString &connection = "");
+        /*! Remove all registered query and connection event listeners. */
+        DatabaseConnection &forgetListeners(const QString &connection = "");
+
         /* Queries execution time counter */
         /*! Determine whether we're counting queries execution time. */
         bool countingElapsed(const QString &connection = "");
@@ -380,10 +408,10 @@ namespace Query
         std::shared_ptr<DatabaseConnection>
         makeConnection(const QString &connection);
 
-        /*! Get the configuration for a connection. */
-        QVariantHash &configuration(const QString &connection);
-        /*! Throw if a given database connection doesn't have any configuration. */
-        void throwIfNoConfiguration(const QString &connection) const;
+        /*! Get the configuration for a connection (copy from the current snapshot). */
+        QVariantHash configuration(const QString &connection) const;
+        /*! Remove the configuration for the given connection. */
+        void removeConfiguration(const QString &connection);
 
         /*! Prepare the database connection instance. */
         std::shared_ptr<DatabaseConnection>
@@ -401,7 +429,7 @@ namespace Query
         static void registerQMetaTypesForQt5();
 #endif
 
-        /*! Database configuration. */
+        /*! Database configuration (shared by all threads). */
         Configuration m_configuration {};
         /*! Active database connection instances for the current thread. */
         Support::DatabaseConnectionsMap m_connections {};
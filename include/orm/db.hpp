@@ -109,6 +109,11 @@ namespace Orm
         static SqlQuery
         unprepared(const QString &query, const QString &connection = "");
 
+        /*! Run the given statements back-to-back in one transaction. */
+        static QVector<BatchResult>
+        batch(const QVector<BatchStatement> &statements,
+              const QString &connection = "");
+
         /*! Start a new database transaction. */
         static bool beginTransaction(const QString &connection = "");
         /*! Commit the active database transaction. */
@@ -157,6 +162,9 @@ namespace Orm
         static bool removeConnection(const QString &name = "");
         /*! Determine whether a given connection is already registered. */
         static bool containsConnection(const QString &name = "");
+        /*! Remove database connections of the current thread including their Qt
+            connections (configurations are kept), call it before a thread exits. */
+        static void removeThreadConnections();
 
         /*! Reconnect to the given database. */
         static DatabaseConnection &reconnect(const QString &name = "");
@@ -166,6 +174,16 @@ namespace Orm
             to be called before querying a database. */
         static void connectEagerly(const QString &name = "");
 
+        /*! Create a snapshot of the given database (replaces an existing snapshot). */
+        static void createSnapshot(const QString &snapshot,
+                                   const QString &connection = "");
+        /*! Restore the given database from the snapshot (fast database reset). */
+        static void restoreSnapshot(const QString &snapshot,
+                                    const QString &connection = "");
+        /*! Drop the given database snapshot if the snapshot exists. */
+        static void dropSnapshotIfExists(const QString &snapshot,
+                                         const QString &connection = "");
+
         /*! Returns a list containing the names of all connections. */
         static QStringList connectionNames();
         /*! Returns a list containing the names of opened connections. */
@@ -219,7 +237,7 @@ namespace Orm
         static QVariant originalConfigValue(const QString &option,
                                             const QString &connection = "");
         /*! Get the configuration for a connection. */
-        static const QVariantHash &originalConfig(const QString &connection = "");
+        static QVariantHash originalConfig(const QString &connection = "");
         /*! Get the number of registered connection configurations. */
         static std::size_t originalConfigsSize();
 
@@ -266,6 +284,18 @@ namespace Orm
         /*! The current order value for a query log record. */
         static std::size_t getQueryLogOrder() noexcept;
 
+        /* Query events */
+        /*! Register a listener invoked after every executed query. */
+        static DatabaseConnection &
+        listen(QueryListener listener, const QString &connection = "");
+        /*! Register a listener invoked when the connection or transaction state
+            changes. */
+        static DatabaseConnection &
+        listenForConnectionEvents(ConnectionEventListener listener,
+                                  const QString &connection = "");
+        /*! Remove all registered query and connection event listeners. */
+        static DatabaseConnection &forgetListeners(const QString &connection = "");
+
         /* Queries execution time counter */
         /*! Determine whether we're counting queries execution time. */
         static bool
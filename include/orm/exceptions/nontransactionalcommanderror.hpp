@@ -0,0 +1,26 @@
+#pragma once
+#ifndef ORM_EXCEPTIONS_NONTRANSACTIONALCOMMANDERROR_HPP
+#define ORM_EXCEPTIONS_NONTRANSACTIONALCOMMANDERROR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/exceptions/logicerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Exceptions
+{
+
+    /*! The schema command can't be executed inside a transaction block exception. */
+    class NonTransactionalCommandError : public LogicError // clazy:exclude=copyable-polymorphic
+    {
+        /*! Inherit constructors. */
+        using LogicError::LogicError;
+    };
+
+} // namespace Orm::Exceptions
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_EXCEPTIONS_NONTRANSACTIONALCOMMANDERROR_HPP
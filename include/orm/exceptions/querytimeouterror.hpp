@@ -0,0 +1,26 @@
+#pragma once
+#ifndef ORM_EXCEPTIONS_QUERYTIMEOUTERROR_HPP
+#define ORM_EXCEPTIONS_QUERYTIMEOUTERROR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/exceptions/queryerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Exceptions
+{
+
+    /*! TinyORM query exceeded the statement timeout exception. */
+    class QueryTimeoutError : public QueryError // clazy:exclude=copyable-polymorphic
+    {
+        /*! Inherit constructors. */
+        using QueryError::QueryError;
+    };
+
+} // namespace Orm::Exceptions
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_EXCEPTIONS_QUERYTIMEOUTERROR_HPP
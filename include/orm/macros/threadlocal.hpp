@@ -21,6 +21,7 @@ TINY_SYSTEM_HEADER
     !(defined(__GNUG__) && !defined(__clang__) && defined(__MINGW32__)) &&              \
     !defined(TINYORM_DISABLE_THREAD_LOCAL)
 #  define T_THREAD_LOCAL thread_local
+#  define TINYORM_HAS_THREAD_LOCAL
 #endif
 
 #if !defined(T_THREAD_LOCAL)
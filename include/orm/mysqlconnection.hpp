@@ -54,6 +54,13 @@ namespace Orm
             own reconnector. */
         bool pingDatabase() final;
 
+        /*! Cancel the query running on the connection with the given server process ID
+            (KILL QUERY). */
+        bool cancelQuery(const QVariant &backendId) final;
+        /*! Determine whether the statement timeout also applies to the update and
+            delete statements (MariaDB's max_statement_time only). */
+        bool supportsWriteQueryTimeout() final;
+
     protected:
         /*! Get the default query grammar instance. */
         std::unique_ptr<QueryGrammar> getDefaultQueryGrammar() const final;
@@ -64,6 +71,13 @@ namespace Orm
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
 
+        /*! Get the database server's process ID for the current connection. */
+        QVariant getBackendId() final;
+        /*! Compile the statement that sets the statement timeout for the session. */
+        QString compileQueryTimeout(int milliseconds) final;
+        /*! Determine whether the given error was caused by the statement timeout. */
+        bool causedByQueryTimeout(const QSqlError &error) const final;
+
         /*! MySQL server version. */
         std::optional<QString> m_version = std::nullopt;
         /*! Is currently connected the MariaDB database server? */
@@ -12,6 +12,7 @@ TINY_SYSTEM_HEADER
 
 #include "orm/constants.hpp"
 #include "orm/query/expression.hpp"
+#include "orm/types/bindingsmap.hpp"
 
 // TODO types, divide to public/private silverqx
 
@@ -39,23 +40,6 @@ namespace Query
     /*! Type for the from clause. */
     using FromClause = std::variant<std::monostate, QString, Query::Expression>;
 
-    /*! Binding types. */
-    enum struct BindingType
-    {
-        SELECT,
-        FROM,
-        JOIN,
-        WHERE,
-        GROUPBY,
-        HAVING,
-        ORDER,
-        UNION,
-        UNIONORDER,
-    };
-
-    /*! Type for the query value bindings. */
-    using BindingsMap = QMap<BindingType, QVector<QVariant>>;
-
     /*! Aggregate item. */
     struct AggregateItem
     {
@@ -106,6 +90,15 @@ namespace Query
         QString    sql        {}; // for the raw version
     };
 
+    /*! Common table expression item (with clause). */
+    struct CommonTableExpressionItem
+    {
+        QString     name;
+        QString     query;
+        QStringList columns   {};
+        bool        recursive = false;
+    };
+
     /*! Order by clause item. */
     struct OrderByItem
     {
@@ -114,6 +107,13 @@ namespace Query
         QString     sql       {}; // for the raw version
     };
 
+    /*! Union clause item. */
+    struct UnionItem
+    {
+        std::shared_ptr<QueryBuilder> query;
+        bool                          all = false;
+    };
+
     /*! Update item. */
     struct UpdateItem
     {
@@ -46,6 +46,14 @@ namespace Orm
             (without resolving the "$user" variable). */
         QStringList searchPathRaw(bool flushCache = false);
 
+        /* Others */
+        /*! Cancel the query running on the connection with the given server process ID
+            (pg_cancel_backend()). */
+        bool cancelQuery(const QVariant &backendId) final;
+        /*! Determine whether the insert statement can return the inserted rows
+            (always true for PostgreSQL). */
+        inline bool supportsInsertReturning() final;
+
     protected:
         /*! Get the default query grammar instance. */
         std::unique_ptr<QueryGrammar> getDefaultQueryGrammar() const final;
@@ -56,6 +64,13 @@ namespace Orm
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
 
+        /*! Get the database server's process ID for the current connection. */
+        QVariant getBackendId() final;
+        /*! Compile the statement that sets the statement timeout for the session. */
+        QString compileQueryTimeout(int milliseconds) final;
+        /*! Determine whether the given error was caused by the statement timeout. */
+        bool causedByQueryTimeout(const QSqlError &error) const final;
+
     private:
         /*! Get the PostgreSQL server 'search_path' (for pretend mode). */
         QStringList searchPathRawForPretending() const;
@@ -82,6 +97,11 @@ namespace Orm
                         std::move(config)));
     }
 
+    bool PostgresConnection::supportsInsertReturning()
+    {
+        return true;
+    }
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
@@ -46,6 +46,11 @@ namespace Orm::Query::Grammars
         compileInsertGetId(const QueryBuilder &query,
                            const QVector<QVariantMap> &values,
                            const QString &sequence) const;
+        /*! Compile an insert statement that returns the given columns of every
+            inserted row into SQL (insert ... returning). */
+        QString compileInsertReturning(const QueryBuilder &query,
+                                       const QVector<QVariantMap> &values,
+                                       const QVector<QString> &columns) const;
 
         /*! Compile an update statement into SQL. */
         virtual QString
@@ -74,9 +79,16 @@ namespace Orm::Query::Grammars
         /*! Compile the random statement into SQL. */
         virtual QString compileRandom(const QString &seed) const;
 
+        /*! Compile the explain statement for the given query into SQL. */
+        virtual QString compileExplain(const QString &query) const;
+
         /*! Get the grammar specific operators. */
         virtual const std::unordered_set<QString> &getOperators() const;
 
+        /*! Get the maximum number of placeholders in one statement, multi-row inserts
+            have to be chunked to stay under this limit. */
+        virtual qsizetype getMaxPlaceholders() const noexcept;
+
     protected:
         /*! The select component compile method and whether the component was set. */
         struct SelectComponentValue
@@ -106,6 +118,8 @@ namespace Orm::Query::Grammars
         /*! Compile the components necessary for a select clause. */
         QStringList compileComponents(const QueryBuilder &query) const;
 
+        /*! Compile the common table expressions (with clause). */
+        QString compileExpressions(const QueryBuilder &query) const;
         /*! Compile an aggregated select clause. */
         QString compileAggregate(const QueryBuilder &query) const;
         /*! Compile the "select *" portion of the query. */
@@ -138,7 +152,9 @@ namespace Orm::Query::Grammars
         /*! Compile the "order by" portions of the query. */
         QString compileOrders(const QueryBuilder &query) const;
         /*! Compile the query orders to the vector. */
-        QStringList compileOrdersToVector(const QueryBuilder &query) const;
+        inline QStringList compileOrdersToVector(const QueryBuilder &query) const;
+        /*! Compile the given orders to the vector. */
+        QStringList compileOrdersToVector(const QVector<OrderByItem> &orders) const;
         /*! Compile the "limit" portions of the query. */
         QString compileLimit(const QueryBuilder &query) const;
         /*! Compile the "offset" portions of the query. */
@@ -147,6 +163,15 @@ namespace Orm::Query::Grammars
         /*! Compile the lock into SQL. */
         virtual QString compileLock(const QueryBuilder &query) const;
 
+        /*! Compile the "union" queries attached to the main query. */
+        QString compileUnions(const QueryBuilder &query) const;
+        /*! Compile a single union statement. */
+        QString compileUnion(const UnionItem &union_) const;
+        /*! Wrap the union subquery in parentheses. */
+        virtual QString wrapUnion(const QString &sql) const;
+        /*! Compile a union aggregate query into SQL. */
+        QString compileUnionAggregate(const QueryBuilder &query) const;
+
         /*! Compile a basic where clause. */
         QString whereBasic(const WhereConditionItem &where) const;
         /*! Compile a nested where clause. */
@@ -239,6 +264,13 @@ namespace Orm::Query::Grammars
         return compileInsert(query, values);
     }
 
+    /* protected */
+
+    QStringList Grammar::compileOrdersToVector(const QueryBuilder &query) const
+    {
+        return compileOrdersToVector(query.getOrders());
+    }
+
 } // namespace Orm::Query::Grammars
 
 TINYORM_END_COMMON_NAMESPACE
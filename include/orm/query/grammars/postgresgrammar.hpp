@@ -51,6 +51,9 @@ namespace Orm::Query::Grammars
         /*! Compile the lock into SQL. */
         QString compileLock(const QueryBuilder &query) const override;
 
+        /*! Compile the explain statement for the given query into SQL. */
+        QString compileExplain(const QString &query) const override;
+
         /*! Get the grammar specific operators. */
         const std::unordered_set<QString> &getOperators() const override;
 
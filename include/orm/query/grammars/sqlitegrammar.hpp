@@ -47,9 +47,16 @@ namespace Orm::Query::Grammars
         /*! Compile the lock into SQL. */
         QString compileLock(const QueryBuilder &query) const override;
 
+        /*! Compile the explain statement for the given query into SQL. */
+        QString compileExplain(const QString &query) const override;
+
         /*! Get the grammar specific operators. */
         const std::unordered_set<QString> &getOperators() const override;
 
+        /*! Get the maximum number of placeholders in one statement, multi-row inserts
+            have to be chunked to stay under this limit. */
+        qsizetype getMaxPlaceholders() const noexcept override;
+
     protected:
         /*! Map the ComponentType to a Grammar::compileXx() methods. */
         const QVector<SelectComponentValue> &getCompileMap() const override;
@@ -76,6 +83,10 @@ namespace Orm::Query::Grammars
         /*! Compile the columns for an update statement. */
         QString compileUpdateColumns(const QVector<UpdateItem> &values) const override;
 
+        /*! Wrap the union subquery in the select statement, SQLite doesn't support
+            the parenthesized select statements. */
+        QString wrapUnion(const QString &sql) const override;
+
     private:
         /*! Compile an update statement with joins or limit into SQL. */
         QString compileUpdateWithJoinsOrLimit(QueryBuilder &query,
@@ -5,8 +5,12 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <QFuture>
+#include <QtSql/QSqlRecord>
+
 #include "orm/query/concerns/buildsqueries.hpp"
 #include "orm/query/grammars/grammar.hpp"
+#include "orm/types/batchstatement.hpp"
 #include "orm/utils/query.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -110,6 +114,17 @@ namespace Orm::Query
         /*! Get the SQL representation of the query. */
         QString toSql();
 
+        /* Compiled statements for the DatabaseConnection::batch() */
+        /*! Compile an insert statement without executing it (multi-rows insert),
+            returns an empty statement for empty values. */
+        BatchStatement toInsertStatement(const QVector<QVariantMap> &values) const;
+        /*! Compile an insert statement without executing it. */
+        BatchStatement toInsertStatement(const QVariantMap &values) const;
+        /*! Compile an update statement without executing it. */
+        BatchStatement toUpdateStatement(const QVector<UpdateItem> &values);
+        /*! Compile a delete statement without executing it. */
+        BatchStatement toDeleteStatement();
+
         /* Insert, Update, Delete */
         /*! Insert new records into the database (multi-rows insert). */
         std::optional<SqlQuery>
@@ -123,6 +138,12 @@ namespace Orm::Query
 
         /*! Insert a new record and get the value of the primary key. */
         quint64 insertGetId(const QVariantMap &values, const QString &sequence = "");
+        /*! Insert new records and get the values of their primary keys in the insertion
+            order, matched on the given unique key (insert ... returning, PostgreSQL
+            and SQLite >=3.35 only). */
+        QVector<quint64>
+        insertGetIds(const QVector<QVariantMap> &values, const QString &uniqueKey,
+                     const QString &sequence = "");
 
         /*! Insert new records into the database while ignoring errors. */
         std::tuple<int, std::optional<QSqlQuery>>
@@ -165,6 +186,32 @@ namespace Orm::Query
         /*! Run a truncate statement on the table. */
         void truncate();
 
+        /* Async queries */
+        /*! Execute the query as a "select" statement on the connection's worker
+            thread. */
+        QFuture<QVector<QSqlRecord>>
+        getAsync(const QVector<Column> &columns = {ASTERISK}) const;
+        /*! Execute the query and get the first result on the connection's worker
+            thread (the empty record if nothing was found). */
+        QFuture<QSqlRecord> firstAsync(const QVector<Column> &columns = {ASTERISK}) const;
+
+        /*! Insert new records on the connection's worker thread and get the number
+            of rows affected. */
+        QFuture<int> insertAsync(const QVector<QVariantMap> &values) const;
+        /*! Insert a new record on the connection's worker thread and get the number
+            of rows affected. */
+        QFuture<int> insertAsync(const QVariantMap &values) const;
+        /*! Insert a new record on the connection's worker thread and get the value
+            of the primary key. */
+        QFuture<quint64>
+        insertGetIdAsync(const QVariantMap &values, const QString &sequence = "") const;
+        /*! Update records on the connection's worker thread and get the number
+            of rows affected. */
+        QFuture<int> updateAsync(const QVector<UpdateItem> &values) const;
+        /*! Delete records on the connection's worker thread and get the number
+            of rows affected. */
+        QFuture<int> removeAsync() const;
+
         /* Select */
         /*! Retrieve the "count" result of the query. */
         inline quint64 count(const QVector<Column> &columns = {ASTERISK}) const;
@@ -256,6 +303,30 @@ namespace Orm::Query
         Builder &fromRaw(const QString &expression,
                          const QVector<QVariant> &bindings = {});
 
+        /* Common table expressions */
+        /*! Add a common table expression (with clause) to the query. */
+        template<SubQuery T>
+        Builder &withExpression(const QString &name, T &&query,
+                                const QStringList &columns = {},
+                                bool recursive = false);
+        /*! Add a recursive common table expression (with recursive clause) to
+            the query. */
+        template<SubQuery T>
+        inline Builder &withRecursiveExpression(const QString &name, T &&query,
+                                                const QStringList &columns = {});
+
+        /* Unions */
+        /*! Add a union statement to the query. */
+        template<Queryable T>
+        Builder &union_(T &&query, bool all = false);
+        /*! Add a union statement to the query. */
+        Builder &union_(const std::shared_ptr<Builder> &query, bool all = false);
+        /*! Add a union all statement to the query. */
+        template<Queryable T>
+        inline Builder &unionAll(T &&query);
+        /*! Add a union all statement to the query. */
+        inline Builder &unionAll(const std::shared_ptr<Builder> &query);
+
         /* Joins */
         /*! Add a join clause to the query. */
         template<JoinTable T>
@@ -715,6 +786,16 @@ namespace Orm::Query
         /*! Lock the selected rows in the table. */
         Builder &lock(QString &&value);
 
+        /* Query timeout */
+        /*! Set the statement timeout in milliseconds for the query (0 for no timeout),
+            the query throws the QueryTimeoutError if the timeout expires. */
+        Builder &timeout(int milliseconds);
+
+        /* Query cache */
+        /*! Cache the query result for the given number of seconds, the result is
+            invalidated when the connection writes to any table the query reads. */
+        Builder &remember(int seconds);
+
         /* Debugging */
         /*! Dump the current SQL and bindings. */
         void dump(bool replaceBindings = true, bool simpleBindings = false);
@@ -736,7 +817,7 @@ namespace Orm::Query
 
         /*! Get the current query value bindings as flattened QVector. */
         QVector<QVariant> getBindings() const;
-        /*! Get the raw map of bindings. */
+        /*! Get the raw bindings divided by the binding type. */
         inline const BindingsMap &getRawBindings() const noexcept;
         /*! Add a binding to the query. */
         Builder &addBinding(const QVariant &binding,
@@ -754,8 +835,13 @@ namespace Orm::Query
         Builder &setBindings(QVector<QVariant> &&bindings,
                              BindingType type = BindingType::WHERE);
 
+        /*! Get the common table expressions for the query. */
+        inline const QVector<CommonTableExpressionItem> &
+        getExpressions() const noexcept;
         /*! Get an aggregate function and column to be run. */
         inline const std::optional<AggregateItem> &getAggregate() const noexcept;
+        /*! Remove the aggregate function and column to be run. */
+        inline Builder &clearAggregate() noexcept;
         /*! Check if the query returns distinct results. */
         inline const std::variant<bool, QStringList> &getDistinct() const noexcept;
         /*! Check if the query returns distinct results. */
@@ -787,9 +873,21 @@ namespace Orm::Query
         inline qint64 getLimit() const noexcept;
         /*! Get the number of records to skip. */
         inline qint64 getOffset() const noexcept;
+        /*! Get the query union statements. */
+        inline const QVector<UnionItem> &getUnions() const noexcept;
+        /*! Get the orderings for the union query. */
+        inline const QVector<OrderByItem> &getUnionOrders() const noexcept;
+        /*! Get the maximum number of records to return for the union query. */
+        inline qint64 getUnionLimit() const noexcept;
+        /*! Get the number of records to skip for the union query. */
+        inline qint64 getUnionOffset() const noexcept;
         /*! Get the row locking. */
         inline const std::variant<std::monostate, bool, QString> &
         getLock() const noexcept;
+        /*! Get the statement timeout in milliseconds for the query. */
+        inline std::optional<int> getTimeout() const noexcept;
+        /*! Get the number of seconds the query result is cached for. */
+        inline std::optional<int> getRemember() const noexcept;
 
         /* Other methods */
         /*! Get a new instance of the query builder. */
@@ -909,6 +1007,14 @@ namespace Orm::Query
     private:
         /*! Run the query as a "select" statement against the connection. */
         SqlQuery runSelect();
+        /*! Get the tables read by the query used to invalidate the query cache,
+            returns an empty list if they can't be detected. */
+        QStringList tablesForQueryCache() const;
+
+        /*! Invoke the callback with a copy of this query on the connection's worker
+            thread. */
+        template<typename F>
+        auto runAsync(F &&callback) const;
 
         /*! Set the table which the query is targeting. */
         inline Builder &setFrom(const FromClause &from);
@@ -935,13 +1041,22 @@ namespace Orm::Query
                 const std::function<void(JoinClause &)> &callback,
                 const QString &type);
 
+        /*! Add a union statement to the query, common code. */
+        Builder &unionInternal(std::shared_ptr<Builder> &&query, bool all);
+
         /*! Add a basic where clause to the query, common code. */
         Builder &whereInternal(
                 const Column &column, const QString &comparison, QVariant value,
                 const QString &condition, WhereType type = WhereType::BASIC);
 
-        /*! Throw exception when m_bindings doesn't contain a passed type. */
+        /*! Throw exception when a passed type isn't the valid binding type. */
         void checkBindingType(BindingType type) const;
+        /*! Throw exception if the query has common table expressions, they are
+            supported for the select queries only. */
+        void throwIfHasExpressions(const QString &method) const;
+        /*! Throw exception if the statement timeout is set for the update or delete
+            query and the database server doesn't support it (MySQL). */
+        void throwIfWriteTimeoutUnsupported(const QString &method) const;
 
         /*! All of the available clause operators. */
         static const std::unordered_set<QString> &getOperators();
@@ -951,20 +1066,11 @@ namespace Orm::Query
         /*! The database query grammar instance. */
         std::shared_ptr<QueryGrammar> m_grammar;
 
-        /*! The current query value bindings.
-            Order is crucial here because of that QMap with an enum struct is used. */
-        BindingsMap m_bindings {
-            {BindingType::SELECT,     {}},
-            {BindingType::FROM,       {}},
-            {BindingType::JOIN,       {}},
-            {BindingType::WHERE,      {}},
-            {BindingType::GROUPBY,    {}},
-            {BindingType::HAVING,     {}},
-            {BindingType::ORDER,      {}},
-            {BindingType::UNION,      {}},
-            {BindingType::UNIONORDER, {}},
-        };
+        /*! The current query value bindings, ordered by the binding type. */
+        BindingsMap m_bindings {};
 
+        /*! The common table expressions for the query. */
+        QVector<CommonTableExpressionItem> m_expressions {};
         /*! An aggregate function and column to be run. */
         std::optional<AggregateItem> m_aggregate = std::nullopt;
         /*! Indicates if the query returns distinct results. */
@@ -987,8 +1093,20 @@ namespace Orm::Query
         qint64 m_limit = -1;
         /*! The number of records to skip. */
         qint64 m_offset = -1;
+        /*! The query union statements. */
+        QVector<UnionItem> m_unions {};
+        /*! The orderings for the union query. */
+        QVector<OrderByItem> m_unionOrders {};
+        /*! The maximum number of records to return for the union query. */
+        qint64 m_unionLimit = -1;
+        /*! The number of records to skip for the union query. */
+        qint64 m_unionOffset = -1;
         /*! Indicates whether row locking is being used. */
         std::variant<std::monostate, bool, QString> m_lock {};
+        /*! The statement timeout in milliseconds (overrides the connection's default). */
+        std::optional<int> m_timeout = std::nullopt;
+        /*! The number of seconds the query result is cached for. */
+        std::optional<int> m_remember = std::nullopt;
     };
 
     /* public */
@@ -1182,6 +1300,60 @@ namespace Orm::Query
                        bindings);
     }
 
+    /* Common table expressions */
+
+    template<SubQuery T>
+    Builder &
+    Builder::withExpression(const QString &name, T &&query, const QStringList &columns,
+                            const bool recursive)
+    {
+        auto [queryString, bindings] = createSub(std::forward<T>(query));
+
+        m_expressions.append({name, std::move(queryString), columns, recursive});
+
+        addBinding(std::move(bindings), BindingType::EXPRESSIONS);
+
+        return *this;
+    }
+
+    template<SubQuery T>
+    Builder &
+    Builder::withRecursiveExpression(const QString &name, T &&query,
+                                     const QStringList &columns)
+    {
+        return withExpression(name, std::forward<T>(query), columns, true);
+    }
+
+    /* Unions */
+
+    template<Queryable T>
+    Builder &Builder::union_(T &&query, const bool all)
+    {
+        if constexpr (std::invocable<T, Builder &>) {
+            // Ownership of the std::shared_ptr<QueryBuilder>
+            auto unionQuery = forSubQuery();
+
+            std::invoke(query, *unionQuery);
+
+            return unionInternal(std::move(unionQuery), all);
+        }
+
+        // For the QueryBuilder &, the union query is a copy as its bindings are copied
+        else
+            return unionInternal(std::make_shared<Builder>(query), all);
+    }
+
+    template<Queryable T>
+    Builder &Builder::unionAll(T &&query)
+    {
+        return union_(std::forward<T>(query), true);
+    }
+
+    Builder &Builder::unionAll(const std::shared_ptr<Builder> &query)
+    {
+        return union_(query, true);
+    }
+
     /* Joins */
 
     template<JoinTable T>
@@ -1673,11 +1845,24 @@ namespace Orm::Query
         return m_bindings;
     }
 
+    const QVector<CommonTableExpressionItem> &
+    Builder::getExpressions() const noexcept
+    {
+        return m_expressions;
+    }
+
     const std::optional<AggregateItem> &Builder::getAggregate() const noexcept
     {
         return m_aggregate;
     }
 
+    Builder &Builder::clearAggregate() noexcept
+    {
+        m_aggregate.reset();
+
+        return *this;
+    }
+
     const std::variant<bool, QStringList> &Builder::getDistinct() const noexcept
     {
         return m_distinct;
@@ -1764,12 +1949,44 @@ namespace Orm::Query
         return m_offset;
     }
 
+    const QVector<UnionItem> &
+    Builder::getUnions() const noexcept
+    {
+        return m_unions;
+    }
+
+    const QVector<OrderByItem> &
+    Builder::getUnionOrders() const noexcept
+    {
+        return m_unionOrders;
+    }
+
+    qint64 Builder::getUnionLimit() const noexcept
+    {
+        return m_unionLimit;
+    }
+
+    qint64 Builder::getUnionOffset() const noexcept
+    {
+        return m_unionOffset;
+    }
+
     const std::variant<std::monostate, bool, QString> &
     Builder::getLock() const noexcept
     {
         return m_lock;
     }
 
+    std::optional<int> Builder::getTimeout() const noexcept
+    {
+        return m_timeout;
+    }
+
+    std::optional<int> Builder::getRemember() const noexcept
+    {
+        return m_remember;
+    }
+
     Builder Builder::clone() const
     {
         return *this;
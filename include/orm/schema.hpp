@@ -36,6 +36,14 @@ namespace Orm
         static std::optional<SqlQuery>
         dropDatabaseIfExists(const QString &name, const QString &connection = "");
 
+        /*! Create a snapshot of the current database (replaces an existing snapshot). */
+        static void createSnapshot(const QString &name, const QString &connection = "");
+        /*! Restore the current database from the given snapshot. */
+        static void restoreSnapshot(const QString &name, const QString &connection = "");
+        /*! Drop the given database snapshot if the snapshot exists. */
+        static void dropSnapshotIfExists(const QString &name,
+                                         const QString &connection = "");
+
         /*! Create a new table on the schema. */
         static void create(const QString &table,
                            const std::function<void(Blueprint &)> &callback,
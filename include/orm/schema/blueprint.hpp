@@ -189,6 +189,35 @@ namespace Grammars
         /*! Indicates that the given indexes should be renamed. */
         const RenameCommand &renameIndex(const QString &from, const QString &to);
 
+        /*! Validate the not valid foreign key by the given column names (PostgreSQL). */
+        const IndexCommand &validateForeign(const QVector<QString> &columns);
+        /*! Validate the not valid foreign key by the given index name (PostgreSQL). */
+        template<typename = void>
+        const IndexCommand &validateForeign(const QString &indexName);
+
+        /*! Partition the table by a range of the given columns (MySQL/PostgreSQL). */
+        const PartitionByCommand &partitionByRange(const QVector<QString> &columns);
+        /*! Partition the table by values of the given columns (MySQL/PostgreSQL). */
+        const PartitionByCommand &partitionByList(const QVector<QString> &columns);
+        /*! Partition the table by a hash of the given columns (MySQL/PostgreSQL). */
+        const PartitionByCommand &partitionByHash(const QVector<QString> &columns,
+                                                  int partitions = 0);
+
+        /*! Add a range partition with the given bounds (MySQL/PostgreSQL). */
+        const PartitionCommand &
+        rangePartition(const QString &partition, const QVariant &from,
+                       const QVariant &to);
+        /*! Add a list partition with the given values (MySQL/PostgreSQL). */
+        const PartitionCommand &
+        listPartition(const QString &partition, const QVector<QVariant> &values);
+        /*! Add a hash partition (MySQL/PostgreSQL). */
+        const PartitionCommand &
+        hashPartition(const QString &partition, int modulus = 0, int remainder = 0);
+        /*! Detach the given partition from the table (PostgreSQL). */
+        const PartitionCommand &detachPartition(const QString &partition);
+        /*! Drop the given partition (MySQL/PostgreSQL). */
+        const PartitionCommand &dropPartition(const QString &partition);
+
         /*! Create a new auto-incrementing big integer (8-byte) column on the table. */
         inline ColumnDefinitionReference<> id(const QString &column = Orm::Constants::ID);
 
@@ -428,10 +457,15 @@ namespace Grammars
         getCommands() const noexcept;
         /*! Determine whether the blueprint describes temporary table. */
         inline bool isTemporary() const noexcept;
+        /*! Determine whether the indexes are created and dropped without blocking. */
+        inline bool isOnline() const noexcept;
 
         /* Others */
         /*! Indicates that the table needs to be temporary. */
         inline void temporary() noexcept;
+        /*! Indicates that indexes should be created and dropped without blocking
+            writes (MySQL/PostgreSQL). */
+        inline void online() noexcept;
 
         /*! Set the default string length for migrations. */
         static void defaultStringLength(int length) noexcept;
@@ -467,6 +501,10 @@ namespace Grammars
         /*! Add the fluent commands specified on any columns. */
         void addFluentCommands(const SchemaGrammar &grammar);
 
+        /*! Throw if any command can't be executed inside the current transaction. */
+        void throwIfCantRunInTransaction(const DatabaseConnection &connection,
+                                         const SchemaGrammar &grammar) const;
+
         /*! Add a new index command to the blueprint. */
         IndexDefinitionReference
         indexCommand(const QString &type, const QVector<QString> &columns,
@@ -496,6 +534,8 @@ namespace Grammars
 
         /*! Whether to make the table temporary. */
         bool m_temporary = false;
+        /*! Whether to create and drop indexes without blocking writes. */
+        bool m_online = false;
         /*! The column to add new columns after. */
         QString m_after {};
     };
@@ -634,6 +674,12 @@ namespace Grammars
         return dropIndexCommand(DropForeign, indexName);
     }
 
+    template<typename>
+    const IndexCommand &Blueprint::validateForeign(const QString &indexName)
+    {
+        return dropIndexCommand(ValidateForeign, indexName);
+    }
+
     ColumnDefinitionReference<> Blueprint::id(const QString &column)
     {
         return bigIncrements(column);
@@ -755,11 +801,21 @@ namespace Grammars
         return m_temporary;
     }
 
+    bool Blueprint::isOnline() const noexcept
+    {
+        return m_online;
+    }
+
     void Blueprint::temporary() noexcept
     {
         m_temporary = true;
     }
 
+    void Blueprint::online() noexcept
+    {
+        m_online = true;
+    }
+
     /* protected */
 
     template<CommandDefinitionConcept T>
@@ -73,6 +73,12 @@ namespace Orm::SchemaNs
         QString algorithm {};
         /*! Dictionary for the to_tsvector function for fulltext search (PostgreSQL). */
         QString language {};
+        /*! Create or drop the index without blocking writes (MySQL/PostgreSQL). */
+        bool online = false;
+        /*! Non-key columns to include in the index (PostgreSQL). */
+        QVector<QString> includes {};
+        /*! Raw predicate for the partial index (PostgreSQL). */
+        QString where {};
     };
 
     /*! Foreign key constraints command. */
@@ -143,6 +149,42 @@ namespace Orm::SchemaNs
         QString comment;
     };
 
+    /*! Table partitioning command (MySQL/PostgreSQL). */
+    class PartitionByCommand : public CommandDefinition
+    {
+    public:
+        /*! Command name. */
+        QString name {};
+        /*! Partitioning method (range, list, or hash). */
+        QString method;
+        /*! Columns of the partition key. */
+        QVector<QString> columns;
+        /*! Number of hash partitions to create together with the table. */
+        int partitions = 0;
+    };
+
+    /*! Table partition command (MySQL/PostgreSQL). */
+    class PartitionCommand : public CommandDefinition
+    {
+    public:
+        /*! Command name. */
+        QString name {};
+        /*! Partition name (the partition table name on PostgreSQL). */
+        QString partition;
+        /*! Partitioning method (range, list, or hash). */
+        QString method {};
+        /*! Lower bound of the range partition (PostgreSQL), null for the minvalue. */
+        QVariant from {};
+        /*! Upper bound of the range partition, null for the maxvalue. */
+        QVariant to {};
+        /*! Values of the list partition. */
+        QVector<QVariant> values {};
+        /*! Modulus of the hash partition (PostgreSQL). */
+        int modulus = 0;
+        /*! Remainder of the hash partition (PostgreSQL). */
+        int remainder = 0;
+    };
+
     /*! Database column definition. */
     class ColumnDefinition
     {
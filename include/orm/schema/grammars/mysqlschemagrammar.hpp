@@ -13,6 +13,8 @@ namespace Orm::SchemaNs
 {
     class AutoIncrementStartingValueCommand;
     class DropColumnsCommand;
+    class PartitionByCommand;
+    class PartitionCommand;
     class RenameCommand;
 
 namespace Grammars
@@ -126,6 +128,23 @@ namespace Grammars
         QVector<QString> compileRenameIndex(const Blueprint &blueprint,
                                             const RenameCommand &command) const;
 
+        /*! Compile a validate foreign key command. */
+        inline QVector<QString> compileValidateForeign(const Blueprint &blueprint,
+                                                       const IndexCommand &command) const;
+
+        /*! Compile a table partitioning command. */
+        QVector<QString> compilePartitionBy(const Blueprint &blueprint,
+                                            const PartitionByCommand &command) const;
+        /*! Compile an add partition command. */
+        QVector<QString> compileAddPartition(const Blueprint &blueprint,
+                                             const PartitionCommand &command) const;
+        /*! Compile a detach partition command. */
+        QVector<QString> compileDetachPartition(const Blueprint &blueprint,
+                                                const PartitionCommand &command) const;
+        /*! Compile a drop partition command. */
+        QVector<QString> compileDropPartition(const Blueprint &blueprint,
+                                              const PartitionCommand &command) const;
+
         /*! Compile a table comment command. */
         QVector<QString>
         compileTableComment(const Blueprint &blueprint,
@@ -166,7 +185,20 @@ namespace Grammars
 
         /*! Compile an index creation command. */
         QString compileKey(const Blueprint &blueprint, const IndexCommand &command,
-                           const QString &type) const;
+                           const QString &type, const QString &lock = "none") const;
+        /*! Get the index key columns, the include columns are appended to the key. */
+        static QVector<Column> getKeyColumns(const IndexCommand &command,
+                                             const QString &type);
+        /*! Compile the algorithm and lock clauses for the online index command. */
+        static QString compileOnline(const Blueprint &blueprint,
+                                     const IndexCommand &command,
+                                     const QString &lock = "none");
+
+        /*! Compile the partition by clause with partitions defined on the blueprint. */
+        QString compilePartitionByClause(const Blueprint &blueprint,
+                                         const PartitionByCommand &command) const;
+        /*! Compile the partition definition. */
+        QString compilePartitionDefinition(const PartitionCommand &command) const;
 
         /*! Wrap a single string in keyword identifiers. */
         QString wrapValue(QString value) const override;
@@ -325,6 +357,14 @@ namespace Grammars
         return compileDropIndex(blueprint, command);
     }
 
+    QVector<QString>
+    MySqlSchemaGrammar::compileValidateForeign(
+                const Blueprint &/*unused*/, const IndexCommand &/*unused*/) const
+    {
+        // MySQL always validates the foreign key when it's added, nothing to do
+        return {};
+    }
+
 } // namespace Grammars
 } // namespace Orm::SchemaNs
 
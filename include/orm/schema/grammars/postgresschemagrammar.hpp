@@ -15,6 +15,8 @@ namespace Orm::SchemaNs
     class AutoIncrementStartingValueCommand;
     class CommentCommand;
     class DropColumnsCommand;
+    class PartitionByCommand;
+    class PartitionCommand;
     class RenameCommand;
 
 namespace Grammars
@@ -138,6 +140,23 @@ namespace Grammars
         QVector<QString> compileRenameIndex(const Blueprint &blueprint,
                                             const RenameCommand &command) const;
 
+        /*! Compile a validate foreign key command. */
+        QVector<QString> compileValidateForeign(const Blueprint &blueprint,
+                                                const IndexCommand &command) const;
+
+        /*! Compile a table partitioning command. */
+        QVector<QString> compilePartitionBy(const Blueprint &blueprint,
+                                            const PartitionByCommand &command) const;
+        /*! Compile an add partition command. */
+        QVector<QString> compileAddPartition(const Blueprint &blueprint,
+                                             const PartitionCommand &command) const;
+        /*! Compile a detach partition command. */
+        QVector<QString> compileDetachPartition(const Blueprint &blueprint,
+                                                const PartitionCommand &command) const;
+        /*! Compile a drop partition command. */
+        QVector<QString> compileDropPartition(const Blueprint &blueprint,
+                                              const PartitionCommand &command) const;
+
         /*! Compile a comment command. */
         QVector<QString> compileComment(const Blueprint &blueprint,
                                         const CommentCommand &command) const;
@@ -156,6 +175,11 @@ namespace Grammars
         /*! Get the fluent commands for the grammar. */
         const std::vector<FluentCommandItem> &getFluentCommands() const override;
 
+        /*! Determine whether the given command can't be executed inside
+            a transaction block. */
+        bool isNonTransactionalCommand(const CommandDefinition &command,
+                                       const Blueprint &blueprint) const override;
+
     protected:
         /*! Add the column modifiers to the definition. */
         QString addModifiers(QString &&sql,
@@ -172,6 +196,17 @@ namespace Grammars
         /*! Compile a drop unique key command. */
         QVector<QString> compileDropConstraint(const Blueprint &blueprint,
                                                const IndexCommand &command) const;
+        /*! Compile the concurrently keyword for the online index command. */
+        static QString compileConcurrently(const Blueprint &blueprint,
+                                           const IndexCommand &command);
+        /*! Compile the include columns and the where predicate of the index. */
+        QString compileIndexOptions(const IndexCommand &command) const;
+
+        /*! Compile the create table statement for the partition of the table. */
+        QString compilePartitionOf(const Blueprint &blueprint, const QString &partition,
+                                   const QString &bounds) const;
+        /*! Compile the partition bounds clause. */
+        QString compilePartitionBounds(const PartitionCommand &command) const;
 
         /*! Escape special characters (used by the defaultValue and comment). */
         QString escapeString(QString value) const override;
@@ -328,6 +363,10 @@ namespace Grammars
     PostgresSchemaGrammar::compileDropUnique(const Blueprint &blueprint,
                                              const IndexCommand &command) const
     {
+        // The online unique index is created as the unique index, not as the constraint
+        if (isOnlineIndex(blueprint, command))
+            return compileDropIndex(blueprint, command);
+
         return compileDropConstraint(blueprint, command);
     }
 
@@ -113,6 +113,12 @@ namespace Grammars
                             const DatabaseConnection &connection,
                             const Blueprint &blueprint) const = 0;
 
+        /*! Determine whether the given command can't be executed inside
+            a transaction block. */
+        virtual bool
+        isNonTransactionalCommand(const CommandDefinition &command,
+                                  const Blueprint &blueprint) const;
+
         /*! Fluent command item. */
         struct FluentCommandItem
         {
@@ -132,6 +138,17 @@ namespace Grammars
         /*! Determine whether should add an auto-incrementing fluent command. */
         static bool
         shouldAddAutoIncrementStartingValue(const ColumnDefinition &column) noexcept;
+        /*! Get the first command with a given name if it exists on the blueprint. */
+        static std::shared_ptr<CommandDefinition>
+        getCommandByName(const Blueprint &blueprint, const QString &name);
+        /*! Get all of the commands with a given name. */
+        static QVector<std::shared_ptr<CommandDefinition>>
+        getCommandsByName(const Blueprint &blueprint, const QString &name);
+
+        /*! Determine whether the index should be created or dropped without blocking
+            writes (the table is not being created). */
+        static bool isOnlineIndex(const Blueprint &blueprint,
+                                  const IndexCommand &command);
 
         /*! Get the SQL for the column data type. */
         virtual QString getType(ColumnDefinition &column) const = 0;
@@ -145,6 +162,9 @@ namespace Grammars
         virtual QString
         addModifiers(QString &&sql, const ColumnDefinition &column) const = 0;
 
+        /*! Format the partition bound value, numbers are not quoted. */
+        QString getPartitionValue(const QVariant &value) const;
+
         /*! Create the column definition for a generated, computed column type. */
         virtual QString typeComputed(const ColumnDefinition &column) const;
     };
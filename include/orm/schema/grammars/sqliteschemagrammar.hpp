@@ -129,13 +129,9 @@ namespace Grammars
         QString getForeignKey(const ForeignKeyCommand &foreign) const;
         /*! Get the primary key syntax for a table creation statement. */
         QString addPrimaryKeys(const Blueprint &blueprint) const;
-
-        /*! Get the primary key command if it exists on the blueprint. */
-        static std::shared_ptr<CommandDefinition>
-        getCommandByName(const Blueprint &blueprint, const QString &name);
-        /*! Get all of the commands with a given name. */
-        static QVector<std::shared_ptr<CommandDefinition>>
-        getCommandsByName(const Blueprint &blueprint, const QString &name);
+        /*! Compile the where predicate of the partial index (include columns are
+            not supported). */
+        static QString compileIndexOptions(const IndexCommand &command);
 
         /* Others */
         /*! Add the column modifiers to the definition. */
@@ -49,6 +49,12 @@ namespace Orm::SchemaNs
         IndexDefinitionReference &algorithm(const QString &algorithm);
         /*! Specify a language for the full text index (PostgreSQL). */
         IndexDefinitionReference &language(const QString &language);
+        /*! Create the index without blocking writes (MySQL/PostgreSQL). */
+        IndexDefinitionReference &online(bool value = true);
+        /*! Include the given non-key columns in the index (PostgreSQL). */
+        IndexDefinitionReference &includes(const QVector<QString> &columns);
+        /*! Create the partial index for rows matching the raw predicate (PostgreSQL). */
+        IndexDefinitionReference &where(const QString &predicate);
 
     private:
         /*! Reference to an index command definition. */
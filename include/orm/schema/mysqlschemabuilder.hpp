@@ -31,6 +31,13 @@ namespace Orm::SchemaNs
         std::optional<SqlQuery>
         dropDatabaseIfExists(const QString &name) const override;
 
+        /*! Create a snapshot of the current database (replaces an existing snapshot). */
+        void createSnapshot(const QString &name) const override;
+        /*! Restore the current database from the given snapshot. */
+        void restoreSnapshot(const QString &name) const override;
+        /*! Drop the given database snapshot if the snapshot exists. */
+        void dropSnapshotIfExists(const QString &name) const override;
+
         /*! Drop all tables from the database. */
         void dropAllTables() const override;
         /*! Drop all views from the database. */
@@ -46,6 +53,21 @@ namespace Orm::SchemaNs
 
         /*! Determine if the given table exists. */
         bool hasTable(const QString &table) const override;
+
+    protected:
+        /*! Copy all tables (structure and data) from one database to another. */
+        void copyTables(const QString &from, const QString &to) const;
+        /*! Throw if the given snapshot database doesn't exist. */
+        void throwIfSnapshotMissing(const QString &snapshot) const;
+
+    private:
+        /*! Get the create table statement for the given table, qualified with
+            the target database. */
+        QString getCreateTableStatement(const QString &source, const QString &table,
+                                        const QString &target) const;
+        /*! Get the columns of the given table that can be inserted (not generated). */
+        QVector<QString> getInsertableColumns(const QString &database,
+                                              const QString &table) const;
     };
 
 } // namespace Orm::SchemaNs
@@ -39,6 +39,13 @@ namespace Grammars
         std::optional<SqlQuery>
         dropDatabaseIfExists(const QString &name) const override;
 
+        /*! Create a snapshot of the current database (replaces an existing snapshot). */
+        void createSnapshot(const QString &name) const override;
+        /*! Restore the current database from the given snapshot. */
+        void restoreSnapshot(const QString &name) const override;
+        /*! Drop the given database snapshot if the snapshot exists. */
+        void dropSnapshotIfExists(const QString &name) const override;
+
         /*! Drop all tables from the database. */
         void dropAllTables() const override;
         /*! Drop all views from the database. */
@@ -61,6 +68,15 @@ namespace Grammars
         std::tuple<QString, QString, QString>
         parseSchemaAndTable(const QString &reference) const;
 
+        /*! Execute the given statements on the maintenance 'postgres' database
+            (the current connection is disconnected, it reconnects lazily). */
+        void runOnMaintenanceDatabase(const QStringList &statements) const;
+        /*! Throw if the given snapshot database doesn't exist. */
+        void throwIfSnapshotMissing(const QString &snapshot) const;
+        /*! Compile the statement that terminates all other sessions connected to
+            the given database (worker threads, side connections, other threads). */
+        static QString compileTerminateSessions(const QString &database);
+
     private:
         /*! Drop a database name for the parseSchemaAndTable(). */
         static void dropDatabaseForParse(const QString &databaseConfig,
@@ -44,6 +44,13 @@ namespace Grammars
         virtual std::optional<SqlQuery>
         dropDatabaseIfExists(const QString &name) const;
 
+        /*! Create a snapshot of the current database (replaces an existing snapshot). */
+        virtual void createSnapshot(const QString &name) const;
+        /*! Restore the current database from the given snapshot. */
+        virtual void restoreSnapshot(const QString &name) const;
+        /*! Drop the given database snapshot if the snapshot exists. */
+        virtual void dropSnapshotIfExists(const QString &name) const;
+
         /*! Create a new table on the schema. */
         void create(const QString &table,
                     const std::function<void(Blueprint &)> &callback) const;
@@ -115,6 +122,9 @@ namespace Grammars
         /*! Execute the blueprint to build / modify the table. */
         void build(Blueprint &&blueprint) const;
 
+        /*! Get the database name for the given snapshot (MySQL and PostgreSQL). */
+        QString snapshotDatabaseName(const QString &name) const;
+
         /*! The database connection instance. */
         std::shared_ptr<DatabaseConnection> m_connection;
         /*! The schema grammar instance. */
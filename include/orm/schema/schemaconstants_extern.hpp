@@ -34,6 +34,7 @@ namespace Constants
     SHAREDLIB_EXPORT extern const QString DropSpatialIndex;
     SHAREDLIB_EXPORT extern const QString DropForeign;
     SHAREDLIB_EXPORT extern const QString RenameIndex;
+    SHAREDLIB_EXPORT extern const QString ValidateForeign;
 
     // PostgreSQL specific command
     SHAREDLIB_EXPORT extern const QString Comment;
@@ -41,6 +42,10 @@ namespace Constants
     // MySQL and PostgreSQL specific commands
     SHAREDLIB_EXPORT extern const QString AutoIncrementStartingValue;
     SHAREDLIB_EXPORT extern const QString TableComment;
+    SHAREDLIB_EXPORT extern const QString PartitionBy;
+    SHAREDLIB_EXPORT extern const QString AddPartition;
+    SHAREDLIB_EXPORT extern const QString DropPartition;
+    SHAREDLIB_EXPORT extern const QString DetachPartition;
 
     // Indexes
     SHAREDLIB_EXPORT extern const QString Primary;
@@ -55,6 +60,11 @@ namespace Constants
     SHAREDLIB_EXPORT extern const QString Restrict;
     SHAREDLIB_EXPORT extern const QString SetNull;
 
+    // Partitioning methods
+    SHAREDLIB_EXPORT extern const QString PartitionRange;
+    SHAREDLIB_EXPORT extern const QString PartitionList;
+    SHAREDLIB_EXPORT extern const QString PartitionHash;
+
     // Column types
     SHAREDLIB_EXPORT extern const QString integer_;
     SHAREDLIB_EXPORT extern const QString varchar_;
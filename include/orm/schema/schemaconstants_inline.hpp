@@ -33,6 +33,7 @@ namespace Constants
     inline const QString DropSpatialIndex = QStringLiteral("dropSpatialIndex");
     inline const QString DropForeign      = QStringLiteral("dropForeign");
     inline const QString RenameIndex      = QStringLiteral("renameIndex");
+    inline const QString ValidateForeign  = QStringLiteral("validateForeign");
 
     // PostgreSQL specific command
     inline const QString Comment          = QStringLiteral("comment");
@@ -41,6 +42,10 @@ namespace Constants
     inline const QString
     AutoIncrementStartingValue            = QStringLiteral("autoIncrementStartingValue");
     inline const QString TableComment     = QStringLiteral("tableComment");
+    inline const QString PartitionBy      = QStringLiteral("partitionBy");
+    inline const QString AddPartition     = QStringLiteral("addPartition");
+    inline const QString DropPartition    = QStringLiteral("dropPartition");
+    inline const QString DetachPartition  = QStringLiteral("detachPartition");
 
     // Indexes
     inline const QString Primary      = QStringLiteral("primary");
@@ -56,6 +61,11 @@ namespace Constants
     inline const QString Restrict = QStringLiteral("restrict");
     inline const QString SetNull  = QStringLiteral("set null");
 
+    // Partitioning methods
+    inline const QString PartitionRange = QStringLiteral("range");
+    inline const QString PartitionList  = QStringLiteral("list");
+    inline const QString PartitionHash  = QStringLiteral("hash");
+
     // Column types
     inline const QString integer_ = QStringLiteral("integer");
     inline const QString varchar_ = QStringLiteral("varchar");
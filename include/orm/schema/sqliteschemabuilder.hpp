@@ -5,6 +5,8 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <filesystem>
+
 #include "orm/schema/schemabuilder.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -31,6 +33,13 @@ namespace Orm::SchemaNs
         std::optional<SqlQuery>
         dropDatabaseIfExists(const QString &name) const override;
 
+        /*! Create a snapshot of the current database (replaces an existing snapshot). */
+        void createSnapshot(const QString &name) const override;
+        /*! Restore the current database from the given snapshot. */
+        void restoreSnapshot(const QString &name) const override;
+        /*! Drop the given database snapshot if the snapshot exists. */
+        void dropSnapshotIfExists(const QString &name) const override;
+
         /*! Drop all tables from the database. */
         void dropAllTables() const override;
         /*! Drop all views from the database. */
@@ -43,6 +52,18 @@ namespace Orm::SchemaNs
 
         /*! Empty the database file. */
         void refreshDatabaseFile() const;
+
+    protected:
+        /*! Get the snapshot file path for the given snapshot. */
+        std::filesystem::path snapshotPath(const QString &name) const;
+        /*! Restore the in-memory database from the given snapshot file. */
+        void restoreMemorySnapshot(const std::filesystem::path &snapshot) const;
+        /*! Get the snapshot table columns that can be inserted (not generated). */
+        QVector<QString> getSnapshotInsertableColumns(const QString &table) const;
+        /*! Remove the -wal, -shm, and -journal files of the given database file. */
+        static void removeSidecarFiles(const std::filesystem::path &database);
+        /*! Quote the given file path as the SQL string literal. */
+        static QString quotePath(const std::filesystem::path &path);
     };
 
 } // namespace Orm::SchemaNs
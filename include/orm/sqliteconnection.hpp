@@ -43,6 +43,10 @@ namespace Orm
         /*! Set return the QDateTime or QString (override the return_qdatetime). */
         SQLiteConnection &setReturnQDateTime(bool value);
 
+        /*! Determine whether the insert statement can return the inserted rows
+            (SQLite >=3.35). */
+        bool supportsInsertReturning() final;
+
     protected:
         /*! Get the default query grammar instance. */
         std::unique_ptr<QueryGrammar> getDefaultQueryGrammar() const final;
@@ -52,6 +56,9 @@ namespace Orm
         std::unique_ptr<SchemaBuilder> getDefaultSchemaBuilder() final;
         /*! Get the default post processor instance. */
         std::unique_ptr<QueryProcessor> getDefaultPostProcessor() const final;
+
+        /*! Determine whether the insert statement can return the inserted rows. */
+        std::optional<bool> m_supportsInsertReturning = std::nullopt;
     };
 
     /* public */
@@ -0,0 +1,62 @@
+#pragma once
+#ifndef ORM_SUPPORT_CACHEDSQLRESULT_HPP
+#define ORM_SUPPORT_CACHEDSQLRESULT_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QtSql/QSqlResult>
+
+#include "orm/macros/export.hpp"
+#include "orm/support/querycacheinterface.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Read-only QSqlResult serving the rows of a cached select query, it allows
+        to wrap the cached result in the QSqlQuery/SqlQuery. */
+    class SHAREDLIB_EXPORT CachedSqlResult final : public QSqlResult
+    {
+        Q_DISABLE_COPY(CachedSqlResult)
+
+    public:
+        /*! Constructor. */
+        CachedSqlResult(const QSqlDriver *driver, const QString &queryString,
+                        QueryCacheResult result);
+        /*! Virtual destructor. */
+        inline ~CachedSqlResult() final = default;
+
+    protected:
+        /*! Get the value of the given field in the current row. */
+        QVariant data(int index) final;
+        /*! Determine whether the given field in the current row is null. */
+        bool isNull(int index) final;
+        /*! The cached result can't be re-executed. */
+        bool reset(const QString &query) final;
+
+        /*! Position the result on the given row. */
+        bool fetch(int index) final;
+        /*! Position the result on the first row. */
+        bool fetchFirst() final;
+        /*! Position the result on the last row. */
+        bool fetchLast() final;
+
+        /*! Get the number of rows in the result. */
+        int size() final;
+        /*! Get the number of rows affected (always -1 for the select query). */
+        int numRowsAffected() final;
+        /*! Get the columns of the result. */
+        QSqlRecord record() const final;
+
+    private:
+        /*! The cached result. */
+        QueryCacheResult m_result;
+    };
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_CACHEDSQLRESULT_HPP
@@ -0,0 +1,118 @@
+#pragma once
+#ifndef ORM_SUPPORT_CONNECTIONWORKERS_HPP
+#define ORM_SUPPORT_CONNECTIONWORKERS_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QFuture>
+#include <QFutureInterface>
+
+#include <functional>
+#include <memory>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+class QThreadPool;
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+    class DatabaseConnection;
+
+namespace Support
+{
+
+    /*! Dedicated worker threads for database connections, used by async queries.
+        The QtSql connection can be used only from the thread that created it, so
+        every connection name has its own worker thread and all its async queries are
+        executed serially on this thread using its own thread-local connection. */
+    class SHAREDLIB_EXPORT ConnectionWorkers
+    {
+        Q_DISABLE_COPY(ConnectionWorkers)
+
+    public:
+        /*! Deleted default constructor, this is a pure library class. */
+        ConnectionWorkers() = delete;
+        /*! Deleted destructor. */
+        ~ConnectionWorkers() = delete;
+
+        /*! Invoke the callback with the given connection on its worker thread. */
+        template<typename F>
+        static QFuture<std::invoke_result_t<F, DatabaseConnection &>>
+        run(const QString &connection, F &&callback);
+
+        /*! Wait until all queued async queries are finished. */
+        static void waitForDone();
+
+        /*! Disconnect the worker thread's connection of the given name. */
+        static void disconnect(const QString &connection);
+        /*! Stop the worker thread of the given connection and remove its connections
+            (waits until its queued async queries are finished). */
+        static void remove(const QString &connection);
+        /*! Stop all worker threads and remove their connections. */
+        static void shutdown();
+
+    private:
+        /*! Get the thread pool with one dedicated thread for the given connection. */
+        static QThreadPool &worker(const QString &connection);
+        /*! Get the database connection for the current worker thread. */
+        static DatabaseConnection &connection(const QString &name);
+
+        /*! Report the currently handled exception to the future. */
+        static void reportException(QFutureInterfaceBase &promise);
+        /*! Queue the task on the worker thread of the given connection. */
+        static void start(const QString &connection, std::function<void()> &&task);
+
+        /*! Determine whether the current thread is a worker thread. */
+        static bool isWorkerThread() noexcept;
+        /*! Throw if the current thread is a worker thread. */
+        static void throwIfWorkerThread(const QString &connection);
+        /*! Remove the worker thread's connections and stop the given worker. */
+        static void stop(std::shared_ptr<QThreadPool> &&worker);
+    };
+
+    /* public */
+
+    template<typename F>
+    QFuture<std::invoke_result_t<F, DatabaseConnection &>>
+    ConnectionWorkers::run(const QString &connection, F &&callback)
+    {
+        using Result = std::invoke_result_t<F, DatabaseConnection &>;
+
+        QFutureInterface<Result> promise;
+        promise.reportStarted();
+
+        auto future = promise.future();
+
+        start(connection, [promise, connection,
+                           callback = std::forward<F>(callback)]() mutable
+        {
+            // The future was cancelled before the worker thread got to it
+            if (!promise.isCanceled())
+                try {
+                    if constexpr (std::is_void_v<Result>)
+                        std::invoke(callback, ConnectionWorkers::connection(connection));
+                    else
+                        promise.reportResult(
+                                std::invoke(callback,
+                                            ConnectionWorkers::connection(connection)));
+
+                } catch (...) {
+                    reportException(promise);
+                }
+
+            promise.reportFinished();
+        });
+
+        return future;
+    }
+
+} // namespace Support
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_CONNECTIONWORKERS_HPP
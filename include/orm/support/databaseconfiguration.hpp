@@ -7,6 +7,10 @@ TINY_SYSTEM_HEADER
 
 #include <QVariantHash>
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "orm/macros/commonnamespace.hpp"
@@ -17,7 +21,8 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 namespace Orm::Support
 {
 
-    /*! Database configuration class. */
+    /*! Database configuration class, the configurations map is shared by all threads,
+        readers obtain an immutable snapshot and writers publish a modified copy. */
     class DatabaseConfiguration
     {
         Q_DISABLE_COPY(DatabaseConfiguration)
@@ -25,6 +30,8 @@ namespace Orm::Support
     public:
         /*! Type used for Database Connections map. */
         using ConfigurationsType = std::unordered_map<QString, QVariantHash>;
+        /*! Type used for the read-only snapshot of the configurations map. */
+        using SnapshotType = std::shared_ptr<const ConfigurationsType>;
 
         /*! Default constructor. */
         inline DatabaseConfiguration() = default;
@@ -45,61 +52,80 @@ namespace Orm::Support
         inline static
         QString defaultSavepointNamespace = QStringLiteral("tinyorm_savepoint");
 
-        /*! Return a pointer to the database connection configurations map. */
-        inline ConfigurationsType *operator->() noexcept;
-        /*! Return a pointer to the database connection configurations map. */
-        inline const ConfigurationsType *operator->() const noexcept;
-        /*! Return a reference to the database connection configurations map. */
-        inline ConfigurationsType &operator*() noexcept;
-        /*! Return a reference to the database connection configurations map. */
-        inline const ConfigurationsType &operator*() const noexcept;
-        /*! Return a reference to the database connection configurations map. */
-        inline ConfigurationsType &get() noexcept;
-        /*! Return a reference to the database connection configurations map. */
-        inline const ConfigurationsType &get() const noexcept;
+        /*! Get the current read-only snapshot of the configurations map. */
+        inline SnapshotType snapshot() const;
+        /*! Return the current read-only snapshot of the configurations map. */
+        inline SnapshotType operator->() const;
+
+        /*! Copy the configurations map, modify it using the given callback, and
+            publish it as a new snapshot. */
+        template<typename Callback>
+        std::invoke_result_t<Callback, ConfigurationsType &>
+        update(Callback &&callback);
 
     private:
-        /*! Database connection configurations. */
-        T_THREAD_LOCAL
-        inline static ConfigurationsType m_configurations;
+        /*! Publish the given configurations map as a new snapshot. */
+        inline void publish(ConfigurationsType &&configurations);
+
+        /*! Database connection configurations snapshot (shared by all threads). */
+        SnapshotType m_configurations = std::make_shared<const ConfigurationsType>();
+        /*! Guards the snapshot pointer, it's held only while copying the pointer. */
+        mutable std::shared_mutex m_snapshotMutex;
+        /*! Serializes the update() calls, readers never wait for it. */
+        std::mutex m_updateMutex;
     };
 
     /* public */
 
-    DatabaseConfiguration::ConfigurationsType *
-    DatabaseConfiguration::operator->() noexcept
+    DatabaseConfiguration::SnapshotType
+    DatabaseConfiguration::snapshot() const
     {
-        return std::addressof(m_configurations);
-    }
+        const std::shared_lock lock(m_snapshotMutex);
 
-    const DatabaseConfiguration::ConfigurationsType *
-    DatabaseConfiguration::operator->() const noexcept
-    {
-        return std::addressof(m_configurations);
-    }
-
-    DatabaseConfiguration::ConfigurationsType &
-    DatabaseConfiguration::operator*() noexcept
-    {
         return m_configurations;
     }
 
-    const DatabaseConfiguration::ConfigurationsType &
-    DatabaseConfiguration::operator*() const noexcept
+    DatabaseConfiguration::SnapshotType
+    DatabaseConfiguration::operator->() const
     {
-        return m_configurations;
+        return snapshot();
     }
 
-    DatabaseConfiguration::ConfigurationsType &
-    DatabaseConfiguration::get() noexcept // NOLINT(readability-convert-member-functions-to-static)
+    template<typename Callback>
+    std::invoke_result_t<Callback, DatabaseConfiguration::ConfigurationsType &>
+    DatabaseConfiguration::update(Callback &&callback)
     {
-        return m_configurations;
+        const std::scoped_lock lock(m_updateMutex);
+
+        /* Readers still see the old snapshot while the copy is being modified, if
+           the callback throws, nothing will be published. */
+        auto configurations = *snapshot();
+
+        if constexpr (std::is_void_v<std::invoke_result_t<Callback,
+                                                          ConfigurationsType &>>) {
+            std::invoke(std::forward<Callback>(callback), configurations);
+
+            publish(std::move(configurations));
+        }
+        else {
+            auto result = std::invoke(std::forward<Callback>(callback), configurations);
+
+            publish(std::move(configurations));
+
+            return result;
+        }
     }
 
-    const DatabaseConfiguration::ConfigurationsType &
-    DatabaseConfiguration::get() const noexcept // NOLINT(readability-convert-member-functions-to-static)
+    /* private */
+
+    void DatabaseConfiguration::publish(ConfigurationsType &&configurations)
     {
-        return m_configurations;
+        auto snapshot = std::make_shared<const ConfigurationsType>(
+                            std::move(configurations));
+
+        const std::unique_lock lock(m_snapshotMutex);
+
+        m_configurations = std::move(snapshot);
     }
 
 } // namespace Orm::Support
@@ -5,8 +5,11 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <mutex>
+
 #include "orm/databaseconnection.hpp"
 #include "orm/macros/threadlocal.hpp"
+#include "orm/utils/thread.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -29,60 +32,101 @@ namespace Orm::Support
                 std::unordered_map<QString, std::shared_ptr<DatabaseConnection>>;
 
         /*! Return a pointer to the database connections map. */
-        inline ConnectionsType *operator->() noexcept;
+        inline ConnectionsType *operator->();
         /*! Return a pointer to the database connections map. */
-        inline const ConnectionsType *operator->() const noexcept;
+        inline const ConnectionsType *operator->() const;
         /*! Return a reference to the database connections map. */
-        inline ConnectionsType &operator*() noexcept;
+        inline ConnectionsType &operator*();
         /*! Return a reference to the database connections map. */
-        inline const ConnectionsType &operator*() const noexcept;
+        inline const ConnectionsType &operator*() const;
         /*! Return a reference to the database connections map. */
-        inline ConnectionsType &get() noexcept;
+        inline ConnectionsType &get();
         /*! Return a reference to the database connections map. */
-        inline const ConnectionsType &get() const noexcept;
+        inline const ConnectionsType &get() const;
+
+        /*! Destroy the database connections map of the current thread. */
+        inline static void removeCurrentThread();
 
     private:
+        /*! Get the database connections map for the current thread. */
+        inline static ConnectionsType &connections();
+
+#ifdef TINYORM_HAS_THREAD_LOCAL
         /*! Database connections for the current thread. */
         T_THREAD_LOCAL
         inline static ConnectionsType m_connections;
+#else
+        /* The thread_local is disabled for this compiler, so emulate it, the QtSql
+           connections must never be shared between threads. The std::unordered_map
+           guarantees that references to the mapped values stay valid. The thread
+           ordinal is used because thread IDs are reused by new threads. */
+        /*! Database connections for all threads (keyed by the thread ordinal). */
+        inline static std::unordered_map<quint64, ConnectionsType> m_connections;
+        /*! Guards the m_connections map. */
+        inline static std::mutex m_mutex;
+#endif
     };
 
     /* public */
 
     DatabaseConnectionsMap::ConnectionsType *
-    DatabaseConnectionsMap::operator->() noexcept
+    DatabaseConnectionsMap::operator->()
     {
-        return std::addressof(m_connections);
+        return std::addressof(connections());
     }
 
     const DatabaseConnectionsMap::ConnectionsType *
-    DatabaseConnectionsMap::operator->() const noexcept
+    DatabaseConnectionsMap::operator->() const
     {
-        return std::addressof(m_connections);
+        return std::addressof(connections());
     }
 
     DatabaseConnectionsMap::ConnectionsType &
-    DatabaseConnectionsMap::operator*() noexcept
+    DatabaseConnectionsMap::operator*()
     {
-        return m_connections;
+        return connections();
     }
 
     const DatabaseConnectionsMap::ConnectionsType &
-    DatabaseConnectionsMap::operator*() const noexcept
+    DatabaseConnectionsMap::operator*() const
     {
-        return m_connections;
+        return connections();
     }
 
     DatabaseConnectionsMap::ConnectionsType &
-    DatabaseConnectionsMap::get() noexcept // NOLINT(readability-convert-member-functions-to-static)
+    DatabaseConnectionsMap::get() // NOLINT(readability-convert-member-functions-to-static)
     {
-        return m_connections;
+        return connections();
     }
 
     const DatabaseConnectionsMap::ConnectionsType &
-    DatabaseConnectionsMap::get() const noexcept // NOLINT(readability-convert-member-functions-to-static)
+    DatabaseConnectionsMap::get() const // NOLINT(readability-convert-member-functions-to-static)
     {
+        return connections();
+    }
+
+    void DatabaseConnectionsMap::removeCurrentThread()
+    {
+#ifdef TINYORM_HAS_THREAD_LOCAL
+        m_connections.clear();
+#else
+        const std::scoped_lock lock(m_mutex);
+
+        m_connections.erase(Utils::Thread::currentThreadOrdinal());
+#endif
+    }
+
+    /* private */
+
+    DatabaseConnectionsMap::ConnectionsType &DatabaseConnectionsMap::connections()
+    {
+#ifdef TINYORM_HAS_THREAD_LOCAL
         return m_connections;
+#else
+        const std::scoped_lock lock(m_mutex);
+
+        return m_connections[Utils::Thread::currentThreadOrdinal()];
+#endif
     }
 
 } // namespace Orm::Support
@@ -0,0 +1,113 @@
+#pragma once
+#ifndef ORM_SUPPORT_QUERYCACHE_HPP
+#define ORM_SUPPORT_QUERYCACHE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QDeadlineTimer>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "orm/macros/export.hpp"
+#include "orm/support/querycacheinterface.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! In-process LRU query result cache bounded by the estimated memory size,
+        the default query cache used by the database connection. */
+    class SHAREDLIB_EXPORT QueryCache final : public QueryCacheInterface
+    {
+        Q_DISABLE_COPY(QueryCache)
+
+    public:
+        /*! The default maximum size of the cache in bytes (16MiB). */
+        constexpr static qint64 DefaultMaxSize = 16 * 1024 * 1024;
+
+        /*! Constructor. */
+        explicit QueryCache(qint64 maxSize = DefaultMaxSize);
+        /*! Virtual destructor. */
+        inline ~QueryCache() final = default;
+
+        /*! Get the cached result for the given key (std::nullopt on a miss). */
+        std::optional<QueryCacheResult> get(const QString &key) final;
+        /*! Store the result read from the given tables for the ttl seconds. */
+        void put(const QString &key, const QueryCacheResult &result,
+                 const QStringList &tables, int ttl) final;
+
+        /*! Remove all entries that read from the given table. */
+        void invalidate(const QString &table) final;
+        /*! Remove all entries. */
+        void flush() final;
+
+        /*! Determine whether the cache is empty. */
+        bool isEmpty() const final;
+        /*! Get the cache hit/miss metrics. */
+        QueryCacheStats stats() const final;
+
+        /*! Get the maximum size of the cache in bytes. */
+        inline qint64 getMaxSize() const noexcept;
+
+        /*! Get the cache key for the given connection, query string, and bindings. */
+        static QString key(const QString &connection, const QString &queryString,
+                           const QVector<QVariant> &bindings);
+        /*! Normalize the table name used to tag the cache entries (without quotes,
+            schema, and alias). */
+        static QString normalizeTable(const QString &table);
+        /*! Get the normalized table name written by the given statement, returns
+            an empty string if it can't be detected. */
+        static QString writtenTable(const QString &queryString);
+
+    private:
+        /*! Cache entry. */
+        struct Entry
+        {
+            /*! The cache key. */
+            QString key;
+            /*! The cached result. */
+            QueryCacheResult result;
+            /*! The normalized tables read by the query. */
+            QStringList tables;
+            /*! The entry expiration. */
+            QDeadlineTimer expires;
+            /*! The estimated memory size of the entry in bytes. */
+            qint64 size;
+        };
+
+        /*! Alias for the entries list type. */
+        using EntriesType = std::list<Entry>;
+
+        /*! Remove the given entry (the mutex must be locked). */
+        void remove(EntriesType::iterator entry);
+        /*! Estimate the memory size of the given entry in bytes. */
+        static qint64 estimateSize(const QString &key, const QueryCacheResult &result);
+
+        /*! Guards all data members. */
+        mutable std::mutex m_mutex;
+        /*! The cached entries, the most recently used entry is at the front. */
+        EntriesType m_entries;
+        /*! Index of the cached entries keyed by the cache key. */
+        std::unordered_map<QString, EntriesType::iterator> m_index;
+        /*! The maximum size of the cache in bytes. */
+        qint64 m_maxSize;
+        /*! The cache hit/miss metrics. */
+        QueryCacheStats m_stats;
+    };
+
+    /* public */
+
+    qint64 QueryCache::getMaxSize() const noexcept
+    {
+        return m_maxSize;
+    }
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_QUERYCACHE_HPP
@@ -0,0 +1,84 @@
+#pragma once
+#ifndef ORM_SUPPORT_QUERYCACHEINTERFACE_HPP
+#define ORM_SUPPORT_QUERYCACHEINTERFACE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QStringList>
+#include <QtSql/QSqlRecord>
+
+#include <optional>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+    /*! Materialized result of the cached select query. */
+    struct QueryCacheResult
+    {
+        /*! Columns of the result set (without values). */
+        QSqlRecord columns;
+        /*! All rows of the result set. */
+        QVector<QSqlRecord> rows;
+    };
+
+    /*! Query cache hit/miss metrics. */
+    struct QueryCacheStats
+    {
+        /*! Number of queries served from the cache. */
+        quint64 hits = 0;
+        /*! Number of queries that were not found in the cache. */
+        quint64 misses = 0;
+        /*! Number of entries removed because the cache was full. */
+        quint64 evictions = 0;
+        /*! Number of entries removed because their tables were written. */
+        quint64 invalidations = 0;
+        /*! Number of entries currently stored in the cache. */
+        qint64 entries = 0;
+        /*! Estimated memory used by the stored entries in bytes. */
+        qint64 size = 0;
+    };
+
+    /*! Query result cache interface, the results are keyed by the compiled SQL
+        and bindings and tagged by the tables the query reads. */
+    class QueryCacheInterface
+    {
+        Q_DISABLE_COPY(QueryCacheInterface)
+
+    public:
+        /*! Default constructor. */
+        inline QueryCacheInterface() = default;
+        /*! Pure virtual destructor. */
+        inline virtual ~QueryCacheInterface() = 0;
+
+        /*! Get the cached result for the given key (std::nullopt on a miss). */
+        virtual std::optional<QueryCacheResult> get(const QString &key) = 0;
+        /*! Store the result read from the given tables for the ttl seconds
+            (the ASTERISK table is invalidated by any write). */
+        virtual void put(const QString &key, const QueryCacheResult &result,
+                         const QStringList &tables, int ttl) = 0;
+
+        /*! Remove all entries that read from the given table. */
+        virtual void invalidate(const QString &table) = 0;
+        /*! Remove all entries. */
+        virtual void flush() = 0;
+
+        /*! Determine whether the cache is empty. */
+        virtual bool isEmpty() const = 0;
+        /*! Get the cache hit/miss metrics. */
+        virtual QueryCacheStats stats() const = 0;
+    };
+
+    /* public */
+
+    QueryCacheInterface::~QueryCacheInterface() = default;
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_QUERYCACHEINTERFACE_HPP
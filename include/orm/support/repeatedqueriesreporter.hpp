@@ -0,0 +1,101 @@
+#pragma once
+#ifndef ORM_SUPPORT_REPEATEDQUERIESREPORTER_HPP
+#define ORM_SUPPORT_REPEATEDQUERIESREPORTER_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QStringList>
+#include <QVector>
+
+#include <map>
+#include <memory>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+#include "orm/types/queryevents.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+
+class DatabaseConnection;
+
+namespace Support
+{
+
+    /*! Aggregates repeated identical query shapes executed during its lifetime (scope),
+        the N+1 problem shows up as the same query executed again and again with
+        different bindings. */
+    class SHAREDLIB_EXPORT RepeatedQueriesReporter
+    {
+        Q_DISABLE_COPY_MOVE(RepeatedQueriesReporter)
+
+    public:
+        /*! The query shape that was executed repeatedly. */
+        struct RepeatedQuery
+        {
+            /*! Executed query with placeholders (the query shape). */
+            QString query;
+            /*! Connection name on which the query was executed. */
+            QString connection;
+            /*! How many times the query was executed. */
+            qint64 count = 0;
+            /*! Total execution time of all executions in nanoseconds. */
+            qint64 elapsed = 0;
+        };
+
+        /*! Default minimum number of executions reported as the repeated query. */
+        constexpr static qint64 DefaultThreshold = 2;
+
+        /*! Constructor, start listening on the given connection. */
+        explicit RepeatedQueriesReporter(const QString &connection = "",
+                                         qint64 threshold = DefaultThreshold);
+        /*! Constructor, start listening on the given connections. */
+        explicit RepeatedQueriesReporter(const QStringList &connections,
+                                         qint64 threshold = DefaultThreshold);
+        /*! Destructor, stop listening. */
+        ~RepeatedQueriesReporter();
+
+        /*! Get queries executed at least threshold times, the most repeated first. */
+        QVector<RepeatedQuery> repeatedQueries() const;
+        /*! Determine whether any query was executed at least threshold times. */
+        bool hasRepeatedQueries() const;
+        /*! Get the human-readable report of the repeated queries. */
+        QString report() const;
+
+        /*! Forget all aggregated queries. */
+        void reset() noexcept;
+
+        /*! Get the minimum number of executions reported as the repeated query. */
+        inline qint64 threshold() const noexcept;
+
+    private:
+        /*! Register the query listener on the given connection. */
+        void listen(const QString &connection);
+        /*! Aggregate the executed query. */
+        void aggregate(const QueryExecutedEvent &event);
+
+        /*! Minimum number of executions reported as the repeated query. */
+        qint64 m_threshold;
+        /*! Registered listeners (connection and query listener ID). */
+        std::vector<std::pair<std::weak_ptr<DatabaseConnection>,
+                              std::size_t>> m_listeners;
+        /*! Aggregated queries keyed by the connection name and query shape. */
+        std::map<std::pair<QString, QString>, RepeatedQuery> m_queries;
+    };
+
+    /* public */
+
+    qint64 RepeatedQueriesReporter::threshold() const noexcept
+    {
+        return m_threshold;
+    }
+
+} // namespace Support
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_SUPPORT_REPEATEDQUERIESREPORTER_HPP
@@ -8,7 +8,9 @@ TINY_SYSTEM_HEADER
 #include <range/v3/algorithm/contains.hpp>
 
 #include "orm/exceptions/invalidtemplateargumenterror.hpp"
+#include "orm/macros/threadlocal.hpp"
 #include "orm/tiny/concerns/hasrelationstore.hpp"
+#include "orm/tiny/concerns/preventslazyloading.hpp"
 #include "orm/tiny/exceptions/relationmappingnotfounderror.hpp"
 #include "orm/tiny/exceptions/relationnotloadederror.hpp"
 #include "orm/tiny/macros/crtpmodelwithbase.hpp"
@@ -32,6 +34,7 @@ namespace Concerns
     /*! Model relationships. */
     template<typename Derived, AllRelationsConcept ...AllRelations>
     class HasRelationships :
+            public Concerns::PreventsLazyLoading,
             private Concerns::HasRelationStore<Derived, AllRelations...>
     {
         /* Using starts in the BaseRelationStore::visit() and is used to access private
@@ -49,7 +52,7 @@ namespace Concerns
         template<SerializedAttributes C, typename Derived_,
                  AllRelationsConcept ...AllRelations_>
         friend class Support::Stores::SerializeRelationStore;
-        // To access eagerLoadRelationWithVisitor()
+        // To access eagerLoadRelationWithVisitor() and m_preventsLazyLoading
         friend TinyBuilder<Derived>;
 
         /*! Alias for the attribute utils. */
@@ -271,6 +274,13 @@ namespace Concerns
         /*! Currently loaded Pivot relation names. */
         std::unordered_set<QString> m_pivots;
 
+        /*! Indicates whether lazy loading is prevented on all instances of the model. */
+        T_THREAD_LOCAL
+        inline static bool u_preventsLazyLoading = false;
+        /*! Indicates whether lazy loading is prevented on this model instance, set
+            when the model was hydrated together with other models. */
+        bool m_preventsLazyLoading = false;
+
     private:
         /*! Alias for the enum struct RelationMappingNotFoundError::From. */
         using RelationFrom = Tiny::Exceptions::RelationMappingNotFoundError::From;
@@ -428,8 +438,14 @@ namespace Concerns
         /*! If the relation is defined on the model, then lazy load and return results
             from the query and hydrate the relationship's value on the "relationships"
             data member m_relations. */
-        if (basemodel().getUserRelations().contains(relation))
+        if (basemodel().getUserRelations().contains(relation)) {
+            // Lazy loading the relation of the models collection is the N+1 problem
+            if (m_preventsLazyLoading)
+                handleLazyLoadingViolation(TypeUtils::classPureBasename<Derived>(),
+                                           relation);
+
             return getRelationshipFromMethod<Related, Container>(relation);
+        }
 
         return {};
     }
@@ -448,8 +464,14 @@ namespace Concerns
         /*! If the relation is defined on the model, then lazy load and return results
             from the query and hydrate the relationship's value on the "relationships"
             data member m_relations. */
-        if (basemodel().getUserRelations().contains(relation))
+        if (basemodel().getUserRelations().contains(relation)) {
+            // Lazy loading the relation of the models collection is the N+1 problem
+            if (m_preventsLazyLoading)
+                handleLazyLoadingViolation(TypeUtils::classPureBasename<Derived>(),
+                                           relation);
+
             return getRelationshipFromMethod<Related, Tag>(relation);
+        }
 
         return nullptr;
     }
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef ORM_TINY_CONCERNS_PREVENTSLAZYLOADING_HPP
+#define ORM_TINY_CONCERNS_PREVENTSLAZYLOADING_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QString>
+
+#include <functional>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Concerns
+{
+
+    /*! Prevents lazy loading of relations for the entire Model class. */
+    class SHAREDLIB_EXPORT PreventsLazyLoading
+    {
+    public:
+        /*! Callback type invoked on the lazy loading violation. */
+        using ViolationCallback = std::function<void(const QString &model,
+                                                     const QString &relation)>;
+
+        /*! Prevent model relationships from being lazy loaded. */
+        static void preventLazyLoading(bool value = true) noexcept;
+        /*! Determine if lazy loading is prevented on all models. */
+        static bool preventsLazyLoading() noexcept;
+
+        /*! Register a callback that is responsible for handling lazy loading
+            violations (instead of throwing the LazyLoadingViolationError). */
+        static void handleLazyLoadingViolationUsing(ViolationCallback callback);
+
+    protected:
+        /*! Handle the lazy loading violation (throw or invoke the callback). */
+        static void handleLazyLoadingViolation(const QString &model,
+                                               const QString &relation);
+    };
+
+} // namespace Orm::Tiny::Concerns
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_CONCERNS_PREVENTSLAZYLOADING_HPP
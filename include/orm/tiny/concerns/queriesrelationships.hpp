@@ -593,8 +593,10 @@ namespace Private
 //            $from->removedScopes()
 //        )->mergeWheres(
 
-        return query().mergeWheres(from.getQuery().getWheres(),
-                                   from.getQuery().getRawBindings()[BindingType::WHERE]);
+        const auto &fromQuery = from.getQuery();
+
+        return query().mergeWheres(fromQuery.getWheres(),
+                                   fromQuery.getRawBindings().value(BindingType::WHERE));
     }
 
     template<typename Model>
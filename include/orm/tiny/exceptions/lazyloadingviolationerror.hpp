@@ -0,0 +1,57 @@
+#pragma once
+#ifndef ORM_TINY_EXCEPTIONS_LAZYLOADINGVIOLATIONERROR_HPP
+#define ORM_TINY_EXCEPTIONS_LAZYLOADINGVIOLATIONERROR_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/exceptions/runtimeerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Exceptions
+{
+
+    /*! Lazy loading violation exception, thrown from Model::getRelationValue() when
+        the relation is lazy loaded and the lazy loading is prevented. */
+    class SHAREDLIB_EXPORT LazyLoadingViolationError : public Orm::Exceptions::RuntimeError // clazy:exclude=copyable-polymorphic
+    {
+    public:
+        /*! Constructor. */
+        LazyLoadingViolationError(const QString &model, const QString &relation);
+
+        /*! Get the affected TinyORM model. */
+        inline const QString &getModel() const noexcept;
+        /*! Get the name of the relation. */
+        inline const QString &getRelation() const noexcept;
+
+    protected:
+        /*! The name of the affected TinyORM model. */
+        QString m_model;
+        /*! The name of the relation. */
+        QString m_relation;
+
+    private:
+        /*! Format the error message. */
+        static QString formatMessage(const QString &model, const QString &relation);
+    };
+
+    /* public */
+
+    const QString &
+    LazyLoadingViolationError::getModel() const noexcept
+    {
+        return m_model;
+    }
+
+    const QString &
+    LazyLoadingViolationError::getRelation() const noexcept
+    {
+        return m_relation;
+    }
+
+} // namespace Orm::Tiny::Exceptions
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_EXCEPTIONS_LAZYLOADINGVIOLATIONERROR_HPP
@@ -0,0 +1,584 @@
+#pragma once
+#ifndef ORM_TINY_FACTORY_HPP
+#define ORM_TINY_FACTORY_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <algorithm>
+#include <functional>
+
+#include "orm/constants.hpp"
+#include "orm/databaseconnection.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/tiny/tinytypes.hpp"
+#include "orm/tiny/types/modelscollection.hpp"
+#include "orm/tiny/utils/attribute.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+
+    /*! Concept for the parent model of the belongs-to relationship. */
+    template<typename Parent>
+    concept FactoryParentConcept = requires(const Parent &parent)
+    {
+        { parent.getKey() } -> std::convertible_to<QVariant>;
+        { parent.getForeignKey() } -> std::convertible_to<QString>;
+    };
+
+    /*! Model factory base class, generates models in batches and persists them
+        using multi-row inserts (the derived factory defines the definition()). */
+    template<typename Derived, typename Model>
+    class Factory
+    {
+        // To access the createForParents() of factories for other models
+        template<typename, typename>
+        friend class Factory;
+
+    public:
+        /*! Alias for the model attributes. */
+        using Attributes            = QVector<AttributeItem>;
+        /*! Alias for the state callback (gets the current attributes). */
+        using StateCallback         = std::function<Attributes(const Attributes &)>;
+        /*! Alias for the sequence callback (gets the model index). */
+        using SequenceCallback      = std::function<Attributes(std::size_t)>;
+        /*! Alias for the after creating callback (gets the persisted batch). */
+        using AfterCreatingCallback = std::function<void(ModelsCollection<Model> &)>;
+
+        /*! Default number of models persisted by one batch. */
+        constexpr static std::size_t DefaultBatchSize = 1000;
+
+        /*! Default constructor. */
+        inline Factory() = default;
+        /*! Default destructor. */
+        inline ~Factory() = default;
+
+        /*! Copy constructor. */
+        inline Factory(const Factory &) = default;
+        /*! Copy assignment operator. */
+        inline Factory &operator=(const Factory &) = default;
+
+        /*! Move constructor. */
+        inline Factory(Factory &&) noexcept = default;
+        /*! Move assignment operator. */
+        inline Factory &operator=(Factory &&) noexcept = default;
+
+        /*! Set the number of models that should be generated. */
+        Derived &count(std::size_t count);
+        /*! Set the number of models persisted by one batch. */
+        Derived &batchSize(std::size_t size);
+        /*! Set the database connection used to persist models. */
+        Derived &connection(const QString &name);
+
+        /*! Add a state transformation (overrides the given attributes). */
+        Derived &state(Attributes attributes);
+        /*! Add a state transformation (overrides the returned attributes). */
+        Derived &state(StateCallback callback);
+        /*! Add a sequenced state transformation (rotates the given states). */
+        Derived &sequence(QVector<Attributes> states);
+        /*! Add a sequenced state transformation (gets the model index). */
+        Derived &sequence(SequenceCallback callback);
+
+        /*! Set the parent model of the belongs-to relationship. */
+        template<FactoryParentConcept Parent>
+        Derived &forParent(const Parent &parent, const QString &foreignKey = "");
+        /*! Create child models for every persisted model using the given factory. */
+        template<typename ChildFactory>
+        Derived &has(ChildFactory factory, const QString &foreignKey = "");
+        /*! Add a callback invoked after every persisted batch. */
+        Derived &afterCreating(AfterCreatingCallback callback);
+
+        /*! Make models without persisting them. */
+        ModelsCollection<Model> make();
+        /*! Make one model without persisting it. */
+        Model makeOne();
+
+        /*! Create models and persist them using multi-row inserts. */
+        ModelsCollection<Model> create();
+        /*! Create one model and persist it. */
+        Model createOne();
+        /*! Persist models using multi-row inserts without collecting them, returns
+            the number of persisted models. */
+        std::size_t insert();
+
+    protected:
+        /*! Static cast this to a child's instance type (CRTP). */
+        inline Derived &factory() noexcept;
+        /*! Static cast this to a child's instance type (CRTP), const version. */
+        inline const Derived &factory() const noexcept;
+
+    private:
+        /*! Alias for the state transformation (gets the model index). */
+        using StateTransformation = std::function<Attributes(Attributes &&, std::size_t)>;
+        /*! Alias for the callback returning extra attributes (gets the model index). */
+        using ExtraCallback       = std::function<Attributes(std::size_t)>;
+
+        /*! Make one model at the given index. */
+        Model makeModel(std::size_t index, const ExtraCallback &extra) const;
+        /*! Make the given number of models starting at the given index. */
+        ModelsCollection<Model>
+        makeModels(std::size_t first, std::size_t count,
+                   const ExtraCallback &extra) const;
+
+        /*! Create and persist the given number of models in batches. */
+        std::size_t createInBatches(std::size_t count, const ExtraCallback &extra,
+                                    ModelsCollection<Model> *result) const;
+        /*! Create and persist the configured number of models for every parent. */
+        template<typename Parent>
+        void createForParents(const ModelsCollection<Parent> &parents,
+                              const QString &foreignKey) const;
+
+        /*! Persist the given models using multi-row inserts (generated keys are
+            assigned only if needed). */
+        static void store(ModelsCollection<Model> &models, bool needsKeys);
+        /*! Persist the given models range using one multi-row insert. */
+        static void insertRows(ModelsCollection<Model> &models, qsizetype first,
+                               qsizetype last, const QVector<QString> &columns,
+                               bool needsKeys);
+        /*! Persist the given models range one by one and assign generated keys. */
+        static void insertRowsOneByOne(ModelsCollection<Model> &models,
+                                       qsizetype first, qsizetype last);
+
+        /*! Get the column names of the given model's attributes. */
+        static QVector<QString> columnNames(const Model &model);
+        /*! Determine whether the given model has the given column names. */
+        static bool hasColumns(const Model &model, const QVector<QString> &columns);
+        /*! Merge the given attributes (overrides existing keys). */
+        static void mergeAttributes(Attributes &attributes, const Attributes &overrides);
+
+        /*! The number of models that should be generated. */
+        std::size_t m_count = 1;
+        /*! The number of models persisted by one batch. */
+        std::size_t m_batchSize = DefaultBatchSize;
+        /*! The database connection used to persist models. */
+        std::optional<QString> m_connection = std::nullopt;
+        /*! State transformations applied on the definition() attributes. */
+        std::vector<StateTransformation> m_states;
+        /*! Callbacks invoked after every persisted batch. */
+        std::vector<AfterCreatingCallback> m_afterCreating;
+    };
+
+    /* public */
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::count(const std::size_t count)
+    {
+        m_count = count;
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::batchSize(const std::size_t size)
+    {
+        if (size == 0)
+            throw Orm::Exceptions::InvalidArgumentError(
+                    "The factory batch size must be greater than 0.");
+
+        m_batchSize = size;
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::connection(const QString &name)
+    {
+        m_connection = name;
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::state(Attributes attributes)
+    {
+        m_states.emplace_back([attributes = std::move(attributes)]
+                              (Attributes &&current, const std::size_t /*unused*/)
+        {
+            mergeAttributes(current, attributes);
+
+            return std::move(current);
+        });
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::state(StateCallback callback)
+    {
+        m_states.emplace_back([callback = std::move(callback)]
+                              (Attributes &&current, const std::size_t /*unused*/)
+        {
+            mergeAttributes(current, std::invoke(callback, std::as_const(current)));
+
+            return std::move(current);
+        });
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::sequence(QVector<Attributes> states)
+    {
+        if (states.isEmpty())
+            throw Orm::Exceptions::InvalidArgumentError(
+                    "The factory sequence must contain at least one state.");
+
+        m_states.emplace_back([states = std::move(states)]
+                              (Attributes &&current, const std::size_t index)
+        {
+            mergeAttributes(current, states.at(static_cast<qsizetype>(
+                                index % static_cast<std::size_t>(states.size()))));
+
+            return std::move(current);
+        });
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::sequence(SequenceCallback callback)
+    {
+        m_states.emplace_back([callback = std::move(callback)]
+                              (Attributes &&current, const std::size_t index)
+        {
+            mergeAttributes(current, std::invoke(callback, index));
+
+            return std::move(current);
+        });
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    template<FactoryParentConcept Parent>
+    Derived &
+    Factory<Derived, Model>::forParent(const Parent &parent, const QString &foreignKey)
+    {
+        return state(Attributes {
+            {foreignKey.isEmpty() ? parent.getForeignKey() : foreignKey,
+             parent.getKey()},
+        });
+    }
+
+    template<typename Derived, typename Model>
+    template<typename ChildFactory>
+    Derived &
+    Factory<Derived, Model>::has(ChildFactory factory, const QString &foreignKey)
+    {
+        m_afterCreating.emplace_back([factory = std::move(factory), foreignKey]
+                                     (ModelsCollection<Model> &parents)
+        {
+            factory.createForParents(parents, foreignKey);
+        });
+
+        return this->factory();
+    }
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::afterCreating(AfterCreatingCallback callback)
+    {
+        m_afterCreating.push_back(std::move(callback));
+
+        return factory();
+    }
+
+    template<typename Derived, typename Model>
+    ModelsCollection<Model> Factory<Derived, Model>::make()
+    {
+        return makeModels(0, m_count, nullptr);
+    }
+
+    template<typename Derived, typename Model>
+    Model Factory<Derived, Model>::makeOne()
+    {
+        return makeModel(0, nullptr);
+    }
+
+    template<typename Derived, typename Model>
+    ModelsCollection<Model> Factory<Derived, Model>::create()
+    {
+        ModelsCollection<Model> models;
+        models.reserve(static_cast<qsizetype>(m_count));
+
+        createInBatches(m_count, nullptr, &models);
+
+        return models;
+    }
+
+    template<typename Derived, typename Model>
+    Model Factory<Derived, Model>::createOne()
+    {
+        ModelsCollection<Model> models;
+        models.reserve(1);
+
+        createInBatches(1, nullptr, &models);
+
+        return std::move(models.first());
+    }
+
+    template<typename Derived, typename Model>
+    std::size_t Factory<Derived, Model>::insert()
+    {
+        return createInBatches(m_count, nullptr, nullptr);
+    }
+
+    /* protected */
+
+    template<typename Derived, typename Model>
+    Derived &Factory<Derived, Model>::factory() noexcept
+    {
+        return static_cast<Derived &>(*this);
+    }
+
+    template<typename Derived, typename Model>
+    const Derived &Factory<Derived, Model>::factory() const noexcept
+    {
+        return static_cast<const Derived &>(*this);
+    }
+
+    /* private */
+
+    template<typename Derived, typename Model>
+    Model
+    Factory<Derived, Model>::makeModel(const std::size_t index,
+                                       const ExtraCallback &extra) const
+    {
+        auto attributes = factory().definition();
+
+        for (const auto &state : m_states)
+            attributes = std::invoke(state, std::move(attributes), index);
+
+        if (extra)
+            mergeAttributes(attributes, std::invoke(extra, index));
+
+        Model model;
+
+        if (m_connection)
+            model.setConnection(*m_connection);
+
+        // Casts and mutators are applied the same way as for the save()
+        model.forceFill(std::move(attributes));
+
+        return model;
+    }
+
+    template<typename Derived, typename Model>
+    ModelsCollection<Model>
+    Factory<Derived, Model>::makeModels(
+            const std::size_t first, const std::size_t count,
+            const ExtraCallback &extra) const
+    {
+        ModelsCollection<Model> models;
+        models.reserve(static_cast<qsizetype>(count));
+
+        for (auto index = first; index < first + count; ++index)
+            models << makeModel(index, extra);
+
+        return models;
+    }
+
+    template<typename Derived, typename Model>
+    std::size_t
+    Factory<Derived, Model>::createInBatches(
+            const std::size_t count, const ExtraCallback &extra,
+            ModelsCollection<Model> *const result) const
+    {
+        std::size_t created = 0;
+
+        /* Only one batch of models lives in the memory at once if the result isn't
+           collected, so millions of models can be persisted. */
+        while (created < count) {
+            auto models = makeModels(created, std::min(m_batchSize, count - created),
+                                     extra);
+
+            /* Generated keys aren't needed if models aren't returned and nothing
+               is created for them. */
+            store(models, result != nullptr || !m_afterCreating.empty());
+
+            for (const auto &callback : m_afterCreating)
+                std::invoke(callback, models);
+
+            created += static_cast<std::size_t>(models.size());
+
+            if (result != nullptr)
+                std::ranges::move(models, std::back_inserter(*result));
+        }
+
+        return created;
+    }
+
+    template<typename Derived, typename Model>
+    template<typename Parent>
+    void Factory<Derived, Model>::createForParents(
+            const ModelsCollection<Parent> &parents, const QString &foreignKey) const
+    {
+        // Nothing to do
+        if (parents.isEmpty() || m_count == 0)
+            return;
+
+        auto key = foreignKey.isEmpty() ? parents.constFirst().getForeignKey()
+                                        : foreignKey;
+
+        // The m_count children are created for every parent
+        const auto parentKey = [&parents, key = std::move(key), count = m_count]
+                               (const std::size_t index)
+        {
+            return Attributes {
+                {key, parents.at(static_cast<qsizetype>(index / count)).getKey()},
+            };
+        };
+
+        createInBatches(static_cast<std::size_t>(parents.size()) * m_count, parentKey,
+                        nullptr);
+    }
+
+    template<typename Derived, typename Model>
+    void Factory<Derived, Model>::store(ModelsCollection<Model> &models,
+                                        const bool needsKeys)
+    {
+        // Nothing to store
+        if (models.isEmpty())
+            return;
+
+        for (auto &model : models)
+            if (model.usesTimestamps())
+                model.updateTimestamps();
+
+        const auto maxPlaceholders = models.first().getConnection().getQueryGrammar()
+                                     .getMaxPlaceholders();
+
+        qsizetype first = 0;
+
+        /* All rows of one multi-row insert must have the same columns and the number
+           of placeholders is limited by the database server. */
+        while (first < models.size()) {
+            const auto columns = columnNames(models.at(first));
+
+            // Nothing to insert, the save() inserts default values
+            if (columns.isEmpty()) {
+                models[first++].save();
+                continue;
+            }
+
+            const auto maxRows = std::max<qsizetype>(maxPlaceholders / columns.size(),
+                                                     1);
+            auto last = first + 1;
+
+            while (last < models.size() && last - first < maxRows &&
+                   hasColumns(models.at(last), columns)
+            )
+                ++last;
+
+            insertRows(models, first, last, columns, needsKeys);
+
+            first = last;
+        }
+    }
+
+    template<typename Derived, typename Model>
+    void Factory<Derived, Model>::insertRows(
+            ModelsCollection<Model> &models, const qsizetype first,
+            const qsizetype last, const QVector<QString> &columns, const bool needsKeys)
+    {
+        auto &model = models[first];
+        const auto &keyName = model.getKeyName();
+        const auto assignKeys = needsKeys && model.getIncrementing() &&
+                                !columns.contains(keyName);
+
+        /* Generated keys can't be assigned to the models of the multi-row insert,
+           sequences and auto-increments interleave with concurrent sessions and
+           the order of the insert ... returning rows isn't guaranteed, so models
+           are inserted one by one if their keys are needed. */
+        if (assignKeys)
+            return insertRowsOneByOne(models, first, last); // clazy:exclude=returning-void-expression
+
+        QVector<QVariantMap> values;
+        values.reserve(last - first);
+
+        for (auto index = first; index < last; ++index)
+            values << Utils::Attribute::convertVectorToMap(
+                          models.at(index).getAttributes());
+
+        model.newQueryWithoutRelationships()->toBase().insert(values);
+
+        for (auto index = first; index < last; ++index) {
+            auto &insertedModel = models[index];
+
+            insertedModel.exists = true;
+            insertedModel.syncOriginal();
+        }
+    }
+
+    template<typename Derived, typename Model>
+    void Factory<Derived, Model>::insertRowsOneByOne(
+            ModelsCollection<Model> &models, const qsizetype first,
+            const qsizetype last)
+    {
+        for (auto index = first; index < last; ++index) {
+            auto &model = models[index];
+            const auto &keyName = model.getKeyName();
+
+            // Primary key of the pretended query is unknown (0)
+            if (const auto id = model.newQueryWithoutRelationships()
+                                     ->insertGetId(model.getAttributes(), keyName);
+                id != 0
+            )
+                model.setAttribute(keyName, id);
+
+            model.exists = true;
+            model.syncOriginal();
+        }
+    }
+
+    template<typename Derived, typename Model>
+    QVector<QString> Factory<Derived, Model>::columnNames(const Model &model)
+    {
+        const auto &attributes = model.getAttributes();
+
+        QVector<QString> columns;
+        columns.reserve(attributes.size());
+
+        for (const auto &attribute : attributes)
+            columns << attribute.key;
+
+        return columns;
+    }
+
+    template<typename Derived, typename Model>
+    bool Factory<Derived, Model>::hasColumns(const Model &model,
+                                             const QVector<QString> &columns)
+    {
+        const auto &attributes = model.getAttributes();
+
+        if (attributes.size() != columns.size())
+            return false;
+
+        for (qsizetype index = 0; index < columns.size(); ++index)
+            if (attributes.at(index).key != columns.at(index))
+                return false;
+
+        return true;
+    }
+
+    template<typename Derived, typename Model>
+    void Factory<Derived, Model>::mergeAttributes(Attributes &attributes,
+                                                  const Attributes &overrides)
+    {
+        for (const auto &override_ : overrides) {
+            const auto it = std::ranges::find(attributes, override_.key,
+                                              &AttributeItem::key);
+
+            if (it == attributes.end())
+                attributes << override_;
+            else
+                it->value = override_.value;
+        }
+    }
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_FACTORY_HPP
@@ -0,0 +1,181 @@
+#pragma once
+#ifndef ORM_TINY_IDENTITYMAP_HPP
+#define ORM_TINY_IDENTITYMAP_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+
+#include <any>
+#include <optional>
+#include <typeindex>
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+
+    /*! Identity map (first-level cache) of the models loaded in one unit of work.
+        The identity map is opt-in, it's active on the current thread for the lifetime
+        of the instance (RAII scope), scopes can be nested and the innermost one
+        is used. */
+    class SHAREDLIB_EXPORT IdentityMap
+    {
+        Q_DISABLE_COPY_MOVE(IdentityMap)
+
+    public:
+        /*! Constructor, activates the identity map on the current thread. */
+        IdentityMap();
+        /*! Destructor, restores the previously active identity map. */
+        ~IdentityMap();
+
+        /*! Get the identity map active on the current thread (nullptr if none). */
+        static IdentityMap *current() noexcept;
+        /*! Determine whether the identity map is active on the current thread. */
+        inline static bool isActive() noexcept;
+
+        /*! Get the model by the primary key from the identity map. */
+        template<typename Model>
+        std::optional<Model>
+        find(const QString &connection, const QVariant &id) const;
+        /*! Determine whether the identity map contains the given model. */
+        template<typename Model>
+        bool contains(const Model &model) const;
+
+        /*! Put the given model to the identity map (replaces the existing one). */
+        template<typename Model>
+        void remember(const Model &model);
+        /*! Replace the given model in the identity map if it already contains it. */
+        template<typename Model>
+        void refresh(const Model &model);
+        /*! Remove the given model from the identity map. */
+        template<typename Model>
+        void forget(const Model &model);
+
+        /*! Remove all models from the identity map. */
+        inline void clear() noexcept;
+        /*! Get the number of models in the identity map. */
+        std::size_t size() const noexcept;
+
+        /*! RAII scope that suspends the active identity map on the current thread,
+            used for queries that can't be served from the identity map. */
+        class SHAREDLIB_EXPORT Suspended
+        {
+            Q_DISABLE_COPY_MOVE(Suspended)
+
+        public:
+            /*! Constructor, suspends the active identity map. */
+            Suspended() noexcept;
+            /*! Destructor, resumes the suspended identity map. */
+            ~Suspended();
+
+        private:
+            /*! The suspended identity map. */
+            IdentityMap *m_suspended;
+        };
+
+    private:
+        /*! Models keyed by the connection name and the primary key. */
+        using ModelsHash = std::unordered_map<QString, std::any>;
+
+        /*! Get the key for the models hash. */
+        inline static QString modelKey(const QString &connection, const QVariant &id);
+        /*! Get the key for the models hash from the given model. */
+        template<typename Model>
+        static QString modelKey(const Model &model);
+
+        /*! Set the identity map active on the current thread. */
+        static void setCurrent(IdentityMap *identityMap) noexcept;
+
+        /*! Models hash for every model type. */
+        std::unordered_map<std::type_index, ModelsHash> m_models;
+        /*! The identity map that was active before this one. */
+        IdentityMap *m_previous;
+    };
+
+    /* public */
+
+    bool IdentityMap::isActive() noexcept
+    {
+        return current() != nullptr;
+    }
+
+    template<typename Model>
+    std::optional<Model>
+    IdentityMap::find(const QString &connection, const QVariant &id) const
+    {
+        const auto models = m_models.find(typeid (Model));
+
+        if (models == m_models.cend())
+            return std::nullopt;
+
+        const auto model = models->second.find(modelKey(connection, id));
+
+        if (model == models->second.cend())
+            return std::nullopt;
+
+        return std::any_cast<const Model &>(model->second);
+    }
+
+    template<typename Model>
+    bool IdentityMap::contains(const Model &model) const
+    {
+        const auto models = m_models.find(typeid (Model));
+
+        return models != m_models.cend() && models->second.contains(modelKey(model));
+    }
+
+    template<typename Model>
+    void IdentityMap::remember(const Model &model)
+    {
+        // Nothing to remember, the model was not loaded from the database
+        if (!model.exists)
+            return;
+
+        m_models[typeid (Model)].insert_or_assign(modelKey(model), model);
+    }
+
+    template<typename Model>
+    void IdentityMap::refresh(const Model &model)
+    {
+        if (contains(model))
+            remember(model);
+    }
+
+    template<typename Model>
+    void IdentityMap::forget(const Model &model)
+    {
+        const auto models = m_models.find(typeid (Model));
+
+        if (models != m_models.end())
+            models->second.erase(modelKey(model));
+    }
+
+    void IdentityMap::clear() noexcept
+    {
+        m_models.clear();
+    }
+
+    /* private */
+
+    QString IdentityMap::modelKey(const QString &connection, const QVariant &id)
+    {
+        return QStringLiteral("%1:%2").arg(connection, id.toString());
+    }
+
+    template<typename Model>
+    QString IdentityMap::modelKey(const Model &model)
+    {
+        return modelKey(model.getConnection().getName(), model.getKey());
+    }
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_IDENTITYMAP_HPP
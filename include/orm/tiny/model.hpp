@@ -30,6 +30,8 @@ namespace Orm::Tiny
 
     /*! Alias for the GuardedModel. */
     using GuardedModel = Concerns::GuardedModel; // Don't remove
+    /*! Alias for the PreventsLazyLoading. */
+    using PreventsLazyLoading = Concerns::PreventsLazyLoading;
 
     // TODO model missing methods Model::loadMissing() silverqx
     // TODO model missing saveOrFail(), updateOrFail(), deleteOrFail(), I will need to implement ManagesTransaction::transaction(callback) method silverqx
@@ -194,6 +196,12 @@ namespace Orm::Tiny
         /*! Destroy the model by the given ID. */
         inline static std::size_t destroy(const QVariant &id);
 
+        /*! Save the given models using batched queries (multi-row inserts and
+            prepared updates grouped by the changed columns). */
+        static bool saveMany(const QVector<Derived *> &models, SaveOptions options = {});
+        /*! Save the given models and all of their relationships. */
+        static bool pushMany(const QVector<Derived *> &models);
+
         /* Operations on a Model instance */
         /*! Save the model to the database. */
         bool save(SaveOptions options = {});
@@ -402,6 +410,14 @@ namespace Orm::Tiny
         quint64 insertAndSetId(const TinyBuilder<Derived> &query,
                                const QVector<AttributeItem> &attributes);
 
+        /*! Perform batched inserts and updates for the given models. */
+        static void performSaveMany(const QVector<Derived *> &models,
+                                    DatabaseConnection &connection);
+        /*! Update the changed columns of the given models in one update statement. */
+        static void performBulkUpdate(const QVector<Derived *> &models,
+                                      const QStringList &columns,
+                                      DatabaseConnection &connection);
+
         /* Data members */
         /*! The table associated with the model. */
         QString u_table;
@@ -493,6 +509,8 @@ namespace Orm::Tiny
         inline const QStringList &getUserTouches() const noexcept;
         /*! Get the u_touches relation names to touch from the Derived model. */
         inline QStringList &getUserTouches() noexcept;
+        /*! Get the u_preventsLazyLoading attribute from the Derived model. */
+        inline static bool getUserPreventsLazyLoading() noexcept;
 
         /* HasTimestamps */
         /*! Get the u_timestamps attribute from the Derived model. */
@@ -794,6 +812,69 @@ namespace Orm::Tiny
         return destroy(QVector<QVariant> {id});
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::saveMany(const QVector<Derived *> &models,
+                                                   const SaveOptions options)
+    {
+        // Models grouped by the connection name, every group is saved in a transaction
+        std::map<QString, QVector<Derived *>> connectionGroups;
+
+        for (auto *const model : models)
+            if (model != nullptr)
+                connectionGroups[model->getConnectionName()] << model;
+
+        for (const auto &[connectionName, groupModels] : connectionGroups) {
+            auto &connection = groupModels.constFirst()->getConnection();
+
+            // Don't touch the transaction started by a caller
+            const auto ownsTransaction = !connection.inTransaction();
+
+            if (ownsTransaction)
+                connection.beginTransaction();
+
+            try {
+                performSaveMany(groupModels, connection);
+
+            } catch (...) {
+                if (ownsTransaction && connection.inTransaction())
+                    connection.rollBack();
+
+                throw;
+            }
+
+            if (ownsTransaction)
+                connection.commit();
+        }
+
+        /* All the models were successfully saved, so do the same as the save() method
+           does for every model once it's saved. */
+        for (const auto &[connectionName, groupModels] : connectionGroups)
+            for (auto *const model : groupModels)
+                model->finishSave(options);
+
+        return true;
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::pushMany(const QVector<Derived *> &models)
+    {
+        if (!saveMany(models))
+            return false;
+
+        /* The models are saved using the batched queries, their relations are pushed
+           in the same way as the push() method does it. */
+        for (auto *const model : models) {
+            if (model == nullptr)
+                continue;
+
+            for (auto &[relation, relatedModels] : model->m_relations)
+                if (!model->pushWithVisitor(relation, relatedModels))
+                    return false;
+        }
+
+        return true;
+    }
+
     /* Operations on a Model instance */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -924,6 +1005,10 @@ namespace Orm::Tiny
         else
             Model::performDeleteOnModel();
 
+        // The deleted model can't be served from the identity map anymore
+        if (auto *const identityMap = IdentityMap::current(); identityMap != nullptr)
+            identityMap->forget(model());
+
         /* Once the model has been deleted, we will fire off the deleted event so that
            the developers may hook into post-delete operations. We will then return
            a boolean true as the delete is presumably successful on the database. */
@@ -1744,6 +1829,10 @@ namespace Orm::Tiny
             this->touchOwners();
 
         this->syncOriginal();
+
+        // Keep the model in the identity map up to date
+        if (auto *const identityMap = IdentityMap::current(); identityMap != nullptr)
+            identityMap->refresh(model());
     }
 
     // FEATURE dilemma primarykey, add support for Derived::KeyType silverqx
@@ -1766,6 +1855,185 @@ namespace Orm::Tiny
         return id;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void Model<Derived, AllRelations...>::performSaveMany(
+            const QVector<Derived *> &models, DatabaseConnection &connection)
+    {
+        // Models grouped by the inserted or changed columns
+        using ModelsGroups = std::map<QStringList, QVector<Derived *>>;
+
+        // New models grouped by the inserted columns (multi-row inserts)
+        ModelsGroups inserts;
+        // Dirty models grouped by the changed columns (one update for many models)
+        ModelsGroups updates;
+
+        // The same as the save() method does once the model is inserted
+        const auto setConnection = [&connection](Derived *const model)
+        {
+            if (model->getConnectionName().isEmpty())
+                model->setConnection(connection.getName());
+        };
+        const auto markAsInserted = [&setConnection](Derived *const model)
+        {
+            model->exists = true;
+
+            setConnection(model);
+        };
+
+        for (auto *const model : models) {
+            /* Touch the creation and update timestamps the same way as
+               the performInsert() and performUpdate() methods do. */
+            if (model->exists) {
+                if (!model->isDirty())
+                    continue;
+
+                if (model->usesTimestamps())
+                    model->updateTimestamps();
+
+                updates[AttributeUtils::convertVectorToMap(model->getDirty()).keys()]
+                        << model;
+
+                continue;
+            }
+
+            if (model->usesTimestamps())
+                model->updateTimestamps();
+
+            const auto &attributes = model->getAttributes();
+
+            // Nothing to insert, the same as the performInsert() does
+            if (!model->getIncrementing() && attributes.isEmpty()) {
+                setConnection(model);
+                continue;
+            }
+
+            /* Generated keys can't be assigned to the models of the multi-row insert,
+               sequences and auto-increments interleave with concurrent sessions and
+               the order of the insert ... returning rows isn't guaranteed, so
+               incrementing models are inserted one by one. */
+            if (model->getIncrementing()) {
+                model->insertAndSetId(*model->newModelQuery(), attributes);
+                markAsInserted(model);
+                continue;
+            }
+
+            inserts[AttributeUtils::convertVectorToMap(attributes).keys()] << model;
+        }
+
+        using SizeType = typename QVector<Derived *>::size_type;
+
+        const auto maxPlaceholders = connection.getQueryGrammar().getMaxPlaceholders();
+
+        // Multi-row inserts
+        for (const auto &[columns, insertModels] : inserts) {
+            // Keep the number of placeholders in one insert statement under the limit
+            const auto chunkSize = std::max<SizeType>(1, maxPlaceholders /
+                                                         columns.size());
+
+            for (SizeType i = 0; i < insertModels.size(); i += chunkSize) {
+                const auto chunk = insertModels.mid(i, chunkSize);
+
+                QVector<QVector<AttributeItem>> values;
+                values.reserve(chunk.size());
+
+                for (auto *const model : chunk)
+                    values << model->getAttributes();
+
+                chunk.constFirst()->newModelQuery()->insert(values);
+
+                for (auto *const model : chunk)
+                    markAsInserted(model);
+            }
+        }
+
+        // Bulk updates
+        for (const auto &[columns, updateModels] : updates) {
+            QVector<Derived *> bulkModels;
+            bulkModels.reserve(updateModels.size());
+
+            for (auto *const model : updateModels)
+                /* Pivot models don't have one primary key and a changed primary key
+                   can't be used in the CASE expression, update them one by one. */
+                if (std::is_base_of_v<Relations::IsPivotModel, Derived> ||
+                    columns.contains(model->getKeyName())
+                ) {
+                    // Called on the Derived as it's overriden in the BasePivot
+                    model->setKeysForSaveQuery(*model->newModelQuery())
+                            .update(AttributeUtils::convertVectorToUpdateItem(
+                                        model->getDirty()));
+
+                    model->syncChanges();
+                }
+                else
+                    bulkModels << model;
+
+            // Keep the number of placeholders in one update statement under the limit
+            const auto chunkSize = std::max<SizeType>(1, maxPlaceholders /
+                                                         ((columns.size() * 2) + 1));
+
+            for (SizeType i = 0; i < bulkModels.size(); i += chunkSize)
+                performBulkUpdate(bulkModels.mid(i, chunkSize), columns, connection);
+        }
+    }
+
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    void Model<Derived, AllRelations...>::performBulkUpdate(
+            const QVector<Derived *> &models, const QStringList &columns,
+            DatabaseConnection &connection)
+    {
+        using SizeType = typename QVector<Derived *>::size_type;
+
+        const auto &grammar = connection.getQueryGrammar();
+        const auto &firstModel = *models.constFirst();
+        const auto key = grammar.wrap(firstModel.getKeyName());
+
+        QVector<QVariant> keys;
+        keys.reserve(models.size());
+
+        QVector<QVariantMap> dirtyAttributes;
+        dirtyAttributes.reserve(models.size());
+
+        for (auto *const model : models) {
+            keys << model->getKeyForSaveQuery();
+            dirtyAttributes << AttributeUtils::convertVectorToMap(model->getDirty());
+        }
+
+        QStringList sets;
+        sets.reserve(columns.size());
+
+        QVector<QVariant> bindings;
+        bindings.reserve((columns.size() * models.size() * 2) + models.size());
+
+        /* One update statement for all the models, every changed column is set using
+           the CASE expression keyed by the primary key. The else branch also gives
+           the CASE expression the column type (PostgreSQL can't infer it from
+           the bindings). */
+        for (const auto &column : columns) {
+            QString whenClauses;
+
+            for (SizeType i = 0; i < models.size(); ++i) {
+                whenClauses += QStringLiteral(" when ? then ?");
+                bindings << keys.at(i) << dirtyAttributes.at(i).value(column);
+            }
+
+            const auto wrappedColumn = grammar.wrap(column);
+
+            sets << QStringLiteral("%1 = case %2%3 else %1 end")
+                    .arg(wrappedColumn, key, whenClauses);
+        }
+
+        bindings << keys;
+
+        connection.update(QStringLiteral("update %1 set %2 where %3 in (%4)")
+                          .arg(grammar.wrapTable(firstModel.getTable()),
+                               sets.join(Constants::COMMA), key,
+                               grammar.parametrize(keys)),
+                          std::move(bindings));
+
+        for (auto *const model : models)
+            model->syncChanges();
+    }
+
     /* private */
 
     /* Operations on a Model instance */
@@ -2002,6 +2270,12 @@ namespace Orm::Tiny
         return model().u_touches;
     }
 
+    template<typename Derived, AllRelationsConcept ...AllRelations>
+    bool Model<Derived, AllRelations...>::getUserPreventsLazyLoading() noexcept
+    {
+        return Derived::u_preventsLazyLoading;
+    }
+
     /* HasTimestamps */
 
     template<typename Derived, AllRelationsConcept ...AllRelations>
@@ -5,6 +5,7 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include "orm/tiny/identitymap.hpp"
 #include "orm/tiny/relations/concerns/comparesrelatedmodels.hpp"
 #include "orm/tiny/relations/concerns/supportsdefaultmodels.hpp"
 #include "orm/tiny/relations/relation.hpp"
@@ -81,6 +82,8 @@ namespace Orm::Tiny::Relations
         /*! Get the results of the relationship. */
         std::variant<ModelsCollection<Related>, std::optional<Related>>
         getResults() const override;
+        /*! Get the relationship for eager loading. */
+        ModelsCollection<Related> getEager() const override;
 
         /* Updating relationship */
         /*! Associate the model instance to the given parent. */
@@ -126,6 +129,11 @@ namespace Orm::Tiny::Relations
         /*! Make a new related instance for the given model. */
         inline Related newRelatedInstanceFor(const Model &/*unused*/) const override;
 
+        /*! Determine whether the related models can be shared through the identity
+            map (the owner key must be the primary key of the related model and
+            the relation query must not be constrained). */
+        inline bool usesIdentityMap() const;
+
         /* Getters */
         /*! Get the value of the model's foreign key. */
         template<ModelConcept M>
@@ -150,6 +158,13 @@ namespace Orm::Tiny::Relations
         /*! The count of self joins. */
         T_THREAD_LOCAL
         inline static int selfJoinCount = 0;
+        /*! Determine whether the eager load is served from the identity map. */
+        bool m_eagerFromIdentityMap = false;
+        /*! Determine whether all eagerly loaded models were found in the identity map
+            (the eager query isn't executed). */
+        bool m_eagerFoundInIdentityMap = false;
+        /*! Related models for the eager load served from the identity map. */
+        ModelsCollection<Related> m_identityMapModels;
 
     private:
         /* Relation related operations */
@@ -290,6 +305,31 @@ namespace Orm::Tiny::Relations
         return dictionary;
     }
 
+    template<class Model, class Related>
+    ModelsCollection<Related> BelongsTo<Model, Related>::getEager() const
+    {
+        if (!m_eagerFromIdentityMap)
+            return Relation<Model, Related>::getEager();
+
+        // Query only the related models that are missing in the identity map
+        ModelsCollection<Related> results;
+        if (!m_eagerFoundInIdentityMap)
+            results = Relation<Model, Related>::getEager();
+
+        // Share the queried models with the rest of the unit of work
+        auto *const identityMap = IdentityMap::current();
+
+        for (const auto &result : results)
+            identityMap->remember(result);
+
+        results.reserve(results.size() + m_identityMapModels.size());
+
+        for (const auto &model : m_identityMapModels)
+            results << model;
+
+        return results;
+    }
+
     template<class Model, class Related>
     std::variant<ModelsCollection<Related>, std::optional<Related>>
     BelongsTo<Model, Related>::getResults() const
@@ -444,6 +484,13 @@ namespace Orm::Tiny::Relations
         return this->m_related->newInstance();
     }
 
+    template<class Model, class Related>
+    bool BelongsTo<Model, Related>::usesIdentityMap() const
+    {
+        return IdentityMap::isActive() && m_ownerKey == this->m_related->getKeyName() &&
+               this->m_query->isServableFromIdentityMap();
+    }
+
     /* Getters */
 
     template<class Model, class Related>
@@ -485,8 +532,38 @@ namespace Orm::Tiny::Relations
         /* We'll grab the primary key name of the related models since it could be set to
            a non-standard name and not "id". We will then construct the constraint for
            our eagerly loading query so it returns the proper models from execution. */
+        auto keys = getEagerModelKeys(models);
+
+        /* Related models that are already in the identity map don't have to be queried,
+           they will be merged with the queried models in the getEager(). */
+        m_eagerFromIdentityMap = usesIdentityMap();
+
+        if (m_eagerFromIdentityMap) {
+            const auto &connection = this->getQuery().getConnection().getName();
+            auto *const identityMap = IdentityMap::current();
+
+            QVector<QVariant> missingKeys;
+            missingKeys.reserve(keys.size());
+
+            for (auto &&key : keys)
+                if (auto related = identityMap->template find<Related>(connection, key);
+                    related
+                )
+                    m_identityMapModels << std::move(*related);
+                else
+                    missingKeys << std::move(key);
+
+            // Nothing to query, all related models were found in the identity map
+            if (missingKeys.isEmpty()) {
+                m_eagerFoundInIdentityMap = true;
+                return;
+            }
+
+            keys = std::move(missingKeys);
+        }
+
         this->whereInEager(DOT_IN.arg(this->m_related->getTable(), m_ownerKey),
-                           getEagerModelKeys(models));
+                           keys);
     }
 
     template<class Model, class Related>
@@ -5,6 +5,7 @@
 #include "orm/macros/systemheader.hpp"
 TINY_SYSTEM_HEADER
 
+#include <QUuid>
 #include <QtSql/QSqlRecord>
 
 #include <range/v3/view/set_algorithm.hpp>
@@ -126,6 +127,16 @@ namespace Concerns
         /*! Sync the intermediate tables with a vector of IDs without detaching. */
         inline SyncChanges syncWithoutDetaching(const QVector<QVariant> &ids) const;
 
+        /*! Sync the intermediate table with a vector of IDs, the difference is computed
+            by the database (IDs are staged in a temporary table). */
+        SyncChanges syncBulk(const QVector<QVariant> &ids, bool detaching = true) const;
+        /*! Sync the intermediate table with a vector of IDs without detaching,
+            the difference is computed by the database. */
+        inline SyncChanges syncBulkWithoutDetaching(const QVector<QVariant> &ids) const;
+        /*! Toggle a vector of IDs on the intermediate table, the difference is computed
+            by the database. */
+        SyncChanges toggle(const QVector<QVariant> &ids, bool touch = true) const;
+
         /*! Detach models from the relationship. */
         inline int detach(const QVector<QVariant> &ids, bool touch = true) const;
         /*! Detach models from the relationship. */
@@ -142,6 +153,10 @@ namespace Concerns
         int updateExistingPivot(const QVariant &id,
                                 QVector<AttributeItem> attributes,
                                 bool touch = true) const;
+        /*! Update existing pivot records on the table for a vector of IDs. */
+        int updateExistingPivot(const QVector<QVariant> &ids,
+                                QVector<AttributeItem> attributes,
+                                bool touch = true) const;
         /*! Update an existing pivot record on the table. */
         int updateExistingPivot(const Related &model,
                                 const QVector<AttributeItem> &attributes,
@@ -220,11 +235,34 @@ namespace Concerns
         /*! Convert IDs vector to the map with attributes keyed by IDs. */
         std::map<RelatedKeyType, QVector<AttributeItem>>
         recordsFromIds(const QVector<QVariant> &ids) const;
+
         /*! Convert IDs vector to the map with attributes keyed by IDs. */
         QVector<QVariant>
         idsFromRecords(const std::map<RelatedKeyType,
                                       QVector<AttributeItem>> &idsWithAttributes) const;
 
+        /*! Column name that marks the staged IDs that are already attached. */
+        inline static const QString StagedAttached = QStringLiteral("attached");
+
+        /*! Stage the given IDs in the temporary table, mark the attached ones, and
+            invoke the callback in the transaction. */
+        SyncChanges
+        withStagedIds(const QVector<QVariant> &ids,
+                      const std::function<SyncChanges(const QString &)> &callback) const;
+        /*! Drop the temporary table with staged IDs. */
+        static void dropStagingTable(DatabaseConnection &connection,
+                                     const QString &stagingTable);
+        /*! Get a new query for the staged IDs that are or aren't attached. */
+        std::shared_ptr<QueryBuilder>
+        newStagedIdsQuery(const QString &stagingTable, bool attached) const;
+        /*! Get a new pivot query for the related IDs that are or aren't staged. */
+        std::shared_ptr<QueryBuilder>
+        newPivotQueryForStaged(const QString &stagingTable, bool staged) const;
+        /*! Attach the given IDs using chunked multi-row inserts. */
+        void attachInChunks(const QVector<QVariant> &ids) const;
+        /*! Cast the given IDs selected from the database to the RelatedKeyType. */
+        QVector<QVariant> castRelatedKeys(QVector<QVariant> &&ids) const;
+
         /*! Cast the given pivot attributes. */
         const QVector<AttributeItem> &
         castAttributes(const QVector<AttributeItem> &attributes) const
@@ -514,6 +552,87 @@ namespace Concerns
         return sync(ids, false);
     }
 
+    template<class Model, class Related, class PivotType>
+    SyncChanges
+    InteractsWithPivotTable<Model, Related, PivotType>::syncBulk(
+            const QVector<QVariant> &ids, const bool detaching) const
+    {
+        auto changes = withStagedIds(ids, [this, detaching]
+                                          (const QString &stagingTable)
+        {
+            SyncChanges changes;
+
+            /* Detach all the attached models that aren't in the given IDs, only IDs
+               that will be detached are transferred from the database. */
+            if (detaching) {
+                changes.detached() = castRelatedKeys(
+                                         newPivotQueryForStaged(stagingTable, false)
+                                         ->pluck(getRelatedPivotKeyName_()));
+
+                if (!changes.detached().isEmpty())
+                    newPivotQueryForStaged(stagingTable, false)->remove();
+            }
+
+            // Attach all the staged IDs that aren't attached
+            changes.attached() = castRelatedKeys(
+                                     newStagedIdsQuery(stagingTable, false)
+                                     ->pluck(Constants::ID));
+
+            attachInChunks(changes.attached());
+
+            return changes;
+        });
+
+        // The same as the sync(), the detach-only change doesn't touch the parent
+        if (!changes.attached().isEmpty())
+            touchIfTouching_();
+
+        return changes;
+    }
+
+    template<class Model, class Related, class PivotType>
+    SyncChanges
+    InteractsWithPivotTable<Model, Related, PivotType>::syncBulkWithoutDetaching(
+            const QVector<QVariant> &ids) const
+    {
+        return syncBulk(ids, false);
+    }
+
+    template<class Model, class Related, class PivotType>
+    SyncChanges
+    InteractsWithPivotTable<Model, Related, PivotType>::toggle(
+            const QVector<QVariant> &ids, const bool touch) const
+    {
+        auto changes = withStagedIds(ids, [this](const QString &stagingTable)
+        {
+            SyncChanges changes;
+
+            /* The attached flag of the staged IDs is computed before the detaching,
+               so the order of the following queries doesn't matter. */
+            changes.detached() = castRelatedKeys(
+                                     newStagedIdsQuery(stagingTable, true)
+                                     ->pluck(Constants::ID));
+
+            if (!changes.detached().isEmpty())
+                newPivotQueryForStaged(stagingTable, true)->remove();
+
+            changes.attached() = castRelatedKeys(
+                                     newStagedIdsQuery(stagingTable, false)
+                                     ->pluck(Constants::ID));
+
+            attachInChunks(changes.attached());
+
+            return changes;
+        });
+
+        if (touch &&
+            (!changes.attached().isEmpty() || !changes.detached().isEmpty())
+        )
+            touchIfTouching_();
+
+        return changes;
+    }
+
     template<class Model, class Related, class PivotType>
     int InteractsWithPivotTable<Model, Related, PivotType>::detach(
             const QVector<QVariant> &ids, const bool touch) const
@@ -585,6 +704,43 @@ namespace Concerns
         return updated;
     }
 
+    template<class Model, class Related, class PivotType>
+    int InteractsWithPivotTable<Model, Related, PivotType>::updateExistingPivot(
+            const QVector<QVariant> &ids, QVector<AttributeItem> attributes,
+            const bool touch) const
+    {
+        // Nothing to update
+        if (ids.isEmpty() || attributes.isEmpty())
+            return 0;
+
+        // The custom pivot is updated through the custom class model by model
+        if (!std::is_same_v<PivotType, Pivot>) {
+            int updated = 0;
+
+            for (const auto &id : ids)
+                updated += updateExistingPivotUsingCustomClass(id, attributes, false);
+
+            if (touch && updated > 0)
+                touchIfTouching_();
+
+            return updated;
+        }
+
+        if (hasPivotColumn(updatedAt_()))
+            addTimestampsToAttachment(attributes, true);
+
+        // All the pivot records are updated using one query
+        int updated = -1;
+        std::tie(updated, std::ignore) =
+                newPivotStatementForId(ids)->update(
+                    AttributeUtils::convertVectorToUpdateItem(std::move(attributes)));
+
+        if (touch)
+            touchIfTouching_();
+
+        return updated;
+    }
+
     template<class Model, class Related, class PivotType>
     int InteractsWithPivotTable<Model, Related, PivotType>::updateExistingPivot(
             const Related &model, const QVector<AttributeItem> &attributes,
@@ -966,6 +1122,198 @@ namespace Concerns
         return ids;
     }
 
+    template<class Model, class Related, class PivotType>
+    SyncChanges
+    InteractsWithPivotTable<Model, Related, PivotType>::withStagedIds(
+            const QVector<QVariant> &ids,
+            const std::function<SyncChanges(const QString &)> &callback) const
+    {
+        /*! Cast the primary key to the Related::KeyType, for ranges::sort(). */
+        const auto castKey = [this](const auto &id)
+        {
+            return this->template castKey<RelatedKeyType>(id);
+        };
+
+        /* Temporary tables are visible only to the current database session, the unique
+           name avoids the collision with a real table or a table left over after
+           a failed sync in a transaction. */
+        const auto stagingTable = QStringLiteral("tiny_pivot_staged_%1")
+                                  .arg(QUuid::createUuid().toString(QUuid::Id128));
+
+        // Duplicate IDs would violate the primary key of the staging table
+        auto uniqueIds = ids;
+        std::ranges::sort(uniqueIds, {}, castKey);
+        const auto [first, last] = std::ranges::unique(uniqueIds, {}, castKey);
+        uniqueIds.erase(first, last);
+
+        auto &connection = getBaseQuery_().getConnection();
+
+        // Don't touch the transaction started by a caller
+        const auto ownsTransaction = !connection.inTransaction();
+
+        if (ownsTransaction)
+            connection.beginTransaction();
+
+        SyncChanges changes;
+
+        try {
+            connection.getSchemaBuilder().create(stagingTable, [](auto &table)
+            {
+                table.temporary();
+
+                // The staged IDs column type must match the related model's key type
+                if constexpr (!std::is_integral_v<RelatedKeyType>)
+                    table.string(Constants::ID).primary();
+                else if constexpr (std::is_signed_v<RelatedKeyType>)
+                    table.bigInteger(Constants::ID).primary();
+                else
+                    table.unsignedBigInteger(Constants::ID).primary();
+
+                table.boolean(StagedAttached).defaultValue(false);
+            });
+
+            /* Stage the IDs, keep the number of placeholders in one insert statement
+               under the database limit, every staged row has one placeholder. */
+            const auto chunkSize = std::max<QVector<QVariant>::size_type>(
+                                       1, connection.getQueryGrammar()
+                                          .getMaxPlaceholders());
+
+            for (QVector<QVariant>::size_type i = 0; i < uniqueIds.size();
+                 i += chunkSize
+            ) {
+                QVector<QVariantMap> values;
+                values.reserve(std::min(chunkSize, uniqueIds.size() - i));
+
+                for (auto &&id : uniqueIds.mid(i, chunkSize))
+                    values.append(QVariantMap {{Constants::ID, std::move(id)}});
+
+                getBaseQuery_().newQuery()->from(stagingTable).insert(values);
+            }
+
+            // Mark the staged IDs that are already attached
+            getBaseQuery_().newQuery()->from(stagingTable)
+                    .whereExists([this, &stagingTable](QueryBuilder &query)
+            {
+                query.from(getTable_())
+                        .whereEq(getForeignPivotKeyName_(),
+                                 getParent_().getAttribute(getParentKeyName_()))
+                        .whereColumnEq(qualifyPivotColumn_(getRelatedPivotKeyName_()),
+                                       QStringLiteral("%1.%2").arg(stagingTable,
+                                                                   Constants::ID));
+            })
+                    .update({{StagedAttached, true}});
+
+            changes = std::invoke(callback, stagingTable);
+
+            dropStagingTable(connection, stagingTable);
+
+        } catch (...) {
+            if (ownsTransaction && connection.inTransaction())
+                connection.rollBack();
+
+            throw;
+        }
+
+        if (ownsTransaction)
+            connection.commit();
+
+        return changes;
+    }
+
+    template<class Model, class Related, class PivotType>
+    void InteractsWithPivotTable<Model, Related, PivotType>::dropStagingTable(
+            DatabaseConnection &connection, const QString &stagingTable)
+    {
+        const auto &grammar = connection.getQueryGrammar();
+        const auto &driverName = connection.driverName();
+
+        /* MySQL commits the current transaction implicitly after the DROP TABLE,
+           except the TEMPORARY keyword is used. PostgreSQL and SQLite don't have
+           the DROP TEMPORARY TABLE, the table name is qualified by the temporary
+           schema so a real table with the same name is never dropped. */
+        QString table;
+
+        if (driverName == Constants::QPSQL)
+            table = QStringLiteral("%1.%2").arg(grammar.wrap(QStringLiteral("pg_temp")),
+                                                grammar.wrapTable(stagingTable));
+        else if (driverName == Constants::QSQLITE)
+            table = QStringLiteral("%1.%2").arg(grammar.wrap(QStringLiteral("temp")),
+                                                grammar.wrapTable(stagingTable));
+        else
+            table = grammar.wrapTable(stagingTable);
+
+        connection.statement(
+                    QStringLiteral("drop %1table if exists %2")
+                    .arg(driverName == Constants::QMYSQL ? QStringLiteral("temporary ")
+                                                         : QString(),
+                         table));
+    }
+
+    template<class Model, class Related, class PivotType>
+    std::shared_ptr<QueryBuilder>
+    InteractsWithPivotTable<Model, Related, PivotType>::newStagedIdsQuery(
+            const QString &stagingTable, const bool attached) const
+    {
+        // Ownership of the std::shared_ptr<QueryBuilder>
+        auto query = getBaseQuery_().newQuery();
+
+        query->from(stagingTable).whereEq(StagedAttached, attached);
+
+        return query;
+    }
+
+    template<class Model, class Related, class PivotType>
+    std::shared_ptr<QueryBuilder>
+    InteractsWithPivotTable<Model, Related, PivotType>::newPivotQueryForStaged(
+            const QString &stagingTable, const bool staged) const
+    {
+        // Ownership of the std::shared_ptr<QueryBuilder>
+        auto query = newPivotQuery();
+
+        query->whereExists([this, &stagingTable](QueryBuilder &subQuery)
+        {
+            subQuery.from(stagingTable)
+                    .whereColumnEq(QStringLiteral("%1.%2").arg(stagingTable,
+                                                               Constants::ID),
+                                   qualifyPivotColumn_(getRelatedPivotKeyName_()));
+        },
+            Constants::AND, !staged);
+
+        return query;
+    }
+
+    template<class Model, class Related, class PivotType>
+    void InteractsWithPivotTable<Model, Related, PivotType>::attachInChunks(
+            const QVector<QVariant> &ids) const
+    {
+        using SizeType = QVector<QVariant>::size_type;
+
+        // The same columns as in the formatAttachRecords(), 2 keys and the timestamps
+        const auto columnsCount =
+                2 + static_cast<SizeType>(hasPivotColumn(createdAt_())) +
+                static_cast<SizeType>(hasPivotColumn(updatedAt_()));
+
+        // Keep the number of placeholders in one insert statement under the limit
+        const auto chunkSize = std::max<SizeType>(
+                                   1, getBaseQuery_().getConnection().getQueryGrammar()
+                                      .getMaxPlaceholders() / columnsCount);
+
+        for (SizeType i = 0; i < ids.size(); i += chunkSize)
+            attach(ids.mid(i, chunkSize), {}, false);
+    }
+
+    template<class Model, class Related, class PivotType>
+    QVector<QVariant>
+    InteractsWithPivotTable<Model, Related, PivotType>::castRelatedKeys(
+            QVector<QVariant> &&ids) const
+    {
+        // The same key type as the IDs returned by the sync()
+        for (auto &id : ids)
+            id = QVariant::fromValue(this->template castKey<RelatedKeyType>(id));
+
+        return std::move(ids);
+    }
+
     /* These castAttributes() has very weird params/return values, but they are ok and
        as effective as can be, I'm going to describe every overload to be more clear. */
 
@@ -104,7 +104,7 @@ namespace Relations
         getResults() const = 0;
 
         /*! Get the relationship for eager loading. */
-        inline ModelsCollection<Related> getEager() const;
+        inline virtual ModelsCollection<Related> getEager() const;
         /*! Execute the query as a "select" statement. */
         inline virtual ModelsCollection<Related>
         get(const QVector<Column> &columns = {ASTERISK}) const;
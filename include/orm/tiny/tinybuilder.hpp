@@ -10,10 +10,12 @@ TINY_SYSTEM_HEADER
 #include <range/v3/action/transform.hpp>
 
 #include "orm/databaseconnection.hpp"
+#include "orm/support/connectionworkers.hpp"
 #include "orm/tiny/concerns/buildsqueries.hpp"
 #include "orm/tiny/concerns/buildssoftdeletes.hpp"
 #include "orm/tiny/concerns/queriesrelationships.hpp"
 #include "orm/tiny/exceptions/modelnotfounderror.hpp"
+#include "orm/tiny/identitymap.hpp"
 #include "orm/tiny/tinybuilderproxies.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -280,6 +282,20 @@ namespace Orm::Tiny
         inline void
         onDelete(std::function<std::tuple<int, QSqlQuery>(Builder<Model> &)> &&callback);
 
+        /*! Determine whether the query can be served from the identity map (it isn't
+            constrained by any where clause or the SoftDeletes scope). */
+        bool isServableFromIdentityMap(const QVector<Column> &columns = {ASTERISK}) const;
+
+        /* Async queries */
+        /*! Execute the query as a "select" statement on the connection's worker
+            thread. */
+        QFuture<ModelsCollection<Model>>
+        getAsync(const QVector<Column> &columns = {ASTERISK}) const;
+        /*! Execute the query and get the first result on the connection's worker
+            thread. */
+        QFuture<std::optional<Model>>
+        firstAsync(const QVector<Column> &columns = {ASTERISK}) const;
+
         /* BuildsSoftDeletes */
         /*! Apply the SoftDeletes where null condition for the deleted_at column. */
         Builder<Model> &applySoftDeletes();
@@ -290,6 +306,11 @@ namespace Orm::Tiny
         /*! Alias for the Expression. */
         using Expression = Orm::Query::Expression;
 
+        /*! Invoke the callback with a copy of this builder on the connection's worker
+            thread. */
+        template<typename F>
+        auto runAsync(F &&callback) const;
+
         /*! Get the default key name of the table. */
         inline const QString &defaultKeyName() const;
 
@@ -514,7 +535,23 @@ namespace Orm::Tiny
     std::optional<Model>
     Builder<Model>::find(const QVariant &id, const QVector<Column> &columns)
     {
-        return whereKey(id).first(columns);
+        // Consult the identity map first if the unit of work is active
+        auto *const identityMap = isServableFromIdentityMap(columns)
+                                  ? IdentityMap::current() : nullptr;
+
+        if (identityMap != nullptr)
+            if (auto model = identityMap->template find<Model>(
+                                 getConnection().getName(), id);
+                model
+            )
+                return model;
+
+        auto model = whereKey(id).first(columns);
+
+        if (identityMap != nullptr && model)
+            identityMap->remember(*model);
+
+        return model;
     }
 
     template<typename Model>
@@ -618,6 +655,28 @@ namespace Orm::Tiny
         return std::move(models.first());
     }
 
+    /* Async queries */
+
+    template<typename Model>
+    QFuture<ModelsCollection<Model>>
+    Builder<Model>::getAsync(const QVector<Column> &columns) const
+    {
+        return runAsync([columns](Builder<Model> &builder)
+        {
+            return builder.get(columns);
+        });
+    }
+
+    template<typename Model>
+    QFuture<std::optional<Model>>
+    Builder<Model>::firstAsync(const QVector<Column> &columns) const
+    {
+        return runAsync([columns](Builder<Model> &builder)
+        {
+            return builder.first(columns);
+        });
+    }
+
     template<typename Model>
     Model
     Builder<Model>::firstOrNew(const QVector<WhereItem> &attributes,
@@ -1122,6 +1181,13 @@ namespace Orm::Tiny
            ordering (where, orderBy, and maybe more). */
         auto nested = relationsNestedUnder(relationItem.name);
 
+        /* Constrained or nested eager loads can't be served from the identity map,
+           the related models would be incomplete. */
+        std::optional<IdentityMap::Suspended> identityMapSuspended;
+
+        if (IdentityMap::isActive() && (relationItem.constraints || !nested.isEmpty()))
+            identityMapSuspended.emplace();
+
         /* If there are nested relationships set on this query, we will put those onto
            the relation's query instance so they can be handled after this relationship
            is loaded. In this way they will all trickle down as they are loaded. */
@@ -1152,21 +1218,30 @@ namespace Orm::Tiny
         models.reserve(static_cast<decltype (models)::size_type>(
                            QueryUtils::queryResultSize(result)));
 
-        const auto fieldsCount = result.record().count();
+        // Field names are the same for all rows, don't create the record for every row
+        const auto record = result.record();
+        const auto fieldsCount = record.count();
 
         while (result.next()) {
             QVector<AttributeItem> row;
             row.reserve(fieldsCount);
 
             // Populate model attributes with data from the database (one table row)
-            const auto record = result.record();
-            for (int i = 0; i < record.count(); ++i)
+            for (int i = 0; i < fieldsCount; ++i)
                 row.append({record.fieldName(i), result.value(i)});
 
             // Create a new model instance from the table row
             models << instance.newFromBuilder(std::move(row));
         }
 
+        /* Lazy loading a relation on every model of the collection is the N+1 problem,
+           a single model can't cause it. */
+        if (models.size() > 1 && (Model::preventsLazyLoading() ||
+                                  Model::getUserPreventsLazyLoading())
+        )
+            for (auto &model : models)
+                model.m_preventsLazyLoading = true;
+
         return models;
     }
 
@@ -1225,6 +1300,26 @@ namespace Orm::Tiny
         m_onDelete = std::move(callback);
     }
 
+    template<typename Model>
+    bool
+    Builder<Model>::isServableFromIdentityMap(const QVector<Column> &columns) const
+    {
+        /* The default SoftDeletes constraint is applied lazily, so it isn't
+           in the wheres yet. */
+        if constexpr (m_extendsSoftDeletes)
+            if (this->m_withSoftDeletes)
+                return false;
+
+        /* Only whole models without eager loaded relations can be served, and the query
+           must not be constrained, the cached model could not satisfy these
+           constraints. */
+        return IdentityMap::isActive() &&
+               columns == QVector<Column> {ASTERISK} && m_eagerLoad.isEmpty() &&
+               m_query->getColumns().isEmpty() && m_query->getWheres().isEmpty() &&
+               m_query->getJoins().isEmpty() &&
+               std::holds_alternative<std::monostate>(m_query->getLock());
+    }
+
     /* BuildsSoftDeletes */
 
     template<typename Model>
@@ -1250,6 +1345,28 @@ namespace Orm::Tiny
         return m_model.getKeyName();
     }
 
+    template<typename Model>
+    template<typename F>
+    auto Builder<Model>::runAsync(F &&callback) const
+    {
+        /* Copy the builder and its query now, the caller can continue to modify them,
+           the QtSql connection can't be used from other threads, so the copied query
+           is executed using the thread-local connection of the worker thread. Eager
+           loaded relations are also queried on the worker thread. */
+        auto builder = std::make_shared<Builder<Model>>(*this);
+        builder->m_query = std::make_shared<QueryBuilder>(*m_query);
+
+        return Support::ConnectionWorkers::run(
+                    m_query->getConnection().getName(),
+                    [builder = std::move(builder), callback = std::forward<F>(callback)]
+                    (DatabaseConnection &connection) mutable
+        {
+            builder->m_query->m_connection = connection.shared_from_this();
+
+            return std::invoke(callback, *builder);
+        });
+    }
+
     template<typename Model>
     QVector<WithItem>
     Builder<Model>::parseWithRelations(const QVector<WithItem> &relations)
@@ -188,6 +188,35 @@ namespace Tiny
         /*! Force the query to only return distinct results. */
         TinyBuilder<Model> &distinct(QStringList &&columns);
 
+        /* Common table expressions */
+        /*! Add a common table expression (with clause) to the query. */
+        template<SubQuery T>
+        TinyBuilder<Model> &withExpression(const QString &name, T &&query,
+                                           const QStringList &columns = {},
+                                           bool recursive = false);
+        /*! Add a recursive common table expression (with recursive clause) to
+            the query. */
+        template<SubQuery T>
+        TinyBuilder<Model> &withRecursiveExpression(const QString &name, T &&query,
+                                                    const QStringList &columns = {});
+
+        /* Unions */
+        /*! Add a union statement to the query. */
+        template<Queryable T>
+        TinyBuilder<Model> &union_(T &&query, bool all = false);
+        /*! Add a union statement to the query. */
+        TinyBuilder<Model> &union_(const std::shared_ptr<QueryBuilder> &query,
+                                   bool all = false);
+        /*! Add a union statement to the query (applies the query's scopes). */
+        TinyBuilder<Model> &union_(TinyBuilder<Model> &query, bool all = false);
+        /*! Add a union all statement to the query. */
+        template<Queryable T>
+        TinyBuilder<Model> &unionAll(T &&query);
+        /*! Add a union all statement to the query. */
+        TinyBuilder<Model> &unionAll(const std::shared_ptr<QueryBuilder> &query);
+        /*! Add a union all statement to the query (applies the query's scopes). */
+        TinyBuilder<Model> &unionAll(TinyBuilder<Model> &query);
+
         /* Joins */
         /*! Add a join clause to the query. */
         template<JoinTable T>
@@ -671,6 +700,14 @@ namespace Tiny
         /*! Lock the selected rows in the table. */
         TinyBuilder<Model> &lock(QString &&value);
 
+        /* Query timeout */
+        /*! Set the statement timeout in milliseconds for the query (0 for no timeout). */
+        TinyBuilder<Model> &timeout(int milliseconds);
+
+        /* Query cache */
+        /*! Cache the query result for the given number of seconds. */
+        TinyBuilder<Model> &remember(int seconds);
+
         /* Others proxy methods, not added to the Model and Relation */
         /*! Add an "exists" clause to the query. */
         TinyBuilder<Model> &
@@ -1049,6 +1086,82 @@ namespace Tiny
         return builder();
     }
 
+    /* Common table expressions */
+
+    template<typename Model>
+    template<SubQuery T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::withExpression(
+            const QString &name, T &&query, const QStringList &columns,
+            const bool recursive)
+    {
+        getQuery().withExpression(name, std::forward<T>(query), columns, recursive);
+        return builder();
+    }
+
+    template<typename Model>
+    template<SubQuery T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::withRecursiveExpression(
+            const QString &name, T &&query, const QStringList &columns)
+    {
+        getQuery().withRecursiveExpression(name, std::forward<T>(query), columns);
+        return builder();
+    }
+
+    /* Unions */
+
+    template<typename Model>
+    template<Queryable T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::union_(T &&query, const bool all)
+    {
+        getQuery().union_(std::forward<T>(query), all);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::union_(const std::shared_ptr<QueryBuilder> &query,
+                                  const bool all)
+    {
+        getQuery().union_(query, all);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::union_(TinyBuilder<Model> &query, const bool all)
+    {
+        getQuery().union_(query.toBase(), all);
+        return builder();
+    }
+
+    template<typename Model>
+    template<Queryable T>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::unionAll(T &&query)
+    {
+        getQuery().unionAll(std::forward<T>(query));
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::unionAll(const std::shared_ptr<QueryBuilder> &query)
+    {
+        getQuery().unionAll(query);
+        return builder();
+    }
+
+    template<typename Model>
+    TinyBuilder<Model> &
+    BuilderProxies<Model>::unionAll(TinyBuilder<Model> &query)
+    {
+        getQuery().unionAll(query.toBase());
+        return builder();
+    }
+
     /* Joins */
 
     template<typename Model>
@@ -2244,6 +2357,24 @@ namespace Tiny
         return builder();
     }
 
+    /* Query timeout */
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::timeout(const int milliseconds)
+    {
+        getQuery().timeout(milliseconds);
+        return builder();
+    }
+
+    /* Query cache */
+
+    template<typename Model>
+    TinyBuilder<Model> &BuilderProxies<Model>::remember(const int seconds)
+    {
+        getQuery().remember(seconds);
+        return builder();
+    }
+
     /* Others proxy methods, not added to the Model and Relation */
 
     template<typename Model>
@@ -8,6 +8,10 @@ TINY_SYSTEM_HEADER
 #include <QJsonArray>
 #include <QJsonDocument>
 
+#include <algorithm>
+#include <future>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
 
 #include <range/v3/action/erase.hpp>
@@ -18,6 +22,7 @@ TINY_SYSTEM_HEADER
 #include <range/v3/view/transform.hpp>
 
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/tiny/types/modelskeyedview.hpp"
 #include "orm/tiny/utils/attribute.hpp"
 #include "orm/utils/type.hpp"
 
@@ -259,6 +264,8 @@ namespace Types
 
         /*! Run an associative map over each of the models (keyed by primary key). */
         std::unordered_map<KeyType, ModelRawType *> mapWithModelKeys();
+        /*! Get the primary key index (view) for repeated O(1) key lookups. */
+        inline ModelsKeyedView<ModelRawType> keyBy();
         /*! Run an associative map over each of the models (key by the K template). */
         template<typename K, typename V>
         std::unordered_map<K, V>
@@ -320,14 +327,15 @@ namespace Types
         ModelsCollection<ModelRawType *>
         sortDesc(C comparison = C{}, P projection = P{});
 
-        /*! Sort the collection by the given column. */
+        /*! Sort the collection by the given column (optionally using multiple
+            threads). */
         template<typename T>
         ModelsCollection<ModelRawType *>
-        sortBy(const QString &column, bool descending = false);
+        sortBy(const QString &column, bool descending = false, bool parallel = false);
         /*! Sort the collection by the given column in descending order. */
         template<typename T>
         ModelsCollection<ModelRawType *>
-        sortByDesc(const QString &column);
+        sortByDesc(const QString &column, bool parallel = false);
 
         /*! Sort the collection by the given callback (supports multi-columns sorting). */
         ModelsCollection<ModelRawType *>
@@ -354,14 +362,16 @@ namespace Types
         ModelsCollection<ModelRawType *>
         stableSortDesc(C comparison = C{}, P projection = P{});
 
-        /*! Stable sort the collection by the given column. */
+        /*! Stable sort the collection by the given column (optionally using multiple
+            threads). */
         template<typename T>
         ModelsCollection<ModelRawType *>
-        stableSortBy(const QString &column, bool descending = false);
+        stableSortBy(const QString &column, bool descending = false,
+                     bool parallel = false);
         /*! Stable sort the collection by the given column in descending order. */
         template<typename T>
         ModelsCollection<ModelRawType *>
-        stableSortByDesc(const QString &column);
+        stableSortByDesc(const QString &column, bool parallel = false);
 
         /*! Sort the collection by the given callback (supports multi-columns sorting). */
         ModelsCollection<ModelRawType *>
@@ -429,6 +439,12 @@ namespace Types
         /*! Load a set of relationships onto the collection. */
         inline ModelsCollection &load(QVector<QString> &&relations) &&;
 
+        /*! Save all models using batched queries (multi-row inserts and prepared
+            updates grouped by the changed columns). */
+        inline bool saveAll(SaveOptions options = {});
+        /*! Save all models and all of their relationships. */
+        inline bool pushAll();
+
         /* EnumeratesValues */
         /*! Get the vector of models as a attributes vector with serialized models. */
         template<typename PivotType = void> // PivotType is primarily internal
@@ -591,6 +607,22 @@ namespace Types
         /*! Return a model copy. */
         inline static ModelRawType getModelCopy(const ModelRawType *model);
 
+        /*! Extract values of the given column from all models (sort keys). */
+        template<typename T>
+        std::vector<T> extractSortKeys(const QString &column) const;
+        /*! Get the model indices sorted by the given extracted sort keys. */
+        template<typename T>
+        static std::vector<size_type>
+        sortedIndices(const std::vector<T> &keys, bool descending, bool stable,
+                      bool parallel);
+        /*! Sort the given indices using multiple threads (merges sorted chunks). */
+        template<typename C>
+        static void parallelSort(std::vector<size_type> &indices, C comparison,
+                                 bool stable);
+        /*! Convert to the Collection<ModelRawType *> ordered by the given indices. */
+        ModelsCollection<ModelRawType *>
+        toPointersCollection(const std::vector<size_type> &indices);
+
         /*! Throw if the given operator is not valid for the where() method. */
         static void throwIfInvalidWhereOperator(const QString &comparison);
     };
@@ -1134,13 +1166,21 @@ namespace Types
                        typename ModelsCollection<Model>::ModelRawType *>
     ModelsCollection<Model>::mapWithModelKeys()
     {
-        return *this
-                | ranges::views::transform(
-                    [](ModelLoopType model) -> std::pair<KeyType, ModelRawType *>
-        {
-            return {getKeyCasted(model), toPointer(model)};
-        })
-                | ranges::to<std::unordered_map<KeyType, ModelRawType *>>();
+        std::unordered_map<KeyType, ModelRawType *> result;
+        result.reserve(static_cast<std::size_t>(this->size()));
+
+        // The first model wins if the collection contains the same model more times
+        for (ModelLoopType model : *this)
+            result.emplace(getKeyCasted(model), toPointer(model));
+
+        return result;
+    }
+
+    template<DerivedCollectionModel Model>
+    ModelsKeyedView<typename ModelsCollection<Model>::ModelRawType>
+    ModelsCollection<Model>::keyBy()
+    {
+        return ModelsKeyedView<ModelRawType>(mapWithModelKeys());
     }
 
     template<DerivedCollectionModel Model>
@@ -1413,34 +1453,26 @@ namespace Types
     template<DerivedCollectionModel Model>
     template<typename T>
     ModelsCollection<typename ModelsCollection<Model>::ModelRawType *>
-    ModelsCollection<Model>::sortBy(const QString &column, const bool descending)
+    ModelsCollection<Model>::sortBy(const QString &column, const bool descending,
+                                    const bool parallel)
     {
         // Nothing to do
         if (this->isEmpty())
             return {};
 
-        auto result = toPointersCollection();
-
-        ranges::sort(result, [&column, descending](const ModelRawType *const left,
-                                                   const ModelRawType *const right)
-        {
-            /* The XOR is like magic here, if the descending is false it behaves as if
-               it wasn't there, but if the descending is true it returns negated values,
-               the result is that it behaves as left > right if the descending is true.
-               Nice table at https://en.wikipedia.org/wiki/XOR_gate */
-            return descending ^ (left->template getAttribute<T>(column) <
-                                 right->template getAttribute<T>(column));
-        });
-
-        return result;
+        /* The column values are extracted only once and then the indices are sorted,
+           calling the getAttribute<T>() in the comparator would be O(n log n). */
+        return toPointersCollection(
+                    sortedIndices(extractSortKeys<T>(column), descending, false,
+                                  parallel));
     }
 
     template<DerivedCollectionModel Model>
     template<typename T>
     ModelsCollection<typename ModelsCollection<Model>::ModelRawType *>
-    ModelsCollection<Model>::sortByDesc(const QString &column)
+    ModelsCollection<Model>::sortByDesc(const QString &column, const bool parallel)
     {
-        return sortBy<T>(column, true);
+        return sortBy<T>(column, true, parallel);
     }
 
     template<DerivedCollectionModel Model>
@@ -1529,34 +1561,25 @@ namespace Types
     template<DerivedCollectionModel Model>
     template<typename T>
     ModelsCollection<typename ModelsCollection<Model>::ModelRawType *>
-    ModelsCollection<Model>::stableSortBy(const QString &column, const bool descending)
+    ModelsCollection<Model>::stableSortBy(const QString &column, const bool descending,
+                                          const bool parallel)
     {
         // Nothing to do
         if (this->isEmpty())
             return {};
 
-        auto result = toPointersCollection();
-
-        ranges::stable_sort(result, [&column, descending](const ModelRawType *const left,
-                                                          const ModelRawType *const right)
-        {
-            /* The XOR is like magic here, if the descending is false it behaves as if
-               it wasn't there, but if the descending is true it returns negated values,
-               the result is that it behaves as left > right if the descending is true.
-               Nice table at https://en.wikipedia.org/wiki/XOR_gate */
-            return descending ^ (left->template getAttribute<T>(column) <
-                                 right->template getAttribute<T>(column));
-        });
-
-        return result;
+        // The same as in the sortBy(), the column values are extracted only once
+        return toPointersCollection(
+                    sortedIndices(extractSortKeys<T>(column), descending, true,
+                                  parallel));
     }
 
     template<DerivedCollectionModel Model>
     template<typename T>
     ModelsCollection<typename ModelsCollection<Model>::ModelRawType *>
-    ModelsCollection<Model>::stableSortByDesc(const QString &column)
+    ModelsCollection<Model>::stableSortByDesc(const QString &column, const bool parallel)
     {
-        return stableSortBy<T>(column, true);
+        return stableSortBy<T>(column, true, parallel);
     }
 
     template<DerivedCollectionModel Model>
@@ -1628,26 +1651,27 @@ namespace Types
         if (this->isEmpty())
             return {};
 
-        auto result = toPointersCollection();
+        // The column values are extracted only once
+        const auto keys = extractSortKeys<T>(column);
+
+        std::vector<size_type> indices;
 
         if (sort)
-            ranges::sort(result, [&column](const ModelRawType *const left,
-                                           const ModelRawType *const right)
-            {
-                return left->template getAttribute<T>(column) <
-                       right->template getAttribute<T>(column);
-            });
-
-        const auto it = ranges::unique(result, [&column](const ModelRawType *const left,
-                                                         const ModelRawType *const right)
+            indices = sortedIndices(keys, false, false, false);
+        else {
+            indices.resize(keys.size());
+            std::iota(indices.begin(), indices.end(), 0);
+        }
+
+        const auto it = std::unique(indices.begin(), indices.end(),
+                                    [&keys](const size_type left, const size_type right)
         {
-            return left->template getAttribute<T>(column) ==
-                   right->template getAttribute<T>(column);
+            return keys[left] == keys[right];
         });
         // Remove duplicates from the end
-        ranges::erase(result, it, ranges::end(result));
+        indices.erase(it, indices.end());
 
-        return result;
+        return toPointersCollection(indices);
     }
 
     template<DerivedCollectionModel Model>
@@ -1841,6 +1865,18 @@ namespace Types
         return load(WithItem::fromStringVector(std::move(relations)));
     }
 
+    template<DerivedCollectionModel Model>
+    bool ModelsCollection<Model>::saveAll(const SaveOptions options)
+    {
+        return ModelRawType::saveMany(toPointersCollection(), options);
+    }
+
+    template<DerivedCollectionModel Model>
+    bool ModelsCollection<Model>::pushAll()
+    {
+        return ModelRawType::pushMany(toPointersCollection());
+    }
+
     /* EnumeratesValues */
 
     template<DerivedCollectionModel Model>
@@ -2409,6 +2445,120 @@ namespace Types
         return *model;
     }
 
+    template<DerivedCollectionModel Model>
+    template<typename T>
+    std::vector<T>
+    ModelsCollection<Model>::extractSortKeys(const QString &column) const
+    {
+        std::vector<T> keys;
+        keys.reserve(static_cast<std::size_t>(this->size()));
+
+        for (const auto &model : *this)
+            keys.push_back(toPointer(model)->template getAttribute<T>(column));
+
+        return keys;
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename T>
+    std::vector<typename ModelsCollection<Model>::size_type>
+    ModelsCollection<Model>::sortedIndices(
+            const std::vector<T> &keys, const bool descending, const bool stable,
+            const bool parallel)
+    {
+        std::vector<size_type> indices(keys.size());
+        std::iota(indices.begin(), indices.end(), 0);
+
+        const auto comparison = [&keys](const size_type left, const size_type right)
+        {
+            return keys[left] < keys[right];
+        };
+
+        if (parallel)
+            parallelSort(indices, comparison, stable);
+        else if (stable)
+            std::ranges::stable_sort(indices, comparison);
+        else
+            std::ranges::sort(indices, comparison);
+
+        /* The descending order is the reversed ascending order, so the equal models
+           are in the reversed order, the same as before for the stable sort. */
+        if (descending)
+            std::ranges::reverse(indices);
+
+        return indices;
+    }
+
+    template<DerivedCollectionModel Model>
+    template<typename C>
+    void ModelsCollection<Model>::parallelSort(
+            std::vector<size_type> &indices, C comparison, const bool stable)
+    {
+        /*! Minimum number of models per thread, smaller collections are sorted
+            on the current thread. */
+        constexpr std::size_t MinChunkSize = 4096;
+
+        const auto size = indices.size();
+        const auto threads = std::min<std::size_t>(
+                                 std::max(std::thread::hardware_concurrency(), 1U),
+                                 size / MinChunkSize);
+
+        const auto sortChunk = [&comparison, stable](const auto first, const auto last)
+        {
+            if (stable)
+                std::stable_sort(first, last, comparison);
+            else
+                std::sort(first, last, comparison);
+        };
+
+        // Nothing to parallelize
+        if (threads <= 1)
+            return sortChunk(indices.begin(), indices.end()); // clazy:exclude=returning-void-expression
+
+        const auto chunkSize = (size + threads - 1) / threads;
+
+        // Sort all chunks in parallel
+        std::vector<std::future<void>> futures;
+        futures.reserve(threads);
+
+        for (std::size_t first = 0; first < size; first += chunkSize)
+            futures.push_back(
+                    std::async(std::launch::async, sortChunk,
+                               indices.begin() + static_cast<std::ptrdiff_t>(first),
+                               indices.begin() + static_cast<std::ptrdiff_t>(
+                                   std::min(first + chunkSize, size))));
+
+        // Re-throw exceptions from the worker threads
+        for (auto &future : futures)
+            future.get();
+
+        // Merge the sorted chunks, the std::inplace_merge() is stable
+        for (auto width = chunkSize; width < size; width *= 2)
+            for (std::size_t first = 0; first + width < size; first += 2 * width)
+                std::inplace_merge(
+                        indices.begin() + static_cast<std::ptrdiff_t>(first),
+                        indices.begin() + static_cast<std::ptrdiff_t>(first + width),
+                        indices.begin() + static_cast<std::ptrdiff_t>(
+                            std::min(first + 2 * width, size)),
+                        comparison);
+    }
+
+    template<DerivedCollectionModel Model>
+    ModelsCollection<typename ModelsCollection<Model>::ModelRawType *>
+    ModelsCollection<Model>::toPointersCollection(
+            const std::vector<size_type> &indices)
+    {
+        const auto pointers = toPointersCollection();
+
+        ModelsCollection<ModelRawType *> result;
+        result.reserve(static_cast<size_type>(indices.size()));
+
+        for (const auto index : indices)
+            result.push_back(pointers.at(index));
+
+        return result;
+    }
+
     template<DerivedCollectionModel Model>
     void ModelsCollection<Model>::throwIfInvalidWhereOperator(const QString &comparison)
     {
@@ -2437,6 +2587,10 @@ namespace Types
     template<typename Model>
     using ModelsCollection = Tiny::Types::ModelsCollection<Model>;
 
+    /*! Alias for the ModelsKeyedView. */
+    template<typename Model>
+    using ModelsKeyedView = Tiny::Types::ModelsKeyedView<Model>;
+
 } // namespace Tiny
 
     /*! Instance of the EachBoolCallbackType. */
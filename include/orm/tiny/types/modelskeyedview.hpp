@@ -0,0 +1,137 @@
+#pragma once
+#ifndef ORM_TINY_TYPES_MODELSKEYEDVIEW_HPP
+#define ORM_TINY_TYPES_MODELSKEYEDVIEW_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+
+#include <unordered_map>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Types
+{
+
+    /*! Primary key index (view) over the models collection for O(1) key lookups.
+        The view doesn't own models, it's invalidated by every change
+        of the collection it was created from, the same as iterators. */
+    template<typename Model>
+    class ModelsKeyedView
+    {
+    public:
+        /*! The type of the model's primary key. */
+        using KeyType = typename Model::KeyType;
+        /*! The type of the primary key index. */
+        using IndexType = std::unordered_map<KeyType, Model *>;
+        /*! The type of the size. */
+        using size_type = typename IndexType::size_type;
+
+        /*! Default constructor. */
+        inline ModelsKeyedView() = default;
+        /*! Converting constructor from the primary key index. */
+        inline explicit ModelsKeyedView(IndexType &&index) noexcept;
+
+        /*! Find a model in the view by the given primary key. */
+        inline Model *find(KeyType id, Model *defaultModel = nullptr) const;
+        /*! Find a model in the view by the given primary key. */
+        inline Model *find(const QVariant &id, Model *defaultModel = nullptr) const;
+
+        /*! Determine if the view contains a model with the given primary key. */
+        inline bool contains(KeyType id) const;
+        /*! Determine if the view contains a model with the given primary key. */
+        inline bool contains(const QVariant &id) const;
+        /*! Determine if the view doesn't contain a model with the given primary key. */
+        inline bool doesntContain(KeyType id) const;
+        /*! Determine if the view doesn't contain a model with the given primary key. */
+        inline bool doesntContain(const QVariant &id) const;
+
+        /*! Get the number of the indexed models. */
+        inline size_type size() const noexcept;
+        /*! Determine whether the view is empty. */
+        inline bool isEmpty() const noexcept;
+
+        /*! Get the underlying primary key index. */
+        inline const IndexType &index() const noexcept;
+
+    private:
+        /*! Primary key index. */
+        IndexType m_index {};
+    };
+
+    /* public */
+
+    template<typename Model>
+    ModelsKeyedView<Model>::ModelsKeyedView(IndexType &&index) noexcept
+        : m_index(std::move(index))
+    {}
+
+    template<typename Model>
+    Model *ModelsKeyedView<Model>::find(const KeyType id, Model *const defaultModel) const
+    {
+        const auto it = m_index.find(id);
+
+        return it == m_index.cend() ? defaultModel : it->second;
+    }
+
+    template<typename Model>
+    Model *
+    ModelsKeyedView<Model>::find(const QVariant &id, Model *const defaultModel) const
+    {
+        // Don't handle the null and not valid
+        return find(id.template value<KeyType>(), defaultModel);
+    }
+
+    template<typename Model>
+    bool ModelsKeyedView<Model>::contains(const KeyType id) const
+    {
+        return m_index.contains(id);
+    }
+
+    template<typename Model>
+    bool ModelsKeyedView<Model>::contains(const QVariant &id) const
+    {
+        // Don't handle the null and not valid
+        return contains(id.template value<KeyType>());
+    }
+
+    template<typename Model>
+    bool ModelsKeyedView<Model>::doesntContain(const KeyType id) const
+    {
+        return !contains(id);
+    }
+
+    template<typename Model>
+    bool ModelsKeyedView<Model>::doesntContain(const QVariant &id) const
+    {
+        return !contains(id);
+    }
+
+    template<typename Model>
+    typename ModelsKeyedView<Model>::size_type
+    ModelsKeyedView<Model>::size() const noexcept
+    {
+        return m_index.size();
+    }
+
+    template<typename Model>
+    bool ModelsKeyedView<Model>::isEmpty() const noexcept
+    {
+        return m_index.empty();
+    }
+
+    template<typename Model>
+    const typename ModelsKeyedView<Model>::IndexType &
+    ModelsKeyedView<Model>::index() const noexcept
+    {
+        return m_index;
+    }
+
+} // namespace Orm::Tiny::Types
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TINY_TYPES_MODELSKEYEDVIEW_HPP
@@ -0,0 +1,49 @@
+#pragma once
+#ifndef ORM_TYPES_BATCHSTATEMENT_HPP
+#define ORM_TYPES_BATCHSTATEMENT_HPP
+
+#include <QVariant>
+#include <QtSql/QSqlError>
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Compiled SQL statement with its bindings, used by the batch execution. */
+    struct BatchStatement
+    {
+        /*! Compiled SQL query string (empty statements are skipped). */
+        QString query;
+        /*! Bindings for the query string. */
+        QVector<QVariant> bindings;
+    };
+
+    /*! Result of one statement executed by the batch execution. */
+    struct BatchResult
+    {
+        /*! Number of rows affected by the statement (-1 if not executed). */
+        int affected = -1;
+        /*! Determine whether the statement was executed successfully. */
+        bool executed = false;
+        /*! Database error, valid only if the statement failed. */
+        QSqlError error {};
+    };
+
+} // namespace Types
+
+    using BatchStatement = Types::BatchStatement;
+    using BatchResult    = Types::BatchResult;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_BATCHSTATEMENT_HPP
@@ -0,0 +1,149 @@
+#pragma once
+#ifndef ORM_TYPES_BINDINGSMAP_HPP
+#define ORM_TYPES_BINDINGSMAP_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+#include <QVector>
+
+#include <array>
+#include <span>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+
+    /*! Binding types. */
+    enum struct BindingType
+    {
+        EXPRESSIONS,
+        SELECT,
+        FROM,
+        JOIN,
+        WHERE,
+        GROUPBY,
+        HAVING,
+        ORDER,
+        UNION,
+        UNIONORDER,
+    };
+
+namespace Types
+{
+
+    /*! Query value bindings, all bindings are stored in one flat vector ordered by
+        the binding type, every binding type is a section delimited by the offsets.
+        Nothing is allocated until the first binding is added and the flattened
+        bindings are implicitly shared, they aren't copied on every query execution. */
+    class SHAREDLIB_EXPORT BindingsMap
+    {
+    public:
+        /*! Size type of the bindings vector. */
+        using size_type = QVector<QVariant>::size_type;
+
+        /*! Number of the binding types. */
+        constexpr static auto TypesCount =
+                static_cast<std::size_t>(BindingType::UNIONORDER) + 1;
+
+        /*! Get all bindings flattened in the binding type order. */
+        inline const QVector<QVariant> &flatten() const noexcept;
+        /*! Get a non-owning view of the bindings for the given type. */
+        inline std::span<const QVariant> operator[](BindingType type) const;
+        /*! Get a copy of the bindings for the given type. */
+        QVector<QVariant> value(BindingType type) const;
+
+        /*! Get the number of bindings for the given type. */
+        inline size_type size(BindingType type) const noexcept;
+        /*! Get the number of all bindings. */
+        inline size_type size() const noexcept;
+        /*! Determine whether there are no bindings. */
+        inline bool isEmpty() const noexcept;
+
+        /*! Append the binding to the given binding type. */
+        void append(BindingType type, const QVariant &binding);
+        /*! Append the binding to the given binding type. */
+        void append(BindingType type, QVariant &&binding);
+        /*! Append the bindings to the given binding type. */
+        void append(BindingType type, const QVector<QVariant> &bindings);
+        /*! Append the bindings to the given binding type. */
+        void append(BindingType type, QVector<QVariant> &&bindings);
+
+        /*! Replace all bindings of the given type. */
+        void set(BindingType type, QVector<QVariant> &&bindings);
+        /*! Remove all bindings of the given type. */
+        void clear(BindingType type);
+
+    private:
+        /*! Get the offset of the first binding for the given type. */
+        inline size_type sectionBegin(BindingType type) const noexcept;
+        /*! Get the offset past the last binding for the given type. */
+        inline size_type sectionEnd(BindingType type) const noexcept;
+        /*! Move the section ends of the given and all following types. */
+        void shiftSectionEnds(BindingType type, size_type count) noexcept;
+
+        /*! All bindings ordered by the binding type. */
+        QVector<QVariant> m_bindings;
+        /*! Offsets past the last binding for every binding type. */
+        std::array<size_type, TypesCount> m_sectionEnds {};
+    };
+
+    /* public */
+
+    const QVector<QVariant> &BindingsMap::flatten() const noexcept
+    {
+        return m_bindings;
+    }
+
+    std::span<const QVariant> BindingsMap::operator[](const BindingType type) const
+    {
+        return {m_bindings.constData() + sectionBegin(type),
+                static_cast<std::size_t>(size(type))};
+    }
+
+    BindingsMap::size_type BindingsMap::size(const BindingType type) const noexcept
+    {
+        return sectionEnd(type) - sectionBegin(type);
+    }
+
+    BindingsMap::size_type BindingsMap::size() const noexcept
+    {
+        return m_bindings.size();
+    }
+
+    bool BindingsMap::isEmpty() const noexcept
+    {
+        return m_bindings.isEmpty();
+    }
+
+    /* private */
+
+    BindingsMap::size_type
+    BindingsMap::sectionBegin(const BindingType type) const noexcept
+    {
+        const auto index = static_cast<std::size_t>(type);
+
+        return index == 0 ? 0 : m_sectionEnds[index - 1]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    BindingsMap::size_type
+    BindingsMap::sectionEnd(const BindingType type) const noexcept
+    {
+        return m_sectionEnds[static_cast<std::size_t>(type)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+} // namespace Types
+
+    /*! Type for the query value bindings. */
+    using BindingsMap = Types::BindingsMap;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_BINDINGSMAP_HPP
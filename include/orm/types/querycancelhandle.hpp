@@ -0,0 +1,75 @@
+#pragma once
+#ifndef ORM_TYPES_QUERYCANCELHANDLE_HPP
+#define ORM_TYPES_QUERYCANCELHANDLE_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QVariant>
+
+#include "orm/macros/commonnamespace.hpp"
+#include "orm/macros/export.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Handle used to cancel a query running on the database connection from
+        another thread. The handle is a copyable value, the cancel request is sent
+        using the calling thread's own connection with the same connection name. */
+    class SHAREDLIB_EXPORT QueryCancelHandle
+    {
+    public:
+        /*! Default constructor, creates an invalid handle. */
+        QueryCancelHandle() = default;
+        /*! Constructor. */
+        QueryCancelHandle(QString connection, QVariant backendId);
+
+        /*! Cancel the query currently running on the connection (thread-safe),
+            returns false if the database driver doesn't support cancellation. */
+        bool cancel() const;
+
+        /*! Determine whether the handle refers to a database connection. */
+        inline bool isValid() const noexcept;
+
+        /*! Get the connection name of the cancelled connection. */
+        inline const QString &getConnectionName() const noexcept;
+        /*! Get the database server's process ID of the cancelled connection. */
+        inline const QVariant &getBackendId() const noexcept;
+
+    private:
+        /*! Connection name of the cancelled connection. */
+        QString m_connection;
+        /*! Database server's process ID of the cancelled connection. */
+        QVariant m_backendId;
+    };
+
+    /* public */
+
+    bool QueryCancelHandle::isValid() const noexcept
+    {
+        return m_backendId.isValid();
+    }
+
+    const QString &QueryCancelHandle::getConnectionName() const noexcept
+    {
+        return m_connection;
+    }
+
+    const QVariant &QueryCancelHandle::getBackendId() const noexcept
+    {
+        return m_backendId;
+    }
+
+} // namespace Types
+
+    using QueryCancelHandle = Types::QueryCancelHandle;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_QUERYCANCELHANDLE_HPP
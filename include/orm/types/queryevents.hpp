@@ -0,0 +1,79 @@
+#pragma once
+#ifndef ORM_TYPES_QUERYEVENTS_HPP
+#define ORM_TYPES_QUERYEVENTS_HPP
+
+#include <QVariant>
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <functional>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Event dispatched after a query was executed, it only references the query data
+        so it's cheap to create, don't store it, copy the data you need instead. */
+    struct QueryExecutedEvent
+    {
+        /*! Executed query. */
+        const QString &query;
+        /*! Prepared bindings for the executed query. */
+        const QVector<QVariant> &bindings;
+        /*! Connection name on which the query was executed. */
+        const QString &connectionName;
+        /*! Query execution time in nanoseconds. */
+        qint64 elapsed = -1;
+        /*! Size of the result (number of rows returned). */
+        int results = -1;
+        /*! Number of rows affected by the query. */
+        int affected = -1;
+        /*! Type of the query (select, statement, affecting statement, ...). */
+        const QString &type;
+    };
+
+    /*! Event dispatched when the connection or transaction state changes. */
+    struct ConnectionEvent
+    {
+        /*! Type of the connection event. */
+        enum struct Type
+        {
+            /*! The physical connection to the database was established. */
+            CONNECTION_ESTABLISHED,
+            /*! The database transaction was started. */
+            TRANSACTION_BEGINNING,
+            /*! The database transaction was committed. */
+            TRANSACTION_COMMITTED,
+            /*! The database transaction was rolled back. */
+            TRANSACTION_ROLLED_BACK,
+        };
+
+        /*! Type of the connection event. */
+        Type type;
+        /*! Connection name on which the event occurred. */
+        const QString &connectionName;
+    };
+
+    /*! Listener invoked after a query was executed. */
+    using QueryListener = std::function<void(const QueryExecutedEvent &)>;
+    /*! Listener invoked when the connection or transaction state changes. */
+    using ConnectionEventListener = std::function<void(const ConnectionEvent &)>;
+
+} // namespace Types
+
+    using ConnectionEvent         = Types::ConnectionEvent;
+    using ConnectionEventListener = Types::ConnectionEventListener;
+    using QueryExecutedEvent      = Types::QueryExecutedEvent;
+    using QueryListener           = Types::QueryListener;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_QUERYEVENTS_HPP
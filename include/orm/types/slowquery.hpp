@@ -0,0 +1,53 @@
+#pragma once
+#ifndef ORM_TYPES_SLOWQUERY_HPP
+#define ORM_TYPES_SLOWQUERY_HPP
+
+#include "orm/macros/systemheader.hpp"
+TINY_SYSTEM_HEADER
+
+#include <QDateTime>
+#include <QVariant>
+
+#include <functional>
+
+#include "orm/macros/commonnamespace.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+namespace Types
+{
+
+    /*! Query that exceeded the slow query threshold, captured for later diagnosis. */
+    struct SlowQuery
+    {
+        /*! Executed query with placeholders. */
+        QString query;
+        /*! Prepared bindings for the executed query. */
+        QVector<QVariant> bindings;
+        /*! Connection name on which the query was executed. */
+        QString connectionName;
+        /*! Query execution time in nanoseconds. */
+        qint64 elapsed = -1;
+        /*! Time when the query finished (UTC). */
+        QDateTime executedAt;
+        /*! Query plan obtained by the EXPLAIN statement (empty if not explained). */
+        QString plan;
+        /*! Error message if the query failed (eg. cancelled by the query timeout). */
+        QString error;
+    };
+
+    /*! Callback invoked when the slow query was captured. */
+    using SlowQueryCallback = std::function<void(const SlowQuery &)>;
+
+} // namespace Types
+
+    using SlowQuery         = Types::SlowQuery;
+    using SlowQueryCallback = Types::SlowQueryCallback;
+
+} // namespace Orm
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // ORM_TYPES_SLOWQUERY_HPP
@@ -6,6 +6,7 @@
 TINY_SYSTEM_HEADER
 
 #include <QtSql/QSqlQuery>
+#include <QtSql/QSqlRecord>
 
 #include <optional>
 
@@ -55,6 +56,10 @@ namespace Types
         /*! Return the value of the field called name in the current record. */
         inline QVariant value(const QString &name) const;
 
+        /*! Fetch all remaining records, the values are prepared the same way as
+            the value() method does. */
+        QVector<QSqlRecord> fetchRecords();
+
     private:
         /*! Common value() method that correctly handles QDateTime's time zone. */
         QVariant valueInternal(QVariant &&value) const;
@@ -36,6 +36,10 @@ namespace Orm::Utils
         static void nameThreadForDebugging(
                 const char *threadName,
                 quint64 threadId = static_cast<quint64>(-1));
+
+        /*! Get an ordinal number of the current thread, unlike the thread ID it's never
+            reused by another thread. */
+        static quint64 currentThreadOrdinal();
     };
 
 } // namespace Orm::Utils
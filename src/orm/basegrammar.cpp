@@ -45,20 +45,38 @@ const QString &BaseGrammar::getDateFormat() const
 // NOLINTNEXTLINE(misc-no-recursion)
 QString BaseGrammar::wrap(const QString &value, const bool prefixAlias) const
 {
-    /* If the value being wrapped has a column alias we will need to separate out
-       the pieces so we can wrap each of the segments of the expression on its
-       own, and then join these both back together using the "as" connector. */
-    if (value.contains(QStringLiteral(" as ")))
-        return wrapAliasedValue(value, prefixAlias);
+    /* The set of identifiers in an application is small and wrapping them is
+       expensive, so the wrapped identifiers are cached, the cache depends on the table
+       prefix and it's invalidated in the setTablePrefix(). */
+    auto &cache = m_wrapCache.at(prefixAlias ? 1 : 0);
+    std::size_t generation = 0;
 
-    // FEATURE json columns, this code has to be in the Grammars::Grammar silverqx
-    /* If the given value is a JSON selector we will wrap it differently than a
-       traditional value. We will need to split this path and wrap each part
-       wrapped, etc. Otherwise, we will simply wrap the value as a string. */
-//    if (isJsonSelector(value))
-//        return wrapJsonSelector(value);
+    {
+        const std::shared_lock lock(m_wrapCacheMutex);
 
-    return wrapSegments(value.split(DOT));
+        if (const auto it = cache.find(value); it != cache.cend())
+            return it->second;
+
+        generation = m_wrapCacheGeneration;
+    }
+
+    auto wrapped = wrapUncached(value, prefixAlias);
+
+    {
+        const std::unique_lock lock(m_wrapCacheMutex);
+
+        // The table prefix was changed in the meantime
+        if (generation != m_wrapCacheGeneration)
+            return wrapped;
+
+        // The cache is bounded, start over if it's full
+        if (cache.size() >= WrapCacheMaxSize)
+            cache.clear();
+
+        cache.try_emplace(value, wrapped);
+    }
+
+    return wrapped;
 }
 
 QString BaseGrammar::wrap(const Column &value) const
@@ -71,6 +89,10 @@ QString BaseGrammar::wrap(const Column &value) const
 // NOLINTNEXTLINE(misc-no-recursion)
 QString BaseGrammar::wrapTable(const QString &table) const
 {
+    // Don't allocate a new string if there is no prefix
+    if (m_tablePrefix.isEmpty())
+        return wrap(table, true);
+
     return wrap(NOSPACE.arg(m_tablePrefix, table), true);
 }
 
@@ -110,8 +132,16 @@ QVariant BaseGrammar::getValue(const Expression &expression) noexcept
 
 BaseGrammar &BaseGrammar::setTablePrefix(const QString &prefix)
 {
+    const std::unique_lock lock(m_wrapCacheMutex);
+
     m_tablePrefix = prefix;
 
+    // Wrapped identifiers contain the table prefix
+    for (auto &cache : m_wrapCache)
+        cache.clear();
+
+    ++m_wrapCacheGeneration;
+
     return *this;
 }
 
@@ -145,6 +175,25 @@ QString BaseGrammar::parameter(const QVariant &value)
                                : QChar::fromLatin1('?');
 }
 
+// NOLINTNEXTLINE(misc-no-recursion)
+QString BaseGrammar::wrapUncached(const QString &value, const bool prefixAlias) const
+{
+    /* If the value being wrapped has a column alias we will need to separate out
+       the pieces so we can wrap each of the segments of the expression on its
+       own, and then join these both back together using the "as" connector. */
+    if (value.contains(QStringLiteral(" as ")))
+        return wrapAliasedValue(value, prefixAlias);
+
+    // FEATURE json columns, this code has to be in the Grammars::Grammar silverqx
+    /* If the given value is a JSON selector we will wrap it differently than a
+       traditional value. We will need to split this path and wrap each part
+       wrapped, etc. Otherwise, we will simply wrap the value as a string. */
+//    if (isJsonSelector(value))
+//        return wrapJsonSelector(value);
+
+    return wrapSegments(value.split(DOT));
+}
+
 // NOLINTNEXTLINE(misc-no-recursion)
 QString BaseGrammar::wrapAliasedValue(const QString &value, const bool prefixAlias) const
 {
@@ -0,0 +1,275 @@
+#include "orm/concerns/capturesslowqueries.hpp"
+
+#include <QtSql/QSqlField>
+#include <QtSql/QSqlRecord>
+
+#include "orm/constants.hpp"
+#include "orm/databaseconnection.hpp"
+#include "orm/db.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::NAME;
+using Orm::Constants::explain_slow_queries;
+using Orm::Constants::slow_query_threshold;
+
+namespace Orm::Concerns
+{
+
+/* public */
+
+DatabaseConnection &
+CapturesSlowQueries::setSlowQueryThreshold(const qint64 milliseconds)
+{
+    m_slowQueryThreshold = validateSlowQueryThreshold(milliseconds);
+
+    return databaseConnection();
+}
+
+DatabaseConnection &CapturesSlowQueries::explainSlowQueries(const bool value)
+{
+    m_explainSlowQueries = value;
+
+    return databaseConnection();
+}
+
+DatabaseConnection &CapturesSlowQueries::setSlowQueriesLimit(const std::size_t limit)
+{
+    m_slowQueriesLimit = limit;
+
+    while (m_slowQueries.size() > m_slowQueriesLimit)
+        m_slowQueries.pop_front();
+
+    return databaseConnection();
+}
+
+DatabaseConnection &CapturesSlowQueries::onSlowQuery(SlowQueryCallback callback)
+{
+    m_slowQueryCallback = std::move(callback);
+
+    return databaseConnection();
+}
+
+std::deque<SlowQuery> CapturesSlowQueries::takeSlowQueries()
+{
+    return std::exchange(m_slowQueries, {});
+}
+
+DatabaseConnection &CapturesSlowQueries::flushSlowQueries()
+{
+    m_slowQueries.clear();
+
+    return databaseConnection();
+}
+
+QString CapturesSlowQueries::explainConnectionName(const QString &connection)
+{
+    return QStringLiteral("%1-explain").arg(connection);
+}
+
+/* protected */
+
+void CapturesSlowQueries::configureSlowQueries(const QVariantHash &config)
+{
+    // Capturing is disabled by default, the 0 threshold captures all queries
+    if (const auto threshold = config.value(slow_query_threshold);
+        threshold.isValid() && !threshold.isNull()
+    )
+        m_slowQueryThreshold = validateSlowQueryThreshold(threshold.value<qint64>());
+
+    m_explainSlowQueries = config.value(explain_slow_queries, false).value<bool>();
+}
+
+void CapturesSlowQueries::captureSlowQuery(
+        const QString &queryString, const QVector<QVariant> &preparedBindings,
+        const qint64 elapsed, const QString &error)
+{
+    SlowQuery slowQuery {queryString, preparedBindings,
+                         databaseConnection().getName(), elapsed,
+                         QDateTime::currentDateTimeUtc(), {}, error};
+
+    if (m_explainSlowQueries)
+        slowQuery.plan = explainSlowQuery(queryString, preparedBindings);
+
+    if (m_slowQueryCallback)
+        std::invoke(m_slowQueryCallback, slowQuery);
+
+    // Bounded buffer, drop the oldest slow queries
+    if (m_slowQueriesLimit == 0)
+        return;
+
+    while (m_slowQueries.size() >= m_slowQueriesLimit)
+        m_slowQueries.pop_front();
+
+    m_slowQueries.push_back(std::move(slowQuery));
+}
+
+/* private */
+
+QString CapturesSlowQueries::explainSlowQuery(
+        const QString &queryString, const QVector<QVariant> &preparedBindings)
+{
+    if (!isExplainable(queryString, preparedBindings))
+        return {};
+
+    /* The EXPLAIN isn't logged, counted, or captured, explaining must never break
+       the application so all errors are swallowed. */
+    try {
+        auto &connection = databaseConnection();
+
+        /* Qt sql drivers can't prepare the EXPLAIN statement (QPSQL prepares using
+           the PREPARE statement), so the bindings are inlined and the query is
+           executed unprepared. */
+        const auto explainQuery = connection.getQueryGrammar().compileExplain(
+                                      inlineBindings(queryString, preparedBindings,
+                                                     *connection.driver()));
+
+        /* The side connection would wait for locks held by the current transaction
+           (eg. the ACCESS EXCLUSIVE lock after the ALTER TABLE) and it would never
+           finish, so the current connection is used inside the savepoint instead,
+           the failed EXPLAIN doesn't abort the current transaction this way. */
+        if (connection.inTransaction())
+            return explainInSavepoint(explainQuery);
+
+        // The side connection so the failed EXPLAIN can't affect the current session
+        QSqlQuery query(explainConnection().getQtConnection());
+
+        return executeExplain(query, explainQuery);
+
+    } catch (...) {
+        return {};
+    }
+}
+
+QString CapturesSlowQueries::explainInSavepoint(const QString &explainQuery)
+{
+    static const auto savepoint = QStringLiteral("tinyorm_explain");
+
+    QSqlQuery query(databaseConnection().getQtConnection());
+
+    if (!query.exec(QStringLiteral("savepoint %1").arg(savepoint)))
+        return {};
+
+    auto plan = executeExplain(query, explainQuery);
+
+    query.exec(QStringLiteral("rollback to savepoint %1").arg(savepoint));
+    query.exec(QStringLiteral("release savepoint %1").arg(savepoint));
+
+    return plan;
+}
+
+QString
+CapturesSlowQueries::executeExplain(QSqlQuery &query, const QString &explainQuery)
+{
+    if (!query.exec(explainQuery))
+        return {};
+
+    QStringList plan;
+
+    while (query.next()) {
+        const auto record = query.record();
+
+        QStringList columns;
+        columns.reserve(record.count());
+
+        for (auto i = 0; i < record.count(); ++i)
+            columns << record.value(i).value<QString>();
+
+        plan << columns.join(QStringLiteral(" | "));
+    }
+
+    return plan.join(QChar('\n'));
+}
+
+DatabaseConnection &CapturesSlowQueries::explainConnection()
+{
+    const auto &name = databaseConnection().getName();
+    const auto explainName = explainConnectionName(name);
+
+    /* The side connection has the same configuration as the original connection
+       without the slow queries capturing, the configuration is shared across threads
+       so another thread could add it in the meantime. It's disconnected and removed
+       together with the original connection in the DatabaseManager. */
+    if (!DB::connectionNames().contains(explainName)) {
+        auto config = DB::getConfig(name);
+        config.remove(NAME);
+        config.remove(slow_query_threshold);
+        config.remove(explain_slow_queries);
+
+        try {
+            DB::addConnection(config, explainName);
+        } catch (const Exceptions::InvalidArgumentError &/*unused*/) {}
+    }
+
+    return DB::connection(explainName);
+}
+
+qint64 CapturesSlowQueries::validateSlowQueryThreshold(const qint64 milliseconds)
+{
+    if (milliseconds < -1)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The slow query threshold must be >=-1, '%1' given "
+                               "in %2().")
+                .arg(milliseconds).arg(__tiny_func__));
+
+    return milliseconds;
+}
+
+bool CapturesSlowQueries::isExplainable(const QString &queryString,
+                                        const QVector<QVariant> &bindings)
+{
+    /* The bindings are inlined in place of the ? characters, if the query contains
+       the literal ? character (inside the string literal or the PostgreSQL ?| and ?&
+       operators), the bindings can't be inlined correctly. */
+    if (queryString.count(QChar('?')) != bindings.size())
+        return false;
+
+    // Only DML statements can be explained
+    static const QStringList explainable {
+        QStringLiteral("select"), QStringLiteral("insert"), QStringLiteral("update"),
+        QStringLiteral("delete"), QStringLiteral("replace"), QStringLiteral("with"),
+    };
+
+    const auto statement = queryString.trimmed().section(QChar(' '), 0, 0);
+
+    return explainable.contains(statement, Qt::CaseInsensitive);
+}
+
+QString
+CapturesSlowQueries::inlineBindings(
+        const QString &queryString, const QVector<QVariant> &bindings,
+        const QSqlDriver &driver)
+{
+    auto result = queryString;
+    QString::size_type position = 0;
+
+    for (const auto &binding : bindings) {
+        position = result.indexOf(QChar('?'), position);
+        if (position == -1)
+            break;
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        QSqlField field(QString(), binding.metaType());
+#else
+        QSqlField field(QString(), binding.type());
+#endif
+        field.setValue(binding);
+
+        // Continue after the inlined value, it can contain the ? character
+        const auto value = driver.formatValue(field);
+        result.replace(position, 1, value);
+        position += value.size();
+    }
+
+    return result;
+}
+
+DatabaseConnection &CapturesSlowQueries::databaseConnection()
+{
+    return dynamic_cast<DatabaseConnection &>(*this);
+}
+
+} // namespace Orm::Concerns
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,96 @@
+#include "orm/concerns/dispatchesqueryevents.hpp"
+
+#include "orm/databaseconnection.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Concerns
+{
+
+/* public */
+
+DatabaseConnection &DispatchesQueryEvents::listen(QueryListener listener)
+{
+    addQueryListener(std::move(listener));
+
+    return databaseConnection();
+}
+
+DatabaseConnection &
+DispatchesQueryEvents::listenForConnectionEvents(ConnectionEventListener listener)
+{
+    m_connectionEventListeners.push_back(std::move(listener));
+
+    return databaseConnection();
+}
+
+DatabaseConnection &DispatchesQueryEvents::forgetListeners()
+{
+    m_queryListeners.clear();
+    m_connectionEventListeners.clear();
+
+    return databaseConnection();
+}
+
+std::size_t DispatchesQueryEvents::addQueryListener(QueryListener listener)
+{
+    m_queryListeners.emplace_back(++m_queryListenerId, std::move(listener));
+
+    return m_queryListenerId;
+}
+
+bool DispatchesQueryEvents::removeQueryListener(const std::size_t id)
+{
+    const auto removed = std::erase_if(m_queryListeners, [id](const auto &listener)
+    {
+        return listener.first == id;
+    });
+
+    return removed > 0;
+}
+
+/* protected */
+
+void DispatchesQueryEvents::dispatchQueryExecuted(
+        const QSqlQuery &query, const QString &queryString,
+        const QVector<QVariant> &preparedBindings, const qint64 elapsed,
+        const QString &type) const
+{
+    /* The event only references the query data, so nothing is copied, listeners are
+       invoked in the order they were registered. */
+    const QueryExecutedEvent event {queryString, preparedBindings,
+                                    databaseConnection().getName(), elapsed,
+                                    query.size(), query.numRowsAffected(), type};
+
+    for (const auto &listener : m_queryListeners)
+        std::invoke(listener.second, event);
+}
+
+void DispatchesQueryEvents::dispatchConnectionEvent(
+        const ConnectionEvent::Type type) const
+{
+    // Nothing to dispatch, pretended transactions don't change the connection state
+    if (m_connectionEventListeners.empty() || databaseConnection().pretending())
+        return;
+
+    const ConnectionEvent event {type, databaseConnection().getName()};
+
+    for (const auto &listener : m_connectionEventListeners)
+        std::invoke(listener, event);
+}
+
+/* private */
+
+DatabaseConnection &DispatchesQueryEvents::databaseConnection()
+{
+    return dynamic_cast<DatabaseConnection &>(*this);
+}
+
+const DatabaseConnection &DispatchesQueryEvents::databaseConnection() const
+{
+    return dynamic_cast<const DatabaseConnection &>(*this);
+}
+
+} // namespace Orm::Concerns
+
+TINYORM_END_COMMON_NAMESPACE
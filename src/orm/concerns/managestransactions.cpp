@@ -7,6 +7,8 @@
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using EventType = Orm::ConnectionEvent::Type;
+
 namespace Orm::Concerns
 {
 
@@ -56,6 +58,8 @@ bool ManagesTransactions::beginTransaction()
     else
         databaseConnection().logTransactionQuery(queryString, elapsed);
 
+    databaseConnection().dispatchConnectionEvent(EventType::TRANSACTION_BEGINNING);
+
     return true;
 }
 
@@ -95,6 +99,8 @@ bool ManagesTransactions::commit()
     else
         databaseConnection().logTransactionQuery(queryString, elapsed);
 
+    databaseConnection().dispatchConnectionEvent(EventType::TRANSACTION_COMMITTED);
+
     return true;
 }
 
@@ -123,6 +129,10 @@ bool ManagesTransactions::rollBack()
 
     resetTransactions();
 
+    /* PostgreSQL reverts the SET statement_timeout executed in this transaction and
+       the cached results could read the rolled back data. */
+    databaseConnection().resetRolledBackState();
+
     // Queries execution time counter / Query statements counter
     const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
 
@@ -134,6 +144,8 @@ bool ManagesTransactions::rollBack()
     else
         databaseConnection().logTransactionQuery(queryString, elapsed);
 
+    databaseConnection().dispatchConnectionEvent(EventType::TRANSACTION_ROLLED_BACK);
+
     return true;
 }
 
@@ -209,6 +221,8 @@ bool ManagesTransactions::rollbackToSavepoint(const QString &id)
 
     m_savepoints = std::max<decltype (m_savepoints)>(0, m_savepoints - 1);
 
+    databaseConnection().resetRolledBackState();
+
     // Queries execution time counter / Query statements counter
     const auto elapsed = countsQueries().hitTransactionalCounters(timer, countElapsed);
 
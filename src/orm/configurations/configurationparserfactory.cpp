@@ -1,11 +1,14 @@
 #include "orm/configurations/configurationparserfactory.hpp"
 
+#include <mutex>
+
 #include "orm/configurations/mysqlconfigurationparser.hpp"
 #include "orm/configurations/postgresconfigurationparser.hpp"
 #include "orm/configurations/sqliteconfigurationparser.hpp"
 #include "orm/constants.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/macros/threadlocal.hpp"
+#include "orm/utils/thread.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -15,6 +18,8 @@ using Orm::Constants::QPSQL;
 using Orm::Constants::QSQLITE;
 using Orm::Constants::driver_;
 
+using Orm::Utils::Thread;
+
 namespace Orm::Configurations
 {
 
@@ -26,12 +31,10 @@ ConfigurationParserFactory::cachedParser(const QVariantHash &config)
     // Get a normalized driver name (using the toUpper())
     const auto driver = getDriverName(config);
 
-    T_THREAD_LOCAL
-    static std::unordered_map<QString,
-    std::unique_ptr<ConfigurationParserInterface>> cache;
+    auto &cache = parsersCache();
 
-    if (cache.contains(driver))
-        return *cache.at(driver);
+    if (const auto it = cache.find(driver); it != cache.cend())
+        return *it->second;
 
     // Create a new configuration parser instance and save it to the cache
     auto [it, ok] = cache.emplace(driver, make(driver));
@@ -60,8 +63,55 @@ ConfigurationParserFactory::make(const QString &driver)
                 .arg(driver, __tiny_func__));
 }
 
+void ConfigurationParserFactory::removeCurrentThreadCache()
+{
+#ifdef TINYORM_HAS_THREAD_LOCAL
+    parsersCache().clear();
+#else
+    const std::scoped_lock lock(cachesMutex());
+
+    parsersCaches().erase(Thread::currentThreadOrdinal());
+#endif
+}
+
 /* private */
 
+ConfigurationParserFactory::ParsersCacheType &
+ConfigurationParserFactory::parsersCache()
+{
+    /* Every thread needs its own parser instances because the ConfigurationParser
+       caches references to the currently parsed configuration. */
+#ifdef TINYORM_HAS_THREAD_LOCAL
+    T_THREAD_LOCAL
+    static ParsersCacheType cache;
+
+    return cache;
+#else
+    const std::scoped_lock lock(cachesMutex());
+
+    /* References to the mapped values stay valid after the rehash, thread IDs are
+       reused by new threads so the thread ordinal is used instead. */
+    return parsersCaches()[Thread::currentThreadOrdinal()];
+#endif
+}
+
+#ifndef TINYORM_HAS_THREAD_LOCAL
+std::unordered_map<quint64, ConfigurationParserFactory::ParsersCacheType> &
+ConfigurationParserFactory::parsersCaches()
+{
+    static std::unordered_map<quint64, ParsersCacheType> caches;
+
+    return caches;
+}
+
+std::mutex &ConfigurationParserFactory::cachesMutex()
+{
+    static std::mutex mutex;
+
+    return mutex;
+}
+#endif
+
 QString ConfigurationParserFactory::getDriverName(const QVariantHash &config)
 {
     // This method works with the user defined data, so I left this check here
@@ -1,10 +1,22 @@
 #include "orm/configurations/sqliteconfigurationparser.hpp"
 
+#include <unordered_set>
+
 #include "orm/constants.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Constants::NAME;
+using Orm::Constants::busy_timeout;
+using Orm::Constants::cache_size;
+using Orm::Constants::journal_mode;
+using Orm::Constants::mmap_size;
 using Orm::Constants::return_qdatetime;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
+using Orm::Constants::wal_autocheckpoint;
 
 namespace Orm::Configurations
 {
@@ -15,11 +27,85 @@ void SQLiteConfigurationParser::parseDriverSpecificOptions() const
 {
     if (!config().contains(return_qdatetime))
         config().insert(return_qdatetime, true);
+
+    // Validations
+    throwIfPragmaHasWrongValue(journal_mode, {QStringLiteral("delete"),
+                                              QStringLiteral("truncate"),
+                                              QStringLiteral("persist"),
+                                              QStringLiteral("memory"),
+                                              QStringLiteral("wal"),
+                                              QStringLiteral("off")});
+    throwIfPragmaHasWrongValue(synchronous, {QStringLiteral("off"),
+                                             QStringLiteral("normal"),
+                                             QStringLiteral("full"),
+                                             QStringLiteral("extra"),
+                                             QStringLiteral("0"), QStringLiteral("1"),
+                                             QStringLiteral("2"), QStringLiteral("3")});
+    throwIfPragmaHasWrongValue(temp_store, {QStringLiteral("default"),
+                                            QStringLiteral("file"),
+                                            QStringLiteral("memory"),
+                                            QStringLiteral("0"), QStringLiteral("1"),
+                                            QStringLiteral("2")});
+
+    throwIfPragmaIsNotInteger(busy_timeout);
+    // Negative value is the cache size in KiB
+    throwIfPragmaIsNotInteger(cache_size, true);
+    throwIfPragmaIsNotInteger(mmap_size);
+    throwIfPragmaIsNotInteger(wal_autocheckpoint);
 }
 
 void SQLiteConfigurationParser::parseDriverSpecificOptionsOption(
-        QVariantHash &/*unused*/) const
-{}
+        QVariantHash &options) const
+{
+    /* The busy timeout is set by the QSQLITE driver when the connection is opened,
+       the busy_timeout configuration option overwrites the QSQLITE_BUSY_TIMEOUT. */
+    if (config().contains(busy_timeout))
+        options.insert(QStringLiteral("QSQLITE_BUSY_TIMEOUT"),
+                       config()[busy_timeout].value<QString>());
+}
+
+/* private */
+
+void SQLiteConfigurationParser::throwIfPragmaHasWrongValue(
+        const QString &pragma, const std::unordered_set<QString> &allowed) const
+{
+    // Nothing to validate
+    if (!config().contains(pragma))
+        return;
+
+    if (allowed.contains(config()[pragma].value<QString>().toLower()))
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral(
+                    "The SQLite '%1' configuration option has an unsupported value "
+                    "'%2' in the '%3' connection configuration, in %4().")
+                .arg(pragma, config()[pragma].value<QString>(),
+                     config()[NAME].value<QString>(), __tiny_func__));
+}
+
+void SQLiteConfigurationParser::throwIfPragmaIsNotInteger(
+        const QString &pragma, const bool allowNegative) const
+{
+    // Nothing to validate
+    if (!config().contains(pragma))
+        return;
+
+    auto ok = false;
+    const auto value = config()[pragma].value<QString>().toLongLong(&ok);
+
+    if (ok && (allowNegative || value >= 0))
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                QStringLiteral(
+                    "The SQLite '%1' configuration option must be %2integer number "
+                    "in the '%3' connection configuration, in %4().")
+                .arg(pragma,
+                     allowNegative ? QStringLiteral("an ")
+                                   : QStringLiteral("a non-negative "),
+                     config()[NAME].value<QString>(), __tiny_func__));
+}
 
 } // namespace Orm::Configurations
 
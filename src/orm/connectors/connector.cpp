@@ -1,8 +1,12 @@
 #include "orm/connectors/connector.hpp"
 
+#include <QCoreApplication>
+#include <QThread>
+
 #include "orm/configurations/configurationoptionsparser.hpp"
 #include "orm/constants.hpp"
 #include "orm/exceptions/sqlerror.hpp"
+#include "orm/utils/thread.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -14,6 +18,8 @@ using Orm::Constants::password_;
 using Orm::Constants::port_;
 using Orm::Constants::username_;
 
+using Orm::Utils::Thread;
+
 namespace Orm::Connectors
 {
 
@@ -38,6 +44,21 @@ Connector::createConnection(const QString &name, const QVariantHash &config,
     }
 }
 
+QString Connector::qtConnectionName(const QString &connection)
+{
+    /* The QSqlDatabase connection names are process-wide, but a QSqlDatabase connection
+       can only be used from within the thread that created it. The main thread uses
+       the TinyORM connection name as-is and all other threads get their own QSqlDatabase
+       connection, so the same TinyORM connection can be used from many threads. */
+    if (const auto *const app = QCoreApplication::instance();
+        app == nullptr || app->thread() == QThread::currentThread()
+    )
+        return connection;
+
+    return QStringLiteral("%1-thread%2").arg(connection)
+                                        .arg(Thread::currentThreadOrdinal());
+}
+
 QString Connector::getOptions(const QVariantHash &config) const
 {
     /* This is a little different than in the Eloquent, the QSqlDatabase doesn't have
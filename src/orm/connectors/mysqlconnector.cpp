@@ -3,6 +3,9 @@
 #include <QVersionNumber>
 #include <QtSql/QSqlQuery>
 
+#include <shared_mutex>
+#include <unordered_map>
+
 #include "orm/constants.hpp"
 #include "orm/exceptions/queryerror.hpp"
 #include "orm/utils/configuration.hpp"
@@ -13,8 +16,12 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 using Orm::Constants::charset_;
 using Orm::Constants::collation_;
 using Orm::Constants::COMMA;
+using Orm::Constants::DASH;
+using Orm::Constants::host_;
 using Orm::Constants::isolation_level;
 using Orm::Constants::NAME;
+using Orm::Constants::port_;
+using Orm::Constants::SPACE;
 using Orm::Constants::strict_;
 using Orm::Constants::timezone_;
 
@@ -28,7 +35,7 @@ namespace Orm::Connectors
 ConnectionName
 MySqlConnector::connect(const QVariantHash &config) const
 {
-    auto name = config[NAME].value<QString>();
+    auto name = qtConnectionName(config[NAME].value<QString>());
 
     /* We need to grab the QSqlDatabse options that should be used while making
        the brand new connection instance. The QSqlDatabase options control various
@@ -38,19 +45,12 @@ MySqlConnector::connect(const QVariantHash &config) const
     // Create and open new database connection
     const auto connection = createConnection(name, config, options);
 
-    // Session transaction isolation
-    configureIsolationLevel(connection, config);
-
-    // Connection encoding and collation
-    configureEncoding(connection, config);
-
-    /* Next, we will check to see if a timezone has been specified in this config
-       and if it has we will issue a statement to modify the timezone with the
-       database. Setting this DB timezone is an optional configuration item. */
-    configureTimezone(connection, config);
-
-    // Set database modes, affected by 'strict' or 'modes' configuration options
-    setModes(connection, config);
+    /* Configure the transaction isolation, connection encoding and collation,
+       timezone, and SQL modes using one multi-assignment SET statement, every
+       statement is the round-trip to the database server. The timezone and modes
+       are optional configuration items affected by the 'timezone', 'strict',
+       and 'modes' configuration options. */
+    configureSession(connection, config);
 
     /* Return only connection name, because QSqlDatabase documentation doesn't
        recommend to store QSqlDatabase instance as a class data member, we can
@@ -66,36 +66,70 @@ MySqlConnector::getConnectorOptions() const
 
 /* protected */
 
-void MySqlConnector::configureIsolationLevel(const QSqlDatabase &connection,
-                                             const QVariantHash &config)
+void MySqlConnector::configureSession(const QSqlDatabase &connection,
+                                      const QVariantHash &config)
 {
-    if (!config.contains(isolation_level))
+    const auto assignments = getSessionAssignments(connection, config);
+
+    if (assignments.isEmpty())
         return;
 
     QSqlQuery query(connection);
 
-    if (query.exec(QStringLiteral("SET SESSION TRANSACTION ISOLATION LEVEL %1;")
-                   .arg(config[isolation_level].value<QString>())))
+    if (query.exec(QStringLiteral("set %1;").arg(assignments.join(COMMA))))
         return;
 
     throw Exceptions::QueryError(connection.connectionName(),
                                  m_configureErrorMessage.arg(__tiny_func__), query);
 }
 
-void MySqlConnector::configureEncoding(const QSqlDatabase &connection,
-                                       const QVariantHash &config)
+QStringList
+MySqlConnector::getSessionAssignments(const QSqlDatabase &connection,
+                                      const QVariantHash &config)
 {
-    if (!config.contains(charset_))
-        return;
+    QStringList assignments;
+    assignments.reserve(4);
+
+    // The order matters, the names assignment changes the collation_connection
+    for (const auto &assignment : {compileEncoding(config),
+                                   compileIsolationLevel(connection, config),
+                                   compileTimezone(config),
+                                   compileModes(connection, config)})
+        if (!assignment.isEmpty())
+            assignments << assignment;
+
+    return assignments;
+}
 
-    QSqlQuery query(connection);
+QString MySqlConnector::compileIsolationLevel(const QSqlDatabase &connection,
+                                              const QVariantHash &config)
+{
+    if (!config.contains(isolation_level))
+        return {};
 
-    if (query.exec(QStringLiteral("set names '%1'%2;")
-                   .arg(config[charset_].value<QString>(), getCollation(config))))
-        return;
+    /* The SET TRANSACTION statement can't be combined with other assignments, so
+       the session variable is set instead, the tx_isolation was removed in MySQL 8
+       and the transaction_isolation was added in MySQL 5.7.20 and MariaDB 11.1. */
+    const auto version = getMySqlVersion(connection, config);
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    const auto *const variable =
+            !version.contains(QStringLiteral("MariaDB")) &&
+            QVersionNumber::fromString(version) >= QVersionNumber(5, 7, 20)
+            ? "transaction_isolation" : "tx_isolation";
+
+    return QStringLiteral("session %1='%2'")
+            .arg(QLatin1String(variable),
+                 config[isolation_level].value<QString>().simplified()
+                                                         .replace(SPACE, DASH));
+}
+
+QString MySqlConnector::compileEncoding(const QVariantHash &config)
+{
+    if (!config.contains(charset_))
+        return {};
+
+    return QStringLiteral("names '%1'%2").arg(config[charset_].value<QString>(),
+                                              getCollation(config));
 }
 
 QString MySqlConnector::getCollation(const QVariantHash &config)
@@ -105,50 +139,31 @@ QString MySqlConnector::getCollation(const QVariantHash &config)
             : QString("");
 }
 
-void MySqlConnector::configureTimezone(const QSqlDatabase &connection,
-                                       const QVariantHash &config)
+QString MySqlConnector::compileTimezone(const QVariantHash &config)
 {
     if (!config.contains(timezone_))
-        return;
-
-    QSqlQuery query(connection);
+        return {};
 
-    if (query.exec(QStringLiteral("set time_zone=\"%1\";")
-                   .arg(config[timezone_].value<QString>())))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("time_zone=\"%1\"").arg(config[timezone_].value<QString>());
 }
 
-void MySqlConnector::setModes(const QSqlDatabase &connection,
-                              const QVariantHash &config)
+QString MySqlConnector::compileModes(const QSqlDatabase &connection,
+                                     const QVariantHash &config)
 {
     // Custom modes defined
     if (config.contains("modes"))
-        return setCustomModes(connection, config); // clazy:exclude=returning-void-expression
+        return compileCustomModes(config);
 
     // No strict defined
     if (!config.contains(strict_))
-        return;
-
-    QSqlQuery query(connection);
+        return {};
 
     // Enable strict mode
-    if (config[strict_].value<bool>()) {
-        if (query.exec(strictMode(connection, config)))
-            return;
-
-        throw Exceptions::QueryError(connection.connectionName(),
-                                     m_configureErrorMessage.arg(__tiny_func__), query);
-    }
+    if (config[strict_].value<bool>())
+        return strictMode(connection, config);
 
     // Set defaults, no strict mode
-    if (query.exec(QStringLiteral("set session sql_mode='NO_ENGINE_SUBSTITUTION'")))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("session sql_mode='NO_ENGINE_SUBSTITUTION'");
 }
 
 QString MySqlConnector::strictMode(const QSqlDatabase &connection,
@@ -158,11 +173,11 @@ QString MySqlConnector::strictMode(const QSqlDatabase &connection,
 
     /* NO_AUTO_CREATE_USER was removed in 8.0.11 */
     if (QVersionNumber::fromString(version) >= QVersionNumber(8, 0, 11))
-        return QStringLiteral("set session sql_mode='ONLY_FULL_GROUP_BY,"
+        return QStringLiteral("session sql_mode='ONLY_FULL_GROUP_BY,"
                               "STRICT_TRANS_TABLES,NO_ZERO_IN_DATE,NO_ZERO_DATE,"
                               "ERROR_FOR_DIVISION_BY_ZERO,NO_ENGINE_SUBSTITUTION'");
 
-    return QStringLiteral("set session sql_mode='ONLY_FULL_GROUP_BY,"
+    return QStringLiteral("session sql_mode='ONLY_FULL_GROUP_BY,"
                           "STRICT_TRANS_TABLES,NO_ZERO_IN_DATE,NO_ZERO_DATE,"
                           "ERROR_FOR_DIVISION_BY_ZERO,NO_AUTO_CREATE_USER,"
                           "NO_ENGINE_SUBSTITUTION'");
@@ -171,34 +186,42 @@ QString MySqlConnector::strictMode(const QSqlDatabase &connection,
 QString MySqlConnector::getMySqlVersion(const QSqlDatabase &connection,
                                         const QVariantHash &config)
 {
-    static QString MySqlVersionCache;
-
-    // Return the cached MySQL version
-    if (!MySqlVersionCache.isEmpty())
-        return MySqlVersionCache;
-
     // Get the MySQL version from the configuration if it was defined and is valid
     if (auto configVersionValue = ConfigUtils::getValidConfigVersion(config);
         !configVersionValue.isEmpty()
     )
-        return MySqlVersionCache = configVersionValue;
+        return configVersionValue;
 
-    // Obtain the MySQL version from the database
-    return MySqlVersionCache = getMySqlVersionFromDatabase(connection);
-}
+    /* Different connections can point to different database servers, so the version
+       is cached for every host, it's obtained only by the first connection. */
+    static std::unordered_map<QString, QString> MySqlVersionCache;
+    static std::shared_mutex mutex;
 
-void MySqlConnector::setCustomModes(const QSqlDatabase &connection,
-                                    const QVariantHash &config)
-{
-    const auto modes = config["modes"].value<QStringList>().join(COMMA);
+    const auto host = QStringLiteral("%1:%2").arg(config[host_].value<QString>())
+                                             .arg(config[port_].value<QString>());
 
-    QSqlQuery query(connection);
+    {
+        const std::shared_lock lock(mutex);
 
-    if (query.exec(QStringLiteral("set session sql_mode='%1';").arg(modes)))
-        return;
+        // Return the cached MySQL version
+        if (const auto it = MySqlVersionCache.find(host);
+            it != MySqlVersionCache.cend()
+        )
+            return it->second;
+    }
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    // Obtain the MySQL version from the database
+    auto version = getMySqlVersionFromDatabase(connection);
+
+    const std::scoped_lock lock(mutex);
+
+    return MySqlVersionCache.try_emplace(host, std::move(version)).first->second;
+}
+
+QString MySqlConnector::compileCustomModes(const QVariantHash &config)
+{
+    return QStringLiteral("session sql_mode='%1'")
+            .arg(config["modes"].value<QStringList>().join(COMMA));
 }
 
 /* private */
@@ -1,8 +1,8 @@
 #include "orm/connectors/postgresconnector.hpp"
 
-#include <QtSql/QSqlQuery>
+#include <set>
 
-#include "orm/exceptions/queryerror.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/utils/container.hpp"
 #include "orm/utils/type.hpp"
 
@@ -11,9 +11,15 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 using Orm::Constants::DEFAULT;
 using Orm::Constants::LOCAL;
 using Orm::Constants::NAME;
+using Orm::Constants::SEMICOLON;
+using Orm::Constants::SPACE;
+using Orm::Constants::SQUOTE;
 using Orm::Constants::TMPL_DQUOTES;
+using Orm::Constants::TMPL_SQUOTES;
+using Orm::Constants::application_name;
 using Orm::Constants::charset_;
 using Orm::Constants::isolation_level;
+using Orm::Constants::options_;
 using Orm::Constants::search_path;
 using Orm::Constants::synchronous_commit;
 using Orm::Constants::timezone_;
@@ -28,35 +34,21 @@ namespace Orm::Connectors
 ConnectionName
 PostgresConnector::connect(const QVariantHash &config) const
 {
-    auto name = config[NAME].value<QString>();
+    auto name = qtConnectionName(config[NAME].value<QString>());
 
     /* We need to grab the QSqlDatabse options that should be used while making
        the brand new connection instance. The QSqlDatabase options control various
        aspects of the connection's behavior, and can be overridden by the developers. */
-    const auto options = getOptions(config);
+    auto options = getOptions(config);
 
-    // Create and open new database connection
-    const auto connection = createConnection(name, config, options);
-
-    // Transaction isolation level
-    configureIsolationLevel(connection, config);
+    /* The session configuration is passed to the server as the connection startup
+       parameters instead of executing the SET statement for every configuration
+       option after the connection is opened, every statement is the round-trip
+       to the database server. */
+    addStartupOptions(options, config);
 
-    // Connection encoding
-    configureEncoding(connection, config);
-
-    /* Next, we will check to see if a timezone has been specified in this config
-       and if it has we will issue a statement to modify the timezone with the
-       database. Setting this DB timezone is an optional configuration item. */
-    configureTimezone(connection, config);
-
-    configureSearchPath(connection, config);
-
-    /* Postgres allows an application_name to be set by the user and this name is
-       used to when monitoring the application with pg_stat_activity. So we'll
-       determine if the option has been specified and run a statement if so. */
-    configureApplicationName(connection, config);
-
-    configureSynchronousCommit(connection, config);
+    // Create and open new database connection
+    createConnection(name, config, options);
 
     /* Return only connection name, because QSqlDatabase documentation doesn't
        recommend to store QSqlDatabase instance as a class data member, we can
@@ -72,37 +64,34 @@ PostgresConnector::getConnectorOptions() const
 
 /* protected */
 
-void PostgresConnector::configureIsolationLevel(const QSqlDatabase &connection,
-                                                const QVariantHash &config)
+void PostgresConnector::addStartupOptions(QString &options, const QVariantHash &config)
 {
-    if (!config.contains(isolation_level))
-        return;
+    QStringList startupOptions;
+    startupOptions.reserve(3);
 
-    QSqlQuery query(connection);
+    // Connection encoding
+    if (config.contains(charset_))
+        startupOptions << compileStartupOption(QStringLiteral("client_encoding"),
+                                               config[charset_].value<QString>());
 
-    if (query.exec(QStringLiteral("set session characteristics as "
-                                  "transaction isolation level %1;")
-                   .arg(config[isolation_level].value<QString>())))
-        return;
+    /* Postgres allows an application_name to be set by the user and this name is
+       used to when monitoring the application with pg_stat_activity. */
+    if (config.contains(application_name))
+        startupOptions << compileStartupOption(application_name,
+                                               config[application_name]
+                                               .value<QString>());
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
-}
+    // Other configuration parameters are passed using the -c command-line options
+    if (const auto settings = getSessionSettings(config); !settings.isEmpty())
+        startupOptions << compileStartupOption(options_, settings.join(SPACE));
 
-void PostgresConnector::configureEncoding(const QSqlDatabase &connection,
-                                          const QVariantHash &config)
-{
-    if (!config.contains(charset_))
+    if (startupOptions.isEmpty())
         return;
 
-    QSqlQuery query(connection);
-
-    if (query.exec(QStringLiteral("set names '%1';")
-                   .arg(config[charset_].value<QString>())))
-        return;
+    if (!options.isEmpty())
+        options += SEMICOLON;
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    options += startupOptions.join(SEMICOLON);
 }
 
 /*! The key comparison function for the Compare template parameter. */
@@ -115,89 +104,85 @@ struct QStringLessCi
     }
 };
 
-void PostgresConnector::configureTimezone(const QSqlDatabase &connection,
-                                          const QVariantHash &config)
+QStringList PostgresConnector::getSessionSettings(const QVariantHash &config)
 {
-    if (!config.contains(timezone_))
-        return;
+    QStringList settings;
+    settings.reserve(5);
+
+    /* Preserve the 'options' connection option defined by the user, the last
+       'options' connection option wins. */
+    if (auto userOptions = config[options_].value<QVariantHash>()
+                                           .value(options_).value<QString>();
+        !userOptions.isEmpty()
+    )
+        settings << std::move(userOptions);
 
-    QSqlQuery query(connection);
+    // Transaction isolation level
+    if (config.contains(isolation_level))
+        settings << compileSessionSetting(QStringLiteral("default_transaction_isolation"),
+                                          config[isolation_level].value<QString>());
 
+    /* Next, we will check to see if a timezone has been specified in this config
+       and if it has we will set the timezone for the new session, the DEFAULT
+       and LOCAL timezones are already the server's default. */
     static const std::set<QString, QStringLessCi> local {DEFAULT, LOCAL};
 
-    const auto timezone = config[timezone_].value<QString>();
-
-    if (local.contains(timezone)) {
-        if (query.exec(QStringLiteral("set time zone %1;").arg(timezone)))
-            return;
-    } else
-        if (query.exec(QStringLiteral("set time zone '%1';").arg(timezone)))
-            return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
-}
-
-void PostgresConnector::configureSearchPath(const QSqlDatabase &connection,
-                                            const QVariantHash &config)
-{
-    if (!config.contains(search_path))
-        return;
-
-    QSqlQuery query(connection);
+    if (auto timezone = config[timezone_].value<QString>();
+        config.contains(timezone_) && !local.contains(timezone)
+    )
+        settings << compileSessionSetting(QStringLiteral("TimeZone"), timezone);
 
     // Don't add the searchPath.isEmpty() check here to allow set "" (empty search path)
+    if (config.contains(search_path))
+        settings << compileSessionSetting(
+                        search_path,
+                        quoteSearchPath(parseSearchPath(config[search_path])));
 
-    if (query.exec(QStringLiteral("set search_path to %1;")
-                   .arg(quoteSearchPath(
-                            parseSearchPath(config[search_path]))))
-    )
-        return;
+    if (config.contains(synchronous_commit))
+        settings << compileSessionSetting(synchronous_commit,
+                                          config[synchronous_commit].value<QString>());
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return settings;
 }
 
 QString PostgresConnector::quoteSearchPath(const QStringList &searchPath)
 {
-    // Allow to set an empty search_path
+    // Allow to set an empty search_path, the empty value sets it
     if (isSearchPathEmpty(searchPath))
-        return QStringLiteral("''");
+        return QString("");
 
     // Really nice 😎
-    return TMPL_DQUOTES.arg(ContainerUtils::join(searchPath, QStringLiteral("\", \"")));
+    return TMPL_DQUOTES.arg(ContainerUtils::join(searchPath, QStringLiteral("\",\"")));
 }
 
-void PostgresConnector::configureApplicationName(const QSqlDatabase &connection,
-                                                 const QVariantHash &config)
+QString PostgresConnector::compileSessionSetting(const QString &name, QString value)
 {
-    if (!config.contains("application_name"))
-        return;
+    /* The server splits the 'options' connection option by whitespaces, the backslash
+       escapes them. */
+    value.replace(QLatin1Char('\\'), QStringLiteral("\\\\"));
 
-    QSqlQuery query(connection);
-
-    if (query.exec(QStringLiteral("set application_name to '%1';")
-                   .arg(config["application_name"].value<QString>())))
-        return;
+    for (const auto whitespace : {SPACE, QChar(u'\t'), QChar(u'\n'), QChar(u'\r')})
+        value.replace(whitespace, QStringLiteral("\\%1").arg(whitespace));
 
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    return QStringLiteral("-c %1=%2").arg(name, value);
 }
 
-void PostgresConnector::configureSynchronousCommit(const QSqlDatabase &connection,
-                                                   const QVariantHash &config)
+QString
+PostgresConnector::compileStartupOption(const QString &name, QString value)
 {
-    if (!config.contains(synchronous_commit))
-        return;
-
-    QSqlQuery query(connection);
-
-    if (query.exec(QStringLiteral("set synchronous_commit to '%1';")
-                   .arg(config[synchronous_commit].value<QString>())))
-        return;
-
-    throw Exceptions::QueryError(connection.connectionName(),
-                                 m_configureErrorMessage.arg(__tiny_func__), query);
+    /* The QPSQL driver replaces all semicolons in the connection options string with
+       spaces, so they can't be passed to the libpq. */
+    if (value.contains(SEMICOLON))
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The PostgreSQL '%1' connection startup option can't "
+                               "contain the semicolon character in %2().")
+                .arg(name, __tiny_func__));
+
+    // Quote the value for the libpq connection string
+    value.replace(QLatin1Char('\\'), QStringLiteral("\\\\"))
+         .replace(SQUOTE, QStringLiteral("\\'"));
+
+    return QStringLiteral("%1=%2").arg(name, TMPL_SQUOTES.arg(value));
 }
 
 } // namespace Orm::Connectors
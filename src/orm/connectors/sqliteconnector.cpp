@@ -1,8 +1,11 @@
 #include "orm/connectors/sqliteconnector.hpp"
 
+#include <QDebug>
 #include <QFile>
 #include <QtSql/QSqlQuery>
 
+#include <array>
+
 #include "orm/constants.hpp"
 #include "orm/exceptions/queryerror.hpp"
 #include "orm/exceptions/sqlitedatabasedoesnotexisterror.hpp"
@@ -11,9 +14,15 @@
 TINYORM_BEGIN_COMMON_NAMESPACE
 
 using Orm::Constants::NAME;
+using Orm::Constants::cache_size;
 using Orm::Constants::check_database_exists;
 using Orm::Constants::database_;
 using Orm::Constants::foreign_key_constraints;
+using Orm::Constants::journal_mode;
+using Orm::Constants::mmap_size;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
+using Orm::Constants::wal_autocheckpoint;
 
 using TypeUtils = Orm::Utils::Type;
 
@@ -25,7 +34,7 @@ namespace Orm::Connectors
 ConnectionName
 SQLiteConnector::connect(const QVariantHash &config) const
 {
-    auto name = config[NAME].value<QString>();
+    auto name = qtConnectionName(config[NAME].value<QString>());
 
     const auto options = getOptions(config);
 
@@ -34,7 +43,10 @@ SQLiteConnector::connect(const QVariantHash &config) const
        querying. In-memory databases may only have a single open connection. */
     if (config[database_].value<QString>() == QStringLiteral(":memory:")) {
         // sqlite :memory: driver
-        createConnection(name, config, options);
+        const auto connection = createConnection(name, config, options);
+
+        // Performance pragmas
+        configurePragmas(connection, config);
 
         return name;
     }
@@ -50,6 +62,11 @@ SQLiteConnector::connect(const QVariantHash &config) const
     // Foreign key constraints
     configureForeignKeyConstraints(connection, config);
 
+    /* Performance pragmas, the journal_mode, synchronous, cache_size, mmap_size,
+       temp_store, and wal_autocheckpoint, the busy_timeout is set by the QSQLITE
+       driver using the QSQLITE_BUSY_TIMEOUT connection option. */
+    configurePragmas(connection, config);
+
     /* Return only connection name, because QSqlDatabase documentation doesn't
        recommend to store QSqlDatabase instance as a class data member, we can
        simply obtain the connection by QSqlDatabase::connection() when needed. */
@@ -85,8 +102,59 @@ void SQLiteConnector::configureForeignKeyConstraints(const QSqlDatabase &connect
                                  m_configureErrorMessage.arg(__tiny_func__), query);
 }
 
+void SQLiteConnector::configurePragmas(const QSqlDatabase &connection,
+                                       const QVariantHash &config)
+{
+    /* The QSQLITE driver can't execute more statements at once, so every pragma is
+       executed separately, they are cheap because no network round-trip is involved.
+       The journal_mode must be set first because the wal_autocheckpoint is relevant
+       only in the WAL mode. Values are already validated in the configuration
+       parser. */
+    static const std::array pragmas {
+        journal_mode, synchronous, cache_size, mmap_size, temp_store, wal_autocheckpoint,
+    };
+
+    QSqlQuery query(connection);
+
+    for (const auto &pragma : pragmas) {
+        if (!config.contains(pragma))
+            continue;
+
+        const auto value = config[pragma].value<QString>();
+
+        if (!query.exec(QStringLiteral("PRAGMA %1 = %2;").arg(pragma, value)))
+            throw Exceptions::QueryError(connection.connectionName(),
+                                         m_configureErrorMessage.arg(__tiny_func__),
+                                         query);
+
+        if (pragma == journal_mode)
+            checkJournalMode(query, value, connection.connectionName());
+    }
+}
+
 /* private */
 
+void SQLiteConnector::checkJournalMode(QSqlQuery &query, const QString &expected,
+                                       const QString &connectionName)
+{
+    /* SQLite doesn't fail if the journal mode can't be changed, it returns
+       the journal mode that is in effect instead, eg. the in-memory database
+       always uses the memory journal mode. */
+    if (!query.next())
+        return;
+
+    const auto journalMode = query.value(0).value<QString>();
+
+    if (journalMode.compare(expected, Qt::CaseInsensitive) == 0)
+        return;
+
+    qWarning().noquote()
+            << QStringLiteral("The SQLite journal_mode '%1' can't be set for "
+                              "the '%2' connection, the '%3' journal_mode is used "
+                              "instead in %4().")
+               .arg(expected, connectionName, journalMode, __tiny_func__);
+}
+
 void SQLiteConnector::checkDatabaseExists(const QVariantHash &config)
 {
     const auto path = config[database_].value<QString>();
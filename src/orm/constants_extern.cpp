@@ -111,6 +111,18 @@ namespace Orm::Constants
     const QString application_name        = QStringLiteral("application_name");
     const QString synchronous_commit      = QStringLiteral("synchronous_commit");
     const QString spatial_ref_sys         = QStringLiteral("spatial_ref_sys");
+    const QString query_timeout           = QStringLiteral("query_timeout");
+    const QString slow_query_threshold    = QStringLiteral("slow_query_threshold");
+    const QString explain_slow_queries    = QStringLiteral("explain_slow_queries");
+
+    // SQLite pragmas
+    const QString journal_mode            = QStringLiteral("journal_mode");
+    const QString synchronous             = QStringLiteral("synchronous");
+    const QString busy_timeout            = QStringLiteral("busy_timeout");
+    const QString cache_size              = QStringLiteral("cache_size");
+    const QString mmap_size               = QStringLiteral("mmap_size");
+    const QString temp_store              = QStringLiteral("temp_store");
+    const QString wal_autocheckpoint      = QStringLiteral("wal_autocheckpoint");
 
     const QString H127001   = QStringLiteral("127.0.0.1");
     const QString LOCALHOST = QStringLiteral("localhost");
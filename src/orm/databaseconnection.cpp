@@ -6,14 +6,26 @@
 
 #include <QtSql/QSqlRecord>
 
+#include <unordered_map>
+
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/lostconnectionerror.hpp"
 #include "orm/exceptions/multiplecolumnsselectederror.hpp"
+#include "orm/exceptions/querytimeouterror.hpp"
 #include "orm/query/querybuilder.hpp"
+#include "orm/support/cachedsqlresult.hpp"
+#include "orm/support/connectionworkers.hpp"
+#include "orm/support/querycache.hpp"
 #include "orm/utils/configuration.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Support::CachedSqlResult;
+using Orm::Support::ConnectionWorkers;
+using Orm::Support::QueryCache;
+using Orm::Support::QueryCacheInterface;
+using Orm::Support::QueryCacheResult;
 using Orm::Utils::Helpers;
 
 using ConfigUtils = Orm::Utils::Configuration;
@@ -52,9 +64,12 @@ DatabaseConnection::DatabaseConnection(
     , m_qtTimeZone(std::move(qtTimeZone))
     , m_isConvertingTimeZone(m_qtTimeZone.type != QtTimeZoneType::DontConvert)
     , m_config(std::move(config))
+    , m_queryTimeout(getConfig(query_timeout).value<int>())
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
-{}
+{
+    configureSlowQueries(m_config);
+}
 
 DatabaseConnection::DatabaseConnection(
         std::function<Connectors::ConnectionName()> &&connection,
@@ -68,9 +83,12 @@ DatabaseConnection::DatabaseConnection(
     , m_isConvertingTimeZone(m_qtTimeZone.type != QtTimeZoneType::DontConvert)
     , m_returnQDateTime(returnQDateTime)
     , m_config(std::move(config))
+    , m_queryTimeout(getConfig(query_timeout).value<int>())
     , m_connectionName(getConfig(NAME).value<QString>())
     , m_hostName(getConfig(host_).value<QString>())
-{}
+{
+    configureSlowQueries(m_config);
+}
 
 std::shared_ptr<QueryBuilder>
 DatabaseConnection::table(const QString &table, const QString &as)
@@ -138,8 +156,7 @@ DatabaseConnection::select(const QString &queryString, QVector<QVariant> binding
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
            more helpful to the developer instead of just the database's errors. */
-        throw Exceptions::QueryError(
-                    m_connectionName,
+        throwQueryError(
                     "Select statement in DatabaseConnection::select() failed.",
                     query, preparedBindings);
     });
@@ -198,6 +215,8 @@ DatabaseConnection::statement(const QString &queryString, QVector<QVariant> bind
 
             recordsHaveBeenModified();
 
+            invalidateQueryCache(queryString_);
+
             return query;
         }
 
@@ -206,8 +225,7 @@ DatabaseConnection::statement(const QString &queryString, QVector<QVariant> bind
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
            more helpful to the developer instead of just the database's errors. */
-        throw Exceptions::QueryError(
-                    m_connectionName,
+        throwQueryError(
                     "Statement in DatabaseConnection::statement() failed.",
                     query, preparedBindings);
     });
@@ -242,6 +260,9 @@ DatabaseConnection::affectingStatement(const QString &queryString,
 
             recordsHaveBeenModified(numRowsAffected > 0);
 
+            if (numRowsAffected > 0)
+                invalidateQueryCache(queryString_);
+
             return {numRowsAffected, query};
         }
 
@@ -249,8 +270,7 @@ DatabaseConnection::affectingStatement(const QString &queryString,
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
            more helpful to the developer instead of just the database's errors. */
-        throw Exceptions::QueryError(
-                    m_connectionName,
+        throwQueryError(
                     "Affecting statement in DatabaseConnection::affectingStatement() "
                     "failed.",
                     query, preparedBindings);
@@ -278,6 +298,8 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
 
             recordsHaveBeenModified();
 
+            invalidateQueryCache(queryString_);
+
             return query;
         }
 
@@ -285,8 +307,7 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
            to the exception QueryError(), which formats the error message to
            include the bindings with SQL, which will make this exception a lot
            more helpful to the developer instead of just the database's errors. */
-        throw Exceptions::QueryError(
-                    m_connectionName,
+        throwQueryError(
                     "Unprepared statement in DatabaseConnection::unprepared() failed.",
                     query);
     });
@@ -294,6 +315,253 @@ SqlQuery DatabaseConnection::unprepared(const QString &queryString)
     return {std::move(queryResult), m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
 }
 
+/* QtSql doesn't expose the PostgreSQL pipeline mode nor the MySQL multi-statements
+   with bound values, so statements are sent back-to-back inside one transaction
+   and every distinct query string is prepared only once. */
+QVector<BatchResult>
+DatabaseConnection::batch(const QVector<BatchStatement> &statements)
+{
+    QVector<BatchResult> results(statements.size());
+
+    if (statements.isEmpty())
+        return results;
+
+    // Don't touch the transaction started by a caller
+    const auto ownsTransaction = !inTransaction();
+
+    /* The failed statement aborts the whole transaction on PostgreSQL, inside
+       the caller's transaction the batch is wrapped in the savepoint, so only
+       the batch's statements are rolled back and the caller's transaction can
+       continue. */
+    const auto savepoint = QStringLiteral("%1_batch").arg(getSavepointNamespace());
+
+    if (ownsTransaction)
+        beginTransaction();
+    else
+        unprepared(QStringLiteral("SAVEPOINT %1").arg(savepoint));
+
+    // Prepared queries cache, the same query string is prepared only once
+    std::unordered_map<QString, QSqlQuery> preparedQueries;
+    // Whether any statement failed
+    auto failed = false;
+
+    try {
+        for (QVector<BatchResult>::size_type i = 0; i < statements.size(); ++i) {
+            const auto &[queryString, bindings] = statements.at(i);
+            auto &result = results[i];
+
+            // Nothing to execute, eg. the toInsertStatement() with empty values
+            if (queryString.isEmpty())
+                continue;
+
+            // The callback is invoked the second time only after a reconnect
+            auto attempted = false;
+
+            try {
+                std::tie(result.affected, std::ignore) =
+                        run<std::tuple<int, QSqlQuery>>(
+                            queryString, QVector<QVariant>(bindings), Prepared,
+                            [this, &preparedQueries, &attempted]
+                            (const QString &queryString_,
+                             const QVector<QVariant> &preparedBindings)
+                            -> std::tuple<int, QSqlQuery>
+                {
+                    if (m_pretending)
+                        return {-1, getQtQueryForPretend()};
+
+                    // Queries prepared before a reconnect are useless
+                    if (attempted)
+                        preparedQueries.clear();
+
+                    attempted = true;
+
+                    auto itQuery = preparedQueries.find(queryString_);
+
+                    if (itQuery == preparedQueries.end())
+                        itQuery = preparedQueries.emplace(
+                                      queryString_, prepareQuery(queryString_)).first;
+
+                    auto &query = itQuery->second;
+
+                    bindValues(query, preparedBindings);
+
+                    if (query.exec()) {
+                        // Affecting statements counter
+                        if (m_countingStatements)
+                            ++m_statementsCounter.affecting;
+
+                        auto numRowsAffected = query.numRowsAffected();
+
+                        recordsHaveBeenModified(numRowsAffected > 0);
+
+                        if (numRowsAffected > 0)
+                            invalidateQueryCache(queryString_);
+
+                        return {numRowsAffected, query};
+                    }
+
+                    throwQueryError(
+                                "Batch statement in DatabaseConnection::batch() failed.",
+                                query, preparedBindings);
+                });
+
+                result.executed = true;
+
+            } catch (const Exceptions::QueryError &e) {
+                // Remaining statements will not be executed
+                result.error = e.getSqlError();
+                failed = true;
+                break;
+            }
+        }
+
+    } catch (...) {
+        if (ownsTransaction && inTransaction())
+            rollBack();
+
+        throw;
+    }
+
+    if (ownsTransaction) {
+        if (failed)
+            rollBack();
+        else
+            commit();
+    }
+    else {
+        if (failed)
+            unprepared(QStringLiteral("ROLLBACK TO SAVEPOINT %1").arg(savepoint));
+
+        unprepared(QStringLiteral("RELEASE SAVEPOINT %1").arg(savepoint));
+    }
+
+    return results;
+}
+
+/* Async queries */
+
+QFuture<QVector<QSqlRecord>>
+DatabaseConnection::selectAsync(const QString &queryString,
+                                QVector<QVariant> bindings) const
+{
+    /* The QtSql connection can't be used from other threads, the query is executed
+       using the thread-local connection of the worker thread. */
+    return ConnectionWorkers::run(m_connectionName,
+                                  [queryString, bindings = std::move(bindings)]
+                                  (DatabaseConnection &connection) mutable
+    {
+        return connection.select(queryString, std::move(bindings)).fetchRecords();
+    });
+}
+
+QFuture<int>
+DatabaseConnection::affectingStatementAsync(const QString &queryString,
+                                            QVector<QVariant> bindings) const
+{
+    return ConnectionWorkers::run(m_connectionName,
+                                  [queryString, bindings = std::move(bindings)]
+                                  (DatabaseConnection &connection) mutable
+    {
+        return std::get<0>(connection.affectingStatement(queryString,
+                                                         std::move(bindings)));
+    });
+}
+
+/* Query timeouts and cancellation */
+
+DatabaseConnection &DatabaseConnection::setQueryTimeout(const int milliseconds)
+{
+    if (milliseconds < 0)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The statement timeout must be >=0, '%1' given in %2().")
+                .arg(milliseconds).arg(__tiny_func__));
+
+    m_queryTimeout = milliseconds;
+
+    return *this;
+}
+
+QueryCancelHandle DatabaseConnection::getCancelHandle()
+{
+    // The process ID is valid until the connection is reconnected
+    if (!m_backendId.isValid())
+        m_backendId = getBackendId();
+
+    return {m_connectionName, m_backendId};
+}
+
+bool DatabaseConnection::cancelQuery(const QVariant &/*unused*/)
+{
+    return false;
+}
+
+bool DatabaseConnection::supportsWriteQueryTimeout()
+{
+    return true;
+}
+
+/* Query cache */
+
+SqlQuery
+DatabaseConnection::selectRemembered(const QString &queryString,
+                                     QVector<QVariant> bindings, const int ttl,
+                                     const QStringList &tables)
+{
+    // Nothing to cache
+    if (m_pretending)
+        return select(queryString, std::move(bindings));
+
+    auto &cache = getQueryCache();
+    const auto key = QueryCache::key(queryCacheScope(), queryString, bindings);
+
+    auto result = cache.get(key);
+
+    if (!result) {
+        auto query = select(queryString, std::move(bindings));
+
+        /* The QSqlQuery::record() returns raw values, the QDateTime time zones are
+           converted by the SqlQuery when the cached values are read. */
+        result = QueryCacheResult {query.record(), {}};
+
+        if (const auto querySize = query.size(); querySize > 0)
+            result->rows.reserve(querySize);
+
+        while (query.next())
+            result->rows << query.record();
+
+        // The ASTERISK means that any write invalidates the cached result
+        QStringList normalizedTables {ASTERISK};
+        if (!tables.isEmpty()) {
+            normalizedTables.clear();
+
+            for (const auto &table : tables)
+                normalizedTables << QueryCache::normalizeTable(table);
+        }
+
+        cache.put(key, *result, normalizedTables, ttl);
+    }
+
+    // The QSqlQuery takes ownership of the CachedSqlResult
+    return {QSqlQuery(new CachedSqlResult(driver(), queryString, std::move(*result))),
+            m_qtTimeZone, *m_queryGrammar, m_returnQDateTime};
+}
+
+QueryCacheInterface &DatabaseConnection::getQueryCache()
+{
+    if (!m_queryCache)
+        m_queryCache = std::make_shared<QueryCache>();
+
+    return *m_queryCache;
+}
+
+DatabaseConnection &
+DatabaseConnection::setQueryCache(std::shared_ptr<QueryCacheInterface> cache) noexcept
+{
+    m_queryCache = std::move(cache);
+
+    return *this;
+}
+
 /* Obtain connection instance */
 
 QSqlDatabase DatabaseConnection::getQtConnection()
@@ -311,6 +579,8 @@ QSqlDatabase DatabaseConnection::getQtConnection()
             throw Exceptions::RuntimeError(
                     QStringLiteral("QSqlDatabase does not contain '%1' connection.")
                     .arg(*m_qtConnection));
+
+        dispatchConnectionEvent(ConnectionEvent::Type::CONNECTION_ESTABLISHED);
     }
 
     // Return the connection from QSqlDatabase connection manager
@@ -349,6 +619,9 @@ DatabaseConnection::setQtConnectionResolver(
     m_qtConnection.reset();
     m_qtConnectionResolver = resolver;
 
+    // A new physical connection will be created, with a new database session
+    resetSessionState();
+
     return *this;
 }
 
@@ -408,6 +681,11 @@ bool DatabaseConnection::pingDatabase()
                 .arg(driverName()));
 }
 
+bool DatabaseConnection::supportsInsertReturning()
+{
+    return false;
+}
+
 QSqlDriver *DatabaseConnection::driver()
 {
     return getQtConnection().driver();
@@ -458,6 +736,8 @@ void DatabaseConnection::disconnect()
 
     m_qtConnection.reset();
     m_qtConnectionResolver = nullptr;
+
+    resetSessionState();
 }
 
 SchemaBuilder &DatabaseConnection::getSchemaBuilder()
@@ -605,6 +885,21 @@ void DatabaseConnection::useDefaultPostProcessor()
     m_postProcessor = getDefaultPostProcessor();
 }
 
+QVariant DatabaseConnection::getBackendId()
+{
+    return {};
+}
+
+QString DatabaseConnection::compileQueryTimeout(const int /*unused*/)
+{
+    return {};
+}
+
+bool DatabaseConnection::causedByQueryTimeout(const QSqlError &/*unused*/) const
+{
+    return false;
+}
+
 /* private */
 
 QSqlQuery DatabaseConnection::prepareQuery(const QString &queryString)
@@ -632,6 +927,77 @@ QDateTime DatabaseConnection::prepareBinding(const QDateTime &binding) const
     return Helpers::convertTimeZone(binding, m_qtTimeZone);
 }
 
+void DatabaseConnection::throwQueryError(
+        const char *message, const QSqlQuery &query,
+        const QVector<QVariant> &bindings) const
+{
+    if (causedByQueryTimeout(query.lastError()))
+        throw Exceptions::QueryTimeoutError(m_connectionName, message, query, bindings);
+
+    throw Exceptions::QueryError(m_connectionName, message, query, bindings);
+}
+
+void DatabaseConnection::invalidateQueryCache(const QString &queryString)
+{
+    // Nothing to invalidate, the query cache is opt-in
+    if (!m_queryCache || m_queryCache->isEmpty())
+        return;
+
+    // The written table can't be detected (eg. DDL statements), invalidate everything
+    if (const auto table = QueryCache::writtenTable(queryString); table.isEmpty())
+        m_queryCache->flush();
+    else
+        m_queryCache->invalidate(table);
+}
+
+QString DatabaseConnection::queryCacheScope() const
+{
+    return QStringLiteral("%1@%2/%3").arg(m_connectionName, m_hostName, m_database);
+}
+
+void DatabaseConnection::resetRolledBackState()
+{
+    if (m_sessionQueryTimeout)
+        m_sessionQueryTimeout = -1;
+
+    if (m_queryCache && !m_queryCache->isEmpty())
+        m_queryCache->flush();
+}
+
+void DatabaseConnection::applyQueryTimeout()
+{
+    const auto timeout = m_queryTimeoutOverride.value_or(m_queryTimeout);
+
+    /* Nothing to do, the database session already uses this timeout, or the timeout
+       was never set and the server's default statement timeout should be used.
+       The compileQueryTimeout() can also execute queries (eg. to detect MariaDB). */
+    if (m_applyingQueryTimeout ||
+        (m_sessionQueryTimeout ? *m_sessionQueryTimeout == timeout : timeout == 0)
+    )
+        return;
+
+    const QScopedValueRollback<bool> applying(m_applyingQueryTimeout, true);
+
+    const auto queryString = compileQueryTimeout(timeout);
+
+    // The database driver doesn't support the statement timeout
+    if (queryString.isEmpty())
+        return;
+
+    /* Set the timeout only when it changes so subsequent queries with the same timeout
+       don't need an additional round-trip to the database server. */
+    auto query = getQtQuery();
+
+    if (!query.exec(queryString))
+        throw Exceptions::QueryError(
+                m_connectionName,
+                "Setting the statement timeout in "
+                "DatabaseConnection::applyQueryTimeout() failed.",
+                query);
+
+    m_sessionQueryTimeout = timeout;
+}
+
 void DatabaseConnection::logConnected()
 {
 #ifdef TINYORM_MYSQL_PING
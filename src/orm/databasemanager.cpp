@@ -3,8 +3,12 @@
 #include <range/v3/view/map.hpp>
 
 #include "orm/concerns/hasconnectionresolver.hpp"
+#include "orm/configurations/configurationparserfactory.hpp"
 #include "orm/connectors/connectionfactory.hpp"
+#include "orm/connectors/connector.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/schema/schemabuilder.hpp"
+#include "orm/support/connectionworkers.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -49,7 +53,10 @@ DatabaseManager::DatabaseManager(const ConfigurationsType &configs,
                                  const QString &defaultConnection)
     : DatabaseManager(defaultConnection)
 {
-    *m_configuration = configs;
+    m_configuration.update([&configs](auto &configurations)
+    {
+        configurations = configs;
+    });
 }
 
 DatabaseManager &DatabaseManager::setupDefaultReconnector()
@@ -195,6 +202,13 @@ SqlQuery DatabaseManager::unprepared(const QString &query,
     return this->connection(connection).unprepared(query);
 }
 
+QVector<BatchResult>
+DatabaseManager::batch(const QVector<BatchStatement> &statements,
+                       const QString &connection)
+{
+    return this->connection(connection).batch(statements);
+}
+
 bool DatabaseManager::beginTransaction(const QString &connection)
 {
     return this->connection(connection).beginTransaction();
@@ -280,24 +294,31 @@ DatabaseConnection &DatabaseManager::connection(const QString &name)
 {
     const auto &connectionName = parseConnectionName(name);
 
+    // Connections are thread-local so the lookup doesn't need any locking
+    auto &connections = *m_connections;
+
+    if (const auto it = connections.find(connectionName); it != connections.end())
+        return *it->second;
+
     /* If we haven't created this connection, we'll create it based on the provided
        config. Once we've created the connections we will configure it. */
-    if (!m_connections->contains(connectionName))
-        m_connections->emplace(connectionName,
-                               configure(makeConnection(connectionName)));
-
-    return *(*m_connections)[connectionName];
+    return *connections.emplace(connectionName,
+                                configure(makeConnection(connectionName)))
+            .first->second;
 }
 
 DatabaseManager &
 DatabaseManager::addConnection(const QVariantHash &config, const QString &name)
 {
-    if (m_configuration->contains(name))
-        throw Exceptions::InvalidArgumentError(
-                QStringLiteral("The database connection '%1' already exists.")
-                .arg(name));
+    m_configuration.update([&config, &name](auto &configurations)
+    {
+        if (configurations.contains(name))
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The database connection '%1' already exists.")
+                    .arg(name));
 
-    m_configuration->emplace(name, config);
+        configurations.emplace(name, config);
+    });
 
     return *this;
 }
@@ -330,6 +351,12 @@ bool DatabaseManager::removeConnection(const QString &name)
     if (!connectionNames().contains(name_))
         return false;
 
+    // Async queries' worker thread has its own connection
+    Support::ConnectionWorkers::remove(name_);
+
+    // The side connection used to explain the slow queries belongs to this connection
+    removeConnection(DatabaseConnection::explainConnectionName(name_));
+
     /* If currently removed connection is the default connection, then reset default
        connection. */
     const auto resetDefaultConnection_ = [this, &name]
@@ -340,7 +367,7 @@ bool DatabaseManager::removeConnection(const QString &name)
 
     // Not connected
     if (!m_connections->contains(name_)) {
-        m_configuration->erase(name_);
+        removeConfiguration(name_);
         resetDefaultConnection_();
         return true;
     }
@@ -354,9 +381,10 @@ bool DatabaseManager::removeConnection(const QString &name)
         return false;
 
     // Remove TinyORM configuration
-    m_configuration->erase(name_);
-    // Remove Qt's database connection, ~QSqlDatabase() internally also calls close()
-    QSqlDatabase::removeDatabase(name_);
+    removeConfiguration(name_);
+    /* Remove Qt's database connection of the current thread, ~QSqlDatabase() internally
+       also calls close(). */
+    QSqlDatabase::removeDatabase(Connectors::Connector::qtConnectionName(name_));
 
     resetDefaultConnection_();
 
@@ -368,6 +396,24 @@ bool DatabaseManager::containsConnection(const QString &name)
     return m_connections->contains(name);
 }
 
+void DatabaseManager::removeThreadConnections()
+{
+    const auto names = openedConnectionNames();
+
+    for (const auto &name : names)
+        m_connections->find(name)->second->disconnect();
+
+    // The DatabaseConnection-s must be destroyed before their Qt's database connections
+    Support::DatabaseConnectionsMap::removeCurrentThread();
+
+    /* Qt's database connection names are process-wide, so they would be leaked for
+       every finished thread (eg. in thread pools). */
+    for (const auto &name : names)
+        QSqlDatabase::removeDatabase(Connectors::Connector::qtConnectionName(name));
+
+    Configurations::ConfigurationParserFactory::removeCurrentThreadCache();
+}
+
 DatabaseConnection &DatabaseManager::reconnect(const QString &name)
 {
     const auto &name_ = parseConnectionName(name);
@@ -384,6 +430,15 @@ void DatabaseManager::disconnect(const QString &name) const
 {
     const auto &name_ = parseConnectionName(name);
 
+    // Async queries' worker thread has its own connection
+    Support::ConnectionWorkers::disconnect(name_);
+
+    // The side connection used to explain the slow queries belongs to this connection
+    if (const auto explainName = DatabaseConnection::explainConnectionName(name_);
+        m_connections->contains(explainName)
+    )
+        m_connections->find(explainName)->second->disconnect();
+
     if (!m_connections->contains(name_))
         return;
 
@@ -395,9 +450,27 @@ void DatabaseManager::connectEagerly(const QString &name)
     connection(name).connectEagerly();
 }
 
+void DatabaseManager::createSnapshot(const QString &snapshot, const QString &connection)
+{
+    this->connection(connection).getSchemaBuilder().createSnapshot(snapshot);
+}
+
+void DatabaseManager::restoreSnapshot(const QString &snapshot, const QString &connection)
+{
+    this->connection(connection).getSchemaBuilder().restoreSnapshot(snapshot);
+}
+
+void DatabaseManager::dropSnapshotIfExists(const QString &snapshot,
+                                           const QString &connection)
+{
+    this->connection(connection).getSchemaBuilder().dropSnapshotIfExists(snapshot);
+}
+
 QStringList DatabaseManager::connectionNames() const
 {
-    return *m_configuration | ranges::views::keys | ranges::to<QStringList>();
+    const auto configurations = m_configuration.snapshot();
+
+    return *configurations | ranges::views::keys | ranges::to<QStringList>();
 }
 
 QStringList DatabaseManager::openedConnectionNames() const
@@ -435,7 +508,7 @@ bool DatabaseManager::isDriverAvailable(const QString &driverName) const // NOLI
 
 bool DatabaseManager::isConnectionDriverAvailable(const QString &connection)
 {
-    const auto driverName = configuration(connection)[driver_].value<QString>();
+    const auto driverName = configuration(connection).value(driver_).value<QString>();
 
     if (!supportedDrivers().contains(driverName))
         throw Exceptions::LogicError(
@@ -527,14 +600,9 @@ DatabaseManager::originalConfigValue(const QString &option,
     return originalConfig(connection).value(option);
 }
 
-const QVariantHash &
-DatabaseManager::originalConfig(const QString &connection) const
+QVariantHash DatabaseManager::originalConfig(const QString &connection) const
 {
-    const auto &connectionName = parseConnectionName(connection);
-
-    throwIfNoConfiguration(connectionName);
-
-    return m_configuration->at(connectionName);
+    return configuration(connection);
 }
 
 size_t DatabaseManager::originalConfigsSize() const
@@ -626,6 +694,27 @@ std::size_t DatabaseManager::getQueryLogOrder() const noexcept // NOLINT(readabi
     return DatabaseConnection::getQueryLogOrder();
 }
 
+/* Query events */
+
+DatabaseConnection &
+DatabaseManager::listen(QueryListener listener, const QString &connection)
+{
+    return this->connection(connection).listen(std::move(listener));
+}
+
+DatabaseConnection &
+DatabaseManager::listenForConnectionEvents(ConnectionEventListener listener,
+                                           const QString &connection)
+{
+    return this->connection(connection)
+                .listenForConnectionEvents(std::move(listener));
+}
+
+DatabaseConnection &DatabaseManager::forgetListeners(const QString &connection)
+{
+    return this->connection(connection).forgetListeners();
+}
+
 /* Queries execution time counter */
 
 bool DatabaseManager::countingElapsed(const QString &connection)
@@ -891,39 +980,55 @@ DatabaseManager::parseConnectionName(const QString &name) const
 std::shared_ptr<DatabaseConnection>
 DatabaseManager::makeConnection(const QString &connection)
 {
-    auto &config = configuration(connection);
+    const auto &connectionName = parseConnectionName(connection);
+
+    auto config = configuration(connectionName);
 
     // FUTURE add support for extensions silverqx
 
-    return Connectors::ConnectionFactory::make(config, connection);
+    auto databaseConnection = Connectors::ConnectionFactory::make(config, connection);
+
+    /* The ConnectionFactory normalizes the original configuration (inserts default
+       values), publish it back so the originalConfig() returns the parsed values. */
+    m_configuration.update([&connectionName, &config](auto &configurations)
+    {
+        // The connection could be removed by another thread in the meantime
+        if (const auto it = configurations.find(connectionName);
+            it != configurations.end()
+        )
+            it->second = std::move(config);
+    });
+
+    return databaseConnection;
 }
 
-/* Can not be const because I'm modifying the Configuration (QVariantHash)
-   in ConnectionFactory. */
-QVariantHash &
-DatabaseManager::configuration(const QString &connection)
+QVariantHash DatabaseManager::configuration(const QString &connection) const
 {
     const auto &connectionName = parseConnectionName(connection);
 
-    throwIfNoConfiguration(connectionName);
-
-    return (*m_configuration)[connectionName]; // clazy:exclude=detaching-member
-
-    // TODO add ConfigurationUrlParser silverqx
-//    return ConfigurationUrlParser()
-//            .parseConfiguration((*m_configuration)[connectionName]);
-}
+    /* Obtain the snapshot only once, so the lookup can't race with
+       the removeConnection() called from another thread. */
+    const auto configurations = m_configuration.snapshot();
 
-void DatabaseManager::throwIfNoConfiguration(const QString &connection) const
-{
     /* Get the database connection configuration by the given name.
        If the configuration doesn't exist, we'll throw an exception and bail. */
-    if (m_configuration->contains(connection))
-        return;
+    if (const auto it = configurations->find(connectionName);
+        it != configurations->cend()
+    )
+        return it->second;
 
+    // TODO add ConfigurationUrlParser silverqx
     throw Exceptions::InvalidArgumentError(
                 QStringLiteral("Database connection '%1' is not configured.")
-                .arg(connection));
+                .arg(connectionName));
+}
+
+void DatabaseManager::removeConfiguration(const QString &connection)
+{
+    m_configuration.update([&connection](auto &configurations)
+    {
+        configurations.erase(connection);
+    });
 }
 
 std::shared_ptr<DatabaseConnection>
@@ -127,6 +127,12 @@ SqlQuery DB::unprepared(const QString &query,
     return manager().connection(connection).unprepared(query);
 }
 
+QVector<BatchResult>
+DB::batch(const QVector<BatchStatement> &statements, const QString &connection)
+{
+    return manager().connection(connection).batch(statements);
+}
+
 // NOTE api different silverqx
 bool DB::beginTransaction(const QString &connection)
 {
@@ -223,6 +229,11 @@ bool DB::containsConnection(const QString &name)
     return manager().containsConnection(name);
 }
 
+void DB::removeThreadConnections()
+{
+    manager().removeThreadConnections();
+}
+
 DatabaseConnection &DB::reconnect(const QString &name)
 {
     return manager().reconnect(name);
@@ -238,6 +249,21 @@ void DB::connectEagerly(const QString &name)
     manager().connectEagerly(name);
 }
 
+void DB::createSnapshot(const QString &snapshot, const QString &connection)
+{
+    manager().createSnapshot(snapshot, connection);
+}
+
+void DB::restoreSnapshot(const QString &snapshot, const QString &connection)
+{
+    manager().restoreSnapshot(snapshot, connection);
+}
+
+void DB::dropSnapshotIfExists(const QString &snapshot, const QString &connection)
+{
+    manager().dropSnapshotIfExists(snapshot, connection);
+}
+
 QStringList DB::connectionNames()
 {
     return manager().connectionNames();
@@ -353,7 +379,7 @@ DB::originalConfigValue(const QString &option, const QString &connection)
     return manager().originalConfigValue(option, connection);
 }
 
-const QVariantHash &DB::originalConfig(const QString &connection)
+QVariantHash DB::originalConfig(const QString &connection)
 {
     return manager().originalConfig(connection);
 }
@@ -445,6 +471,26 @@ std::size_t DB::getQueryLogOrder() noexcept
     return manager().getQueryLogOrder();
 }
 
+/* Query events */
+
+DatabaseConnection &DB::listen(QueryListener listener, const QString &connection)
+{
+    return manager().connection(connection).listen(std::move(listener));
+}
+
+DatabaseConnection &
+DB::listenForConnectionEvents(ConnectionEventListener listener,
+                              const QString &connection)
+{
+    return manager().connection(connection)
+                    .listenForConnectionEvents(std::move(listener));
+}
+
+DatabaseConnection &DB::forgetListeners(const QString &connection)
+{
+    return manager().connection(connection).forgetListeners();
+}
+
 /* Queries execution time counter */
 
 bool DB::countingElapsed(const QString &connection)
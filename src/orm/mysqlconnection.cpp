@@ -5,6 +5,9 @@
 #endif
 #include <QVersionNumber>
 #include <QtSql/QSqlDriver>
+#include <QtSql/QSqlError>
+
+#include <unordered_set>
 
 #ifdef TINYORM_MYSQL_PING
 #  ifdef __MINGW32__
@@ -235,6 +238,20 @@ bool MySqlConnection::pingDatabase()
 #endif
 }
 
+bool MySqlConnection::cancelQuery(const QVariant &backendId)
+{
+    // The KILL statement doesn't support prepared bindings
+    unprepared(QStringLiteral("kill query %1").arg(backendId.value<quint64>()));
+
+    return true;
+}
+
+bool MySqlConnection::supportsWriteQueryTimeout()
+{
+    // The MySQL max_execution_time applies to the read-only SELECT statements only
+    return isMaria();
+}
+
 /* protected */
 
 std::unique_ptr<QueryGrammar> MySqlConnection::getDefaultQueryGrammar() const
@@ -267,6 +284,32 @@ std::unique_ptr<QueryProcessor> MySqlConnection::getDefaultPostProcessor() const
     return std::make_unique<Query::Processors::MySqlProcessor>();
 }
 
+QVariant MySqlConnection::getBackendId()
+{
+    return scalar(QStringLiteral("select connection_id()"));
+}
+
+QString MySqlConnection::compileQueryTimeout(const int milliseconds)
+{
+    // The max_statement_time is in seconds and applies to all statements
+    if (isMaria())
+        return QStringLiteral("set session max_statement_time = %1")
+                .arg(static_cast<double>(milliseconds) / 1000, 0, 'f', 3);
+
+    // The max_execution_time applies to the read-only SELECT statements only
+    return QStringLiteral("set session max_execution_time = %1").arg(milliseconds);
+}
+
+bool MySqlConnection::causedByQueryTimeout(const QSqlError &error) const
+{
+    // ER_QUERY_TIMEOUT (MySQL) and ER_STATEMENT_TIMEOUT (MariaDB)
+    static const std::unordered_set<QString> timeoutErrors {
+        QStringLiteral("3024"), QStringLiteral("1969"),
+    };
+
+    return timeoutErrors.contains(error.nativeErrorCode());
+}
+
 } // namespace Orm
 
 TINYORM_END_COMMON_NAMESPACE
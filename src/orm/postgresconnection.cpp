@@ -1,5 +1,7 @@
 #include "orm/postgresconnection.hpp"
 
+#include <QtSql/QSqlError>
+
 #include <range/v3/view/move.hpp>
 
 #include "orm/query/grammars/postgresgrammar.hpp"
@@ -74,6 +76,14 @@ QStringList PostgresConnection::searchPathRaw(const bool flushCache)
     return *(m_searchPath = searchPathRawDb());
 }
 
+/* Others */
+
+bool PostgresConnection::cancelQuery(const QVariant &backendId)
+{
+    return scalar(QStringLiteral("select pg_cancel_backend(?)"), {backendId})
+            .value<bool>();
+}
+
 /* protected */
 
 std::unique_ptr<QueryGrammar> PostgresConnection::getDefaultQueryGrammar() const
@@ -106,6 +116,24 @@ std::unique_ptr<QueryProcessor> PostgresConnection::getDefaultPostProcessor() co
     return std::make_unique<Query::Processors::PostgresProcessor>();
 }
 
+QVariant PostgresConnection::getBackendId()
+{
+    return scalar(QStringLiteral("select pg_backend_pid()"));
+}
+
+QString PostgresConnection::compileQueryTimeout(const int milliseconds)
+{
+    return QStringLiteral("set statement_timeout = %1").arg(milliseconds);
+}
+
+bool PostgresConnection::causedByQueryTimeout(const QSqlError &error) const
+{
+    /* The query_canceled SQLSTATE is also used by the pg_cancel_backend(), so check
+       the message too. */
+    return error.nativeErrorCode() == QStringLiteral("57014") &&
+           error.databaseText().contains(QStringLiteral("statement timeout"));
+}
+
 /* private */
 
 QStringList PostgresConnection::searchPathRawForPretending() const
@@ -13,6 +13,11 @@ namespace Orm::Query::Grammars
 
 QString Grammar::compileSelect(QueryBuilder &query) const
 {
+    /* The aggregate of the union query has to be computed over the whole union,
+       so the union query is compiled as the subquery of the aggregate. */
+    if (!query.getUnions().isEmpty() && query.getAggregate())
+        return compileUnionAggregate(query);
+
     /* If the query does not have any columns set, we'll set the columns to the
        * character to just get all of the columns from the database. Then we
        can build the query and concatenate all the pieces together as one. */
@@ -24,12 +29,21 @@ QString Grammar::compileSelect(QueryBuilder &query) const
     /* To compile the query, we'll spin through each component of the query and
        see if that component exists. If it does we'll just call the compiler
        function for the component which is responsible for making the SQL. */
-    auto sql = concatenate(compileComponents(query));
+    auto components = compileComponents(query);
 
     // Restore original columns value
     query.setColumns(std::move(original));
 
-    return sql;
+    if (query.getUnions().isEmpty())
+        return concatenate(components);
+
+    /* The with clause has to precede the whole union query (if set, it's always
+       the first component), the main query is wrapped like the union queries. */
+    const auto expressions = query.getExpressions().isEmpty() ? QString()
+                                                              : components.takeFirst();
+
+    return concatenate({expressions, wrapUnion(concatenate(components)),
+                        compileUnions(query)});
 }
 
 QString Grammar::compileExists(QueryBuilder &query) const
@@ -62,6 +76,14 @@ QString Grammar::compileInsertOrIgnore(const QueryBuilder &/*unused*/,
                 "errors.");
 }
 
+QString Grammar::compileInsertReturning(const QueryBuilder &query,
+                                        const QVector<QVariantMap> &values,
+                                        const QVector<QString> &columns) const
+{
+    return QStringLiteral("%1 returning %2").arg(compileInsert(query, values),
+                                                 columnize(columns));
+}
+
 QString Grammar::compileUpdate(QueryBuilder &query,
                                const QVector<UpdateItem> &values) const
 {
@@ -78,24 +100,17 @@ QVector<QVariant>
 Grammar::prepareBindingsForUpdate(const BindingsMap &bindings, // NOLINT(readability-convert-member-functions-to-static)
                                   const QVector<UpdateItem> &values) const
 {
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic push
-#  pragma GCC diagnostic ignored "-Wdangling-reference"
-#endif
-    const auto &joinBindings = bindings.find(BindingType::JOIN).value();
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic pop
-#endif
+    const auto joinBindings = bindings[BindingType::JOIN];
 
     QVector<QVariant> preparedBindings;
     preparedBindings.reserve(
-                joinBindings.size() + values.size() +
+                bindings.size(BindingType::JOIN) + values.size() +
                 // Rest of the bindings
                 computeReserveForBindingsMap(bindings, {BindingType::SELECT,
                                                         BindingType::JOIN}));
 
     // Join bindings have to go first, I don't remember why 🫤
-    preparedBindings << joinBindings;
+    std::ranges::copy(joinBindings, std::back_inserter(preparedBindings));
 
     // Merge update values bindings
     std::transform(values.cbegin(), values.cend(), std::back_inserter(preparedBindings),
@@ -158,6 +173,11 @@ QString Grammar::compileRandom(const QString &/*unused*/) const
     return QStringLiteral("RANDOM()");
 }
 
+QString Grammar::compileExplain(const QString &query) const
+{
+    return QStringLiteral("explain %1").arg(query);
+}
+
 const std::unordered_set<QString> &Grammar::getOperators() const
 {
     /* I make it this way, I don't declare it as pure virtual intentionally, this gives
@@ -167,6 +187,12 @@ const std::unordered_set<QString> &Grammar::getOperators() const
     return cachedOperators;
 }
 
+qsizetype Grammar::getMaxPlaceholders() const noexcept
+{
+    // The MySQL and PostgreSQL limit (unsigned 16-bit number of parameters)
+    return 65535;
+}
+
 /* protected */
 
 bool Grammar::shouldCompileAggregate(const std::optional<AggregateItem> &aggregate)
@@ -197,7 +223,7 @@ QStringList Grammar::compileComponents(const QueryBuilder &query) const
        that all compileMap-s have the same size, so it's safe to cache this size. */
     static const auto compileMapSize = compileMap.size();
     // The same size for all instances has to be guaranteed as it's static
-    Q_ASSERT(compileMapSize == 11);
+    Q_ASSERT(compileMapSize == 12);
 
     QStringList sql;
     sql.reserve(compileMapSize);
@@ -209,6 +235,32 @@ QStringList Grammar::compileComponents(const QueryBuilder &query) const
     return sql;
 }
 
+QString Grammar::compileExpressions(const QueryBuilder &query) const
+{
+    const auto &expressions = query.getExpressions();
+
+    QStringList sql;
+    sql.reserve(expressions.size());
+
+    // The recursive keyword applies to the whole with clause
+    auto recursive = false;
+
+    for (const auto &expression : expressions) {
+        recursive |= expression.recursive;
+
+        const auto columns = expression.columns.isEmpty()
+                             ? QString()
+                             : QStringLiteral("(%1) ").arg(columnize(expression.columns));
+
+        sql << QStringLiteral("%1 %2as (%3)").arg(wrapTable(expression.name), columns,
+                                                 expression.query);
+    }
+
+    return QStringLiteral("with %1%2").arg(recursive ? QStringLiteral("recursive ")
+                                                     : QString(),
+                                           sql.join(COMMA));
+}
+
 QString Grammar::compileAggregate(const QueryBuilder &query) const
 {
     /* Whether the aggregate contains a value is checked earlier by
@@ -363,10 +415,8 @@ QString Grammar::compileOrders(const QueryBuilder &query) const
             .arg(columnizeWithoutWrap(compileOrdersToVector(query)));
 }
 
-QStringList Grammar::compileOrdersToVector(const QueryBuilder &query) const
+QStringList Grammar::compileOrdersToVector(const QVector<OrderByItem> &orders) const
 {
-    const auto &orders = query.getOrders();
-
     QStringList compiledOrders;
     compiledOrders.reserve(orders.size());
 
@@ -400,6 +450,55 @@ QString Grammar::compileLock(const QueryBuilder &query) const
     return QLatin1String("");
 }
 
+QString Grammar::compileUnions(const QueryBuilder &query) const
+{
+    const auto &unions = query.getUnions();
+
+    QStringList sql;
+    sql.reserve(unions.size() + 3);
+
+    for (const auto &union_ : unions)
+        sql << compileUnion(union_);
+
+    // The union orders, limit, and offset are applied to the whole union query
+    if (const auto &unionOrders = query.getUnionOrders(); !unionOrders.isEmpty())
+        sql << QStringLiteral("order by %1")
+               .arg(columnizeWithoutWrap(compileOrdersToVector(unionOrders)));
+
+    if (query.getUnionLimit() > -1)
+        sql << QStringLiteral("limit %1").arg(query.getUnionLimit());
+
+    if (query.getUnionOffset() > -1)
+        sql << QStringLiteral("offset %1").arg(query.getUnionOffset());
+
+    return sql.join(SPACE);
+}
+
+QString Grammar::compileUnion(const UnionItem &union_) const
+{
+    return SPACE_IN.arg(union_.all ? QStringLiteral("union all")
+                                   : QStringLiteral("union"),
+                        wrapUnion(union_.query->toSql()));
+}
+
+QString Grammar::wrapUnion(const QString &sql) const
+{
+    return PARENTH_ONE.arg(sql);
+}
+
+QString Grammar::compileUnionAggregate(const QueryBuilder &query) const
+{
+    const auto aggregate = compileAggregate(query);
+
+    // The copy is needed as the aggregate is removed from the union query
+    auto unionQuery = query;
+    unionQuery.clearAggregate();
+
+    return QStringLiteral("%1 from (%2) as %3")
+            .arg(aggregate, compileSelect(unionQuery),
+                 wrapTable(QStringLiteral("temp_table")));
+}
+
 QString Grammar::whereBasic(const WhereConditionItem &where) const
 {
     // FEATURE postgres, try operators with ? vs pdo str_replace(?, ??) https://wiki.php.net/rfc/pdo_escape_placeholders silverqx
@@ -673,13 +772,13 @@ Grammar::flatBindingsForUpdateDelete(const BindingsMap &bindings,
     QVector<std::reference_wrapper<const QVariant>> cleanBindingsFlatten;
     cleanBindingsFlatten.reserve(computeReserveForBindingsMap(bindings, exclude));
 
-    for (auto itBindings = bindings.constBegin();
-         itBindings != bindings.constEnd(); ++itBindings
-    )
-        if (!exclude.isEmpty() && exclude.contains(itBindings.key()))
+    for (std::size_t index = 0; index < BindingsMap::TypesCount; ++index)
+        if (const auto type = static_cast<BindingType>(index);
+            !exclude.isEmpty() && exclude.contains(type)
+        )
             continue;
         else
-            for (const auto &binding : itBindings.value())
+            for (const auto &binding : bindings[type])
                 cleanBindingsFlatten << std::cref(binding);
 
     return cleanBindingsFlatten;
@@ -691,13 +790,13 @@ Grammar::computeReserveForBindingsMap(const BindingsMap &bindings,
 {
     QVector<QVariant>::size_type size = 0;
 
-    for (auto itBindings = bindings.constBegin();
-         itBindings != bindings.constEnd(); ++itBindings
-    )
-        if (!exclude.isEmpty() && exclude.contains(itBindings.key()))
+    for (std::size_t index = 0; index < BindingsMap::TypesCount; ++index)
+        if (const auto type = static_cast<BindingType>(index);
+            !exclude.isEmpty() && exclude.contains(type)
+        )
             continue;
         else
-            size += itBindings.value().size();
+            size += bindings.size(type);
 
     return size;
 }
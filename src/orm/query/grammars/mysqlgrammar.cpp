@@ -121,6 +121,8 @@ MySqlGrammar::getCompileMap() const
 
     // Pointers to compile methods, yes yes c++ 😂
     static const QVector<SelectComponentValue> cached {
+        {bind(&MySqlGrammar::compileExpressions),
+         [](const auto &query) { return !query.getExpressions().isEmpty(); }},
         {bind(&MySqlGrammar::compileAggregate),
          [](const auto &query) { return shouldCompileAggregate(query.getAggregate()); }},
         {bind(&MySqlGrammar::compileColumns),
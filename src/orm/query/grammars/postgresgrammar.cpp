@@ -80,6 +80,11 @@ QString PostgresGrammar::compileLock(const QueryBuilder &query) const
     return std::get<QString>(lock);
 }
 
+QString PostgresGrammar::compileExplain(const QString &query) const
+{
+    return QStringLiteral("explain (format json) %1").arg(query);
+}
+
 const std::unordered_set<QString> &PostgresGrammar::getOperators() const
 {
     static const std::unordered_set<QString> cachedOperators {
@@ -127,6 +132,8 @@ PostgresGrammar::getCompileMap() const
 
     // Pointers to compile methods, yes yes c++ 😂
     static const QVector<SelectComponentValue> cached {
+        {bind(&PostgresGrammar::compileExpressions),
+         [](const auto &query) { return !query.getExpressions().isEmpty(); }},
         {bind(&PostgresGrammar::compileAggregate),
          [](const auto &query) { return shouldCompileAggregate(query.getAggregate()); }},
         {bind(&PostgresGrammar::compileColumns),
@@ -71,6 +71,11 @@ QString SQLiteGrammar::compileLock(const QueryBuilder &/*unused*/) const
     return EMPTY;
 }
 
+QString SQLiteGrammar::compileExplain(const QString &query) const
+{
+    return QStringLiteral("explain query plan %1").arg(query);
+}
+
 const std::unordered_set<QString> &SQLiteGrammar::getOperators() const
 {
     static const std::unordered_set<QString> cachedOperators {
@@ -82,6 +87,13 @@ const std::unordered_set<QString> &SQLiteGrammar::getOperators() const
     return cachedOperators;
 }
 
+qsizetype SQLiteGrammar::getMaxPlaceholders() const noexcept
+{
+    /* The SQLITE_MAX_VARIABLE_NUMBER defaults to 999 for SQLite < 3.32, it can be
+       lowered at compile time, so use the lowest default. */
+    return 999;
+}
+
 /* protected */
 
 const QVector<Grammar::SelectComponentValue> &
@@ -106,6 +118,8 @@ SQLiteGrammar::getCompileMap() const
 
     // Pointers to compile methods, yes yes c++ 😂
     static const QVector<SelectComponentValue> cached {
+        {bind(&SQLiteGrammar::compileExpressions),
+         [](const auto &query) { return !query.getExpressions().isEmpty(); }},
         {bind(&SQLiteGrammar::compileAggregate),
          [](const auto &query) { return shouldCompileAggregate(query.getAggregate()); }},
         {bind(&SQLiteGrammar::compileColumns),
@@ -257,6 +271,11 @@ QString SQLiteGrammar::compileUpdateColumns(const QVector<UpdateItem> &values) c
     return columnizeWithoutWrap(compiledAssignments);
 }
 
+QString SQLiteGrammar::wrapUnion(const QString &sql) const
+{
+    return QStringLiteral("select * from (%1)").arg(sql);
+}
+
 /* private */
 
 QString
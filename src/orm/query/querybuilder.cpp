@@ -8,10 +8,14 @@
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/macros/likely.hpp"
 #include "orm/query/joinclause.hpp"
+#include "orm/support/connectionworkers.hpp"
+#include "orm/support/querycache.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using Orm::Support::ConnectionWorkers;
+using Orm::Support::QueryCache;
 using Orm::Utils::Helpers;
 
 namespace Orm::Query
@@ -169,6 +173,36 @@ namespace
     };
 } // namespace
 
+/* Compiled statements for the DatabaseConnection::batch() */
+
+BatchStatement Builder::toInsertStatement(const QVector<QVariantMap> &values) const
+{
+    // The same as the insert(), the empty statement is skipped by the batch()
+    if (values.isEmpty())
+        return {};
+
+    return {m_grammar->compileInsert(*this, values),
+            cleanBindings(flatValuesForInsert(values))};
+}
+
+BatchStatement Builder::toInsertStatement(const QVariantMap &values) const
+{
+    return toInsertStatement(QVector<QVariantMap> {values});
+}
+
+BatchStatement Builder::toUpdateStatement(const QVector<UpdateItem> &values)
+{
+    return {m_grammar->compileUpdate(*this, values),
+            cleanBindings(m_grammar->prepareBindingsForUpdate(getRawBindings(),
+                                                              values))};
+}
+
+BatchStatement Builder::toDeleteStatement()
+{
+    return {m_grammar->compileDelete(*this),
+            cleanBindings(m_grammar->prepareBindingsForDelete(getRawBindings()))};
+}
+
 /* Insert, Update, Delete */
 
 // TEST for insert silverqx
@@ -215,6 +249,74 @@ quint64 Builder::insertGetId(const QVariantMap &values, const QString &sequence)
     return query.lastInsertId().value<quint64>();
 }
 
+QVector<quint64>
+Builder::insertGetIds(const QVector<QVariantMap> &values, const QString &uniqueKey,
+                      const QString &sequence)
+{
+    if (values.isEmpty())
+        return {};
+
+    /* The lastInsertId() of the multi-row insert can't be used to compute all keys,
+       sequences and auto-increments interleave with concurrent sessions. */
+    if (!m_connection->supportsInsertReturning())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("The '%1' database driver doesn't support returning "
+                               "the inserted rows in %2().")
+                .arg(m_connection->driverName(), __tiny_func__));
+
+    /* Neither the PostgreSQL nor the SQLite database guarantees the order of
+       the returned rows, so they are matched on the unique key of every row. */
+    std::unordered_map<QString, QVector<quint64>::size_type> positions;
+    positions.reserve(static_cast<std::size_t>(values.size()));
+
+    for (QVector<QVariantMap>::size_type i = 0; i < values.size(); ++i) {
+        const auto &row = values.at(i);
+
+        if (!row.contains(uniqueKey) || row.value(uniqueKey).isNull() ||
+            !positions.emplace(row.value(uniqueKey).toString(), i).second
+        )
+            throw Exceptions::InvalidArgumentError(
+                    QStringLiteral("The '%1' unique key must be set and unique for all "
+                                   "inserted rows in %2().")
+                    .arg(uniqueKey, __tiny_func__));
+    }
+
+    const auto &keyName = sequence.isEmpty() ? ID : sequence;
+
+    auto query = m_connection->insert(
+                     m_grammar->compileInsertReturning(*this, values,
+                                                       {keyName, uniqueKey}),
+                     cleanBindings(flatValuesForInsert(values)));
+
+    QVector<quint64> ids(values.size());
+    QVector<quint64>::size_type matched = 0;
+
+    while (query.next()) {
+        const auto itPosition = positions.find(query.value(1).toString());
+
+        if (itPosition == positions.end())
+            throw Exceptions::RuntimeError(
+                    QStringLiteral("The returned '%1' unique key doesn't match any "
+                                   "inserted row in %2().")
+                    .arg(uniqueKey, __tiny_func__));
+
+        ids[itPosition->second] = query.value(0).value<quint64>();
+        ++matched;
+    }
+
+    // Primary keys of the pretended query are unknown
+    if (matched == 0)
+        return {};
+
+    if (matched != values.size())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("The number of returned rows doesn't match the number "
+                               "of inserted rows in %1().")
+                .arg(__tiny_func__));
+
+    return ids;
+}
+
 std::tuple<int, std::optional<QSqlQuery>>
 Builder::insertOrIgnore(const QVector<QVariantMap> &values)
 {
@@ -242,10 +344,16 @@ Builder::insertOrIgnore(const QVector<QString> &columns,
 std::tuple<int, QSqlQuery>
 Builder::update(const QVector<UpdateItem> &values)
 {
-    return m_connection->update(
-                m_grammar->compileUpdate(*this, values),
-                cleanBindings(m_grammar->prepareBindingsForUpdate(getRawBindings(),
-                                                                  values)));
+    throwIfHasExpressions(__tiny_func__);
+    throwIfWriteTimeoutUnsupported(__tiny_func__);
+
+    return m_connection->withQueryTimeout(m_timeout, [this, &values]
+    {
+        return m_connection->update(
+                    m_grammar->compileUpdate(*this, values),
+                    cleanBindings(m_grammar->prepareBindingsForUpdate(getRawBindings(),
+                                                                      values)));
+    });
 }
 
 namespace
@@ -331,9 +439,15 @@ std::tuple<int, QSqlQuery> Builder::deleteRow()
 
 std::tuple<int, QSqlQuery> Builder::remove()
 {
-    return m_connection->remove(
-            m_grammar->compileDelete(*this),
-            cleanBindings(m_grammar->prepareBindingsForDelete(getRawBindings())));
+    throwIfHasExpressions(__tiny_func__);
+    throwIfWriteTimeoutUnsupported(__tiny_func__);
+
+    return m_connection->withQueryTimeout(m_timeout, [this]
+    {
+        return m_connection->remove(
+                m_grammar->compileDelete(*this),
+                cleanBindings(m_grammar->prepareBindingsForDelete(getRawBindings())));
+    });
 }
 
 void Builder::truncate()
@@ -347,15 +461,99 @@ void Builder::truncate()
             m_connection->statement(sql, std::move(bindings));
 }
 
+/* Async queries */
+
+/* The QtSql connection can't be used from other threads, so the query is copied and
+   executed using the thread-local connection of the connection's worker thread. */
+
+template<typename F>
+auto Builder::runAsync(F &&callback) const
+{
+    // Copy the query now, the caller can continue to modify this query
+    return ConnectionWorkers::run(m_connection->getName(),
+                                  [query = std::make_shared<Builder>(*this),
+                                   callback = std::forward<F>(callback)]
+                                  (DatabaseConnection &connection) mutable
+    {
+        query->m_connection = connection.shared_from_this();
+
+        return std::invoke(callback, *query);
+    });
+}
+
+QFuture<QVector<QSqlRecord>> Builder::getAsync(const QVector<Column> &columns) const
+{
+    return runAsync([columns](Builder &query)
+    {
+        return query.get(columns).fetchRecords();
+    });
+}
+
+QFuture<QSqlRecord> Builder::firstAsync(const QVector<Column> &columns) const
+{
+    return runAsync([columns](Builder &query)
+    {
+        const auto records = query.take(1).get(columns).fetchRecords();
+
+        return records.isEmpty() ? QSqlRecord() : records.constFirst();
+    });
+}
+
+QFuture<int> Builder::insertAsync(const QVector<QVariantMap> &values) const
+{
+    return runAsync([values](Builder &query)
+    {
+        const auto insertQuery = query.insert(values);
+
+        return insertQuery ? insertQuery->numRowsAffected() : 0;
+    });
+}
+
+QFuture<int> Builder::insertAsync(const QVariantMap &values) const
+{
+    return insertAsync(QVector<QVariantMap> {values});
+}
+
+QFuture<quint64>
+Builder::insertGetIdAsync(const QVariantMap &values, const QString &sequence) const
+{
+    return runAsync([values, sequence](Builder &query)
+    {
+        return query.insertGetId(values, sequence);
+    });
+}
+
+QFuture<int> Builder::updateAsync(const QVector<UpdateItem> &values) const
+{
+    return runAsync([values](Builder &query)
+    {
+        return std::get<0>(query.update(values));
+    });
+}
+
+QFuture<int> Builder::removeAsync() const
+{
+    return runAsync([](Builder &query)
+    {
+        return std::get<0>(query.remove());
+    });
+}
+
 /* Select */
 
 QVariant Builder::aggregate(const QString &function,
                             const QVector<Column> &columns) const
 {
-    auto resultsQuery = cloneWithout({PropertyType::COLUMNS})
-                        .cloneWithoutBindings({BindingType::SELECT})
-                        .setAggregate(function, columns)
-                        .get(columns);
+    /* The union query is wrapped by the aggregate query, so the main query has to keep
+       its columns and select bindings, they must match the union queries. */
+    auto resultsQuery = m_unions.isEmpty()
+                        ? cloneWithout({PropertyType::COLUMNS})
+                          .cloneWithoutBindings({BindingType::SELECT})
+                          .setAggregate(function, columns)
+                          .get(columns)
+                        : Builder(*this)
+                          .setAggregate(function, columns)
+                          .get({});
 
     // Empty result
     if (!resultsQuery.first())
@@ -366,7 +564,10 @@ QVariant Builder::aggregate(const QString &function,
 
 bool Builder::exists()
 {
-    auto results = m_connection->select(m_grammar->compileExists(*this), getBindings());
+    auto results = m_connection->withQueryTimeout(m_timeout, [this]
+    {
+        return m_connection->select(m_grammar->compileExists(*this), getBindings());
+    });
 
     /* If the results have rows, we will get the row and see if the exists column is a
        boolean true. If there are no results for this query we will return false as
@@ -543,6 +744,14 @@ Builder &Builder::fromRaw(const QString &expression, const QVector<QVariant> &bi
     return *this;
 }
 
+/* Unions */
+
+Builder &Builder::union_(const std::shared_ptr<Builder> &query, const bool all)
+{
+    // The union query is a copy as its bindings are copied
+    return unionInternal(std::make_shared<Builder>(*query), all);
+}
+
 /* Nested where */
 
 Builder &Builder::where(const std::function<void(Builder &)> &callback,
@@ -1020,7 +1229,8 @@ Builder &Builder::orderBy(const Column &column, const QString &direction)
                     "in %1().)")
                 .arg(__tiny_func__));
 
-    m_orders.append({column, directionLower});
+    // The orders are applied to the whole union query if it has unions
+    (m_unions.isEmpty() ? m_orders : m_unionOrders).append({column, directionLower});
 
     return *this;
 }
@@ -1037,9 +1247,16 @@ Builder &Builder::inRandomOrder(const QString &seed)
 
 Builder &Builder::orderByRaw(const QString &sql, const QVector<QVariant> &bindings)
 {
-    m_orders.append({.sql = sql});
+    if (m_unions.isEmpty()) {
+        m_orders.append({.sql = sql});
 
-    addBinding(bindings, BindingType::ORDER);
+        addBinding(bindings, BindingType::ORDER);
+    }
+    else {
+        m_unionOrders.append({.sql = sql});
+
+        addBinding(bindings, BindingType::UNIONORDER);
+    }
 
     return *this;
 }
@@ -1060,8 +1277,10 @@ Builder &Builder::oldest(const Column &column)
 Builder &Builder::reorder()
 {
     m_orders.clear();
+    m_unionOrders.clear();
 
-    m_bindings[BindingType::ORDER].clear();
+    m_bindings.clear(BindingType::ORDER);
+    m_bindings.clear(BindingType::UNIONORDER);
 
     return *this;
 }
@@ -1082,7 +1301,7 @@ Builder &Builder::limit(const qint64 value)
     Q_ASSERT(value >= 0);
 
     if (value >= 0)
-        m_limit = value;
+        (m_unions.isEmpty() ? m_limit : m_unionLimit) = value;
 
     return *this;
 }
@@ -1096,7 +1315,8 @@ Builder &Builder::offset(const qint64 value)
 {
     Q_ASSERT(value >= 0);
 
-    m_offset = std::max<decltype (value)>(0, value);
+    (m_unions.isEmpty() ? m_offset : m_unionOffset) =
+            std::max<decltype (value)>(0, value);
 
     return *this;
 }
@@ -1192,6 +1412,34 @@ Builder &Builder::lock(QString &&value)
     return *this;
 }
 
+/* Query timeout */
+
+Builder &Builder::timeout(const int milliseconds)
+{
+    if (milliseconds < 0)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The statement timeout must be >=0, '%1' given in %2().")
+                .arg(milliseconds).arg(__tiny_func__));
+
+    m_timeout = milliseconds;
+
+    return *this;
+}
+
+/* Query cache */
+
+Builder &Builder::remember(const int seconds)
+{
+    if (seconds <= 0)
+        throw Exceptions::InvalidArgumentError(
+                QStringLiteral("The query cache ttl must be >0, '%1' given in %2().")
+                .arg(seconds).arg(__tiny_func__));
+
+    m_remember = seconds;
+
+    return *this;
+}
+
 /* Debugging */
 
 // NOTE api different, added the replaceBindings and simpleBindings parameters silverqx
@@ -1232,13 +1480,8 @@ const QString &Builder::defaultKeyName() const noexcept // NOLINT(readability-co
 
 QVector<QVariant> Builder::getBindings() const
 {
-    QVector<QVariant> flattenBindings;
-
-    for (const auto &bindings : std::as_const(m_bindings))
-        for (const auto &binding : bindings)
-            flattenBindings << binding;
-
-    return flattenBindings;
+    // Bindings are already stored flattened, the returned copy is implicitly shared
+    return m_bindings.flatten();
 }
 
 Builder &Builder::addBinding(const QVariant &binding, const BindingType type)
@@ -1248,7 +1491,7 @@ Builder &Builder::addBinding(const QVariant &binding, const BindingType type)
     checkBindingType(type);
 #endif
 
-    m_bindings[type] << binding;
+    m_bindings.append(type, binding);
 
     return *this;
 }
@@ -1260,7 +1503,7 @@ Builder &Builder::addBinding(QVariant &&binding, const BindingType type)
     checkBindingType(type);
 #endif
 
-    m_bindings[type] << std::move(binding);
+    m_bindings.append(type, std::move(binding));
 
     return *this;
 }
@@ -1272,8 +1515,7 @@ Builder &Builder::addBinding(const QVector<QVariant> &bindings, const BindingTyp
     checkBindingType(type);
 #endif
 
-    if (!bindings.isEmpty())
-        std::ranges::copy(bindings, std::back_inserter(m_bindings[type]));
+    m_bindings.append(type, bindings);
 
     return *this;
 }
@@ -1285,12 +1527,7 @@ Builder &Builder::addBinding(QVector<QVariant> &&bindings, const BindingType typ
     checkBindingType(type);
 #endif
 
-    if (bindings.isEmpty())
-        return *this;
-
-    auto &bindingsRef = m_bindings[type]; // clazy:exclude=detaching-member
-    bindingsRef.reserve(bindings.size());
-    std::ranges::move(bindings, std::back_inserter(bindingsRef));
+    m_bindings.append(type, std::move(bindings));
 
     return *this;
 }
@@ -1302,10 +1539,7 @@ Builder &Builder::setBindings(QVector<QVariant> &&bindings, const BindingType ty
     checkBindingType(type);
 #endif
 
-    auto &bindingsRef = m_bindings[type]; // clazy:exclude=detaching-member
-
-    bindingsRef.reserve(bindings.size());
-    bindingsRef = std::move(bindings);
+    m_bindings.set(type, std::move(bindings));
 
     return *this;
 }
@@ -1356,16 +1590,7 @@ Builder &Builder::addNestedWhereQuery(const std::shared_ptr<Builder> &query,
     m_wheres.append({.column = {}, .condition = condition, .type = WhereType::NESTED,
                      .nestedQuery = query});
 
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic push
-#  pragma GCC diagnostic ignored "-Wdangling-reference"
-#endif
-    const auto &whereBindings = query->getRawBindings().find(BindingType::WHERE).value();
-#if defined(__GNUG__) && !defined(__clang__)
-#  pragma GCC diagnostic pop
-#endif
-
-    addBinding(whereBindings, BindingType::WHERE);
+    addBinding(query->getRawBindings().value(BindingType::WHERE), BindingType::WHERE);
 
     return *this;
 }
@@ -1403,7 +1628,7 @@ Builder &Builder::mergeWheres(const QVector<WhereConditionItem> &wheres,
 {
     m_wheres += wheres;
 
-    m_bindings[BindingType::WHERE] += bindings;
+    m_bindings.append(BindingType::WHERE, bindings);
 
     return *this;
 }
@@ -1414,9 +1639,7 @@ Builder::mergeWheres(QVector<WhereConditionItem> &&wheres, QVector<QVariant> &&b
     m_wheres.reserve(wheres.size());
     std::ranges::move(wheres, std::back_inserter(m_wheres));
 
-    auto &bindingsRef = m_bindings[BindingType::WHERE]; // clazy:exclude=detaching-member
-    bindingsRef.reserve(bindings.size());
-    std::ranges::move(bindings, std::back_inserter(bindingsRef));
+    m_bindings.append(BindingType::WHERE, std::move(bindings));
 
     return *this;
 }
@@ -1446,7 +1669,7 @@ Builder Builder::cloneWithoutBindings(
     for (const auto bindingType : except)
         switch (bindingType) { // NOLINT(hicpp-multiway-paths-covered)
         case BindingType::SELECT:
-            copy.m_bindings[BindingType::SELECT].clear();
+            copy.m_bindings.clear(BindingType::SELECT);
             break;
 
         default:
@@ -1460,6 +1683,13 @@ Builder Builder::cloneWithoutBindings(
 
 void Builder::throwIfInvalidOperator(const QString &comparison) const
 {
+    /* Operators are interned in the static sets, the most of operators are symbols
+       or are already lowercase, so the lowercased copy is created only if needed. */
+    if (getOperators().contains(comparison) ||
+        m_grammar->getOperators().contains(comparison)
+    )
+        return;
+
     const auto comparison_ = comparison.toLower();
 
     if (getOperators().contains(comparison_) ||
@@ -1565,7 +1795,7 @@ Builder &Builder::clearColumns()
 {
     m_columns.clear();
 
-    m_bindings[BindingType::SELECT].clear();
+    m_bindings.clear(BindingType::SELECT);
 
     return *this;
 }
@@ -1688,7 +1918,7 @@ Builder &Builder::setAggregate(const QString &function, const QVector<Column> &c
     if (m_groups.isEmpty()) {
         m_orders.clear();
 
-        m_bindings[BindingType::ORDER].clear();
+        m_bindings.clear(BindingType::ORDER);
     }
 
     return *this;
@@ -1698,7 +1928,99 @@ Builder &Builder::setAggregate(const QString &function, const QVector<Column> &c
 
 SqlQuery Builder::runSelect()
 {
-    return m_connection->select(toSql(), getBindings());
+    return m_connection->withQueryTimeout(m_timeout, [this]
+    {
+        if (m_remember)
+            return m_connection->selectRemembered(toSql(), getBindings(), *m_remember,
+                                                  tablesForQueryCache());
+
+        return m_connection->select(toSql(), getBindings());
+    });
+}
+
+namespace
+{
+    bool collectQueryTables(const Builder &query, const QString &prefix,
+                            QStringList &tables);
+
+    /*! Collect the tables read by the given where clauses, returns false if they
+        can't be detected (raw clauses and expressions can contain subqueries). */
+    bool collectWhereTables(const QVector<WhereConditionItem> &wheres,
+                            const QString &prefix, QStringList &tables)
+    {
+        for (const auto &where : wheres) {
+            if (where.type == WhereType::RAW ||
+                std::holds_alternative<Expression>(where.column) ||
+                where.value.canConvert<Expression>()
+            )
+                return false;
+
+            // Nested where-s and the where exists subqueries
+            if (where.nestedQuery &&
+                !collectQueryTables(*where.nestedQuery, prefix, tables)
+            )
+                return false;
+        }
+
+        return true;
+    }
+
+    /*! Collect the normalized tables read by the given query, returns false if they
+        can't be detected. */
+    bool collectQueryTables(const Builder &query, const QString &prefix,
+                            QStringList &tables)
+    {
+        const auto &from = query.getFrom();
+
+        // Subqueries, raw expressions, and common table expressions
+        if (!std::holds_alternative<QString>(from) || !query.getExpressions().isEmpty())
+            return false;
+
+        tables << prefix + QueryCache::normalizeTable(std::get<QString>(from));
+
+        for (const auto &column : query.getColumns())
+            if (std::holds_alternative<Expression>(column))
+                return false;
+
+        for (const auto &join : query.getJoins()) {
+            const auto &table = join->getTable();
+
+            if (!std::holds_alternative<QString>(table) ||
+                !collectWhereTables(join->getWheres(), prefix, tables)
+            )
+                return false;
+
+            tables << prefix + QueryCache::normalizeTable(std::get<QString>(table));
+        }
+
+        for (const auto &union_ : query.getUnions())
+            if (!collectQueryTables(*union_.query, prefix, tables))
+                return false;
+
+        return collectWhereTables(query.getWheres(), prefix, tables);
+    }
+} // namespace
+
+QStringList Builder::tablesForQueryCache() const
+{
+    QStringList tables;
+
+    if (!collectQueryTables(*this, m_connection->getTablePrefix().toLower(), tables))
+        return {};
+
+    tables.removeDuplicates();
+
+    return tables;
+}
+
+Builder &Builder::unionInternal(std::shared_ptr<Builder> &&query, const bool all)
+{
+    addBinding(query->getBindings(), BindingType::UNION);
+
+    // Move ownership
+    m_unions.append({std::move(query), all});
+
+    return *this;
 }
 
 Builder &Builder::joinInternal(
@@ -1783,7 +2105,7 @@ Builder &Builder::whereInternal(
 
 void Builder::checkBindingType(const BindingType type) const
 {
-    if (m_bindings.contains(type))
+    if (static_cast<std::size_t>(type) < BindingsMap::TypesCount)
         return;
 
     // TODO add hash which maps BindingType to the QString silverqx
@@ -1793,6 +2115,28 @@ void Builder::checkBindingType(const BindingType type) const
                 .arg(__tiny_func__));
 }
 
+void Builder::throwIfHasExpressions(const QString &method) const
+{
+    if (m_expressions.isEmpty())
+        return;
+
+    throw Exceptions::RuntimeError(
+                QStringLiteral("Common table expressions are supported for the select "
+                               "queries only in %1().")
+                .arg(method));
+}
+
+void Builder::throwIfWriteTimeoutUnsupported(const QString &method) const
+{
+    if (!m_timeout || *m_timeout == 0 || m_connection->supportsWriteQueryTimeout())
+        return;
+
+    throw Exceptions::RuntimeError(
+                QStringLiteral("The statement timeout is supported for the select "
+                               "queries only on the '%1' connection in %2().")
+                .arg(m_connection->getName(), method));
+}
+
 const std::unordered_set<QString> &Builder::getOperators()
 {
     static const std::unordered_set<QString> cachedOperators {
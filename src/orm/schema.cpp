@@ -27,6 +27,21 @@ Schema::dropDatabaseIfExists(const QString &name, const QString &connection)
     return schemaBuilder(connection).dropDatabaseIfExists(name);
 }
 
+void Schema::createSnapshot(const QString &name, const QString &connection)
+{
+    schemaBuilder(connection).createSnapshot(name);
+}
+
+void Schema::restoreSnapshot(const QString &name, const QString &connection)
+{
+    schemaBuilder(connection).restoreSnapshot(name);
+}
+
+void Schema::dropSnapshotIfExists(const QString &name, const QString &connection)
+{
+    schemaBuilder(connection).dropSnapshotIfExists(name);
+}
+
 void Schema::create(
         const QString &table, const std::function<void(Blueprint &)> &callback,
         const QString &connection)
@@ -5,6 +5,7 @@
 #include <range/v3/view/filter.hpp>
 
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/nontransactionalcommanderror.hpp"
 #include "orm/macros/likely.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -35,8 +36,13 @@ Blueprint::Blueprint(
 
 void Blueprint::build(DatabaseConnection &connection, const SchemaGrammar &grammar)
 {
-    // TODO clazy, old clazy check range-loop, remove after ugprade to newer clazy 1.11, it was divided to two checks in clazy 1.11 silverqx
-    for (const auto &queryString : toSql(connection, grammar)) // clazy:exclude=range-loop,range-loop-detach
+    const auto statements = toSql(connection, grammar);
+
+    /* Nothing from this blueprint was executed yet, so the caller can safely roll back
+       and run it again outside of a transaction, eg. the Migrator does it. */
+    throwIfCantRunInTransaction(connection, grammar);
+
+    for (const auto &queryString : statements)
         /* All compile methods in the SchemaBuilders are unprepared, eg. the PostgreSQL
            driver even doesn't allow to send DDL commands as prepared statements,
            MySQL driver supports to send DDL commands as prepared statements. */
@@ -218,6 +224,64 @@ const RenameCommand &Blueprint::renameIndex(const QString &from, const QString &
     return addCommand<RenameCommand>({{}, RenameIndex, from, to});
 }
 
+const IndexCommand &Blueprint::validateForeign(const QVector<QString> &columns)
+{
+    return dropIndexCommand(ValidateForeign, Foreign, columns);
+}
+
+const PartitionByCommand &
+Blueprint::partitionByRange(const QVector<QString> &columns)
+{
+    return addCommand<PartitionByCommand>({{}, PartitionBy, PartitionRange, columns});
+}
+
+const PartitionByCommand &
+Blueprint::partitionByList(const QVector<QString> &columns)
+{
+    return addCommand<PartitionByCommand>({{}, PartitionBy, PartitionList, columns});
+}
+
+const PartitionByCommand &
+Blueprint::partitionByHash(const QVector<QString> &columns, const int partitions)
+{
+    return addCommand<PartitionByCommand>(
+                {{}, PartitionBy, PartitionHash, columns, partitions});
+}
+
+const PartitionCommand &
+Blueprint::rangePartition(const QString &partition, const QVariant &from,
+                          const QVariant &to)
+{
+    return addCommand<PartitionCommand>(
+                {{}, AddPartition, partition, PartitionRange, from, to});
+}
+
+const PartitionCommand &
+Blueprint::listPartition(const QString &partition, const QVector<QVariant> &values)
+{
+    return addCommand<PartitionCommand>(
+                {{}, AddPartition, partition, PartitionList, {}, {}, values});
+}
+
+const PartitionCommand &
+Blueprint::hashPartition(const QString &partition, const int modulus,
+                         const int remainder)
+{
+    return addCommand<PartitionCommand>(
+                {{}, AddPartition, partition, PartitionHash, {}, {}, {}, modulus,
+                 remainder});
+}
+
+const PartitionCommand &Blueprint::detachPartition(const QString &partition)
+{
+    return addCommand<PartitionCommand>({{}, DetachPartition, partition});
+}
+
+const PartitionCommand &Blueprint::dropPartition(const QString &partition)
+{
+    return addCommand<PartitionCommand>({{}, DropPartition, partition});
+}
+
 ForeignIdColumnDefinitionReference Blueprint::foreignId(const QString &column)
 {
     return {*this, unsignedBigInteger(column)};
@@ -687,6 +751,22 @@ void Blueprint::addFluentCommands(const SchemaGrammar &grammar)
                         {{}, commandName, column.name, column.comment, column.change});
 }
 
+void Blueprint::throwIfCantRunInTransaction(const DatabaseConnection &connection,
+                                            const SchemaGrammar &grammar) const
+{
+    if (!connection.inTransaction())
+        return;
+
+    for (const auto &command : m_commands)
+        if (grammar.isNonTransactionalCommand(*command, *this))
+            throw Exceptions::NonTransactionalCommandError(
+                    QStringLiteral(
+                        "The '%1' command for the '%2' table can't be executed inside "
+                        "a transaction block, in %3().")
+                    .arg(reinterpret_cast<const BasicCommand &>(*command).name,
+                         m_table, __tiny_func__));
+}
+
 IndexDefinitionReference
 Blueprint::indexCommand(const QString &type, const QVector<QString> &columns,
                         const QString &indexName, const QString &algorithm,
@@ -1,6 +1,7 @@
 #include "orm/schema/grammars/mysqlschemagrammar.hpp"
 
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -89,6 +90,14 @@ MySqlSchemaGrammar::compileCreate(const Blueprint &blueprint,
     // Add storage engine declaration to the SQL query if has been supplied
     compileCreateEngine(sqlCreateTable, connection, blueprint);
 
+    // Add the partitioning clause together with all partitions defined on the blueprint
+    if (const auto partitionBy = getCommandByName(blueprint, PartitionBy); partitionBy)
+        sqlCreateTable += QStringLiteral(" %1").arg(
+                              compilePartitionByClause(
+                                  blueprint,
+                                  reinterpret_cast<const PartitionByCommand &>(
+                                      *partitionBy)));
+
     return {std::move(sqlCreateTable)};
 }
 
@@ -164,7 +173,7 @@ MySqlSchemaGrammar::compilePrimary(const Blueprint &blueprint,
                      command.algorithm.isEmpty() ? QString("")
                                                  : QStringLiteral("using %1")
                                                    .arg(command.algorithm),
-                     columnize(command.columns))};
+                     columnize(getKeyColumns(command, Primary)))};
 }
 
 QVector<QString>
@@ -185,14 +194,18 @@ QVector<QString>
 MySqlSchemaGrammar::compileFullText(const Blueprint &blueprint,
                                     const IndexCommand &command) const
 {
-    return {compileKey(blueprint, command, QStringLiteral("fulltext index"))};
+    // Adding the fulltext index in-place doesn't allow concurrent writes
+    return {compileKey(blueprint, command, QStringLiteral("fulltext index"),
+                       QStringLiteral("shared"))};
 }
 
 QVector<QString>
 MySqlSchemaGrammar::compileSpatialIndex(const Blueprint &blueprint,
                                         const IndexCommand &command) const
 {
-    return {compileKey(blueprint, command, QStringLiteral("spatial index"))};
+    // Adding the spatial index in-place doesn't allow concurrent writes
+    return {compileKey(blueprint, command, QStringLiteral("spatial index"),
+                       QStringLiteral("shared"))};
 }
 
 QVector<QString>
@@ -207,8 +220,9 @@ QVector<QString>
 MySqlSchemaGrammar::compileDropIndex(const Blueprint &blueprint,
                                      const IndexCommand &command) const
 {
-    return {QStringLiteral("alter table %1 drop index %2")
-                .arg(wrapTable(blueprint), BaseGrammar::wrap(command.index))};
+    return {QStringLiteral("alter table %1 drop index %2%3")
+                .arg(wrapTable(blueprint), BaseGrammar::wrap(command.index),
+                     compileOnline(blueprint, command))};
 }
 
 QVector<QString>
@@ -228,6 +242,48 @@ MySqlSchemaGrammar::compileRenameIndex(const Blueprint &blueprint,
                      BaseGrammar::wrap(command.to))};
 }
 
+QVector<QString>
+MySqlSchemaGrammar::compilePartitionBy(const Blueprint &blueprint,
+                                       const PartitionByCommand &command) const
+{
+    // The partition by clause is compiled in the compileCreate()
+    if (blueprint.creating())
+        return {};
+
+    return {QStringLiteral("alter table %1 %2")
+                .arg(wrapTable(blueprint), compilePartitionByClause(blueprint, command))};
+}
+
+QVector<QString>
+MySqlSchemaGrammar::compileAddPartition(const Blueprint &blueprint,
+                                        const PartitionCommand &command) const
+{
+    // Defined inline in the partition by clause
+    if (getCommandByName(blueprint, PartitionBy))
+        return {};
+
+    return {QStringLiteral("alter table %1 add partition (%2)")
+                .arg(wrapTable(blueprint), compilePartitionDefinition(command))};
+}
+
+QVector<QString>
+MySqlSchemaGrammar::compileDetachPartition(const Blueprint &/*unused*/,
+                                           const PartitionCommand &/*unused*/) const
+{
+    throw Exceptions::LogicError(
+                QStringLiteral("The MySQL database doesn't support detaching partitions, "
+                               "in %1().")
+                .arg(__tiny_func__));
+}
+
+QVector<QString>
+MySqlSchemaGrammar::compileDropPartition(const Blueprint &blueprint,
+                                         const PartitionCommand &command) const
+{
+    return {QStringLiteral("alter table %1 drop partition %2")
+                .arg(wrapTable(blueprint), BaseGrammar::wrap(command.partition))};
+}
+
 QVector<QString>
 MySqlSchemaGrammar::compileTableComment(const Blueprint &blueprint,
                                         const TableCommentCommand &command) const
@@ -305,10 +361,17 @@ MySqlSchemaGrammar::invokeCompileMethod(const CommandDefinition &command,
 
         {RenameIndex,      bind(&MySqlSchemaGrammar::compileRenameIndex)},
 
+        // PostgreSQL specific, MySQL validates foreign keys when they are added
+        {ValidateForeign,  bind(&MySqlSchemaGrammar::compileValidateForeign)},
+
         // MySQL and PostgreSQL specific
         {AutoIncrementStartingValue,
                            bind(&MySqlSchemaGrammar::compileAutoIncrementStartingValue)},
         {TableComment,     bind(&MySqlSchemaGrammar::compileTableComment)},
+        {PartitionBy,      bind(&MySqlSchemaGrammar::compilePartitionBy)},
+        {AddPartition,     bind(&MySqlSchemaGrammar::compileAddPartition)},
+        {DetachPartition,  bind(&MySqlSchemaGrammar::compileDetachPartition)},
+        {DropPartition,    bind(&MySqlSchemaGrammar::compileDropPartition)},
 
         /* PostgreSQL specific, this is not needed for MySQL, it uses modifier for column
            comments, the Comment command will never by invoked, but I'm adding
@@ -420,14 +483,113 @@ MySqlSchemaGrammar::compileAutoIncrementStartingValue(
 
 QString
 MySqlSchemaGrammar::compileKey(const Blueprint &blueprint, const IndexCommand &command,
-                               const QString &type) const
+                               const QString &type, const QString &lock) const
 {
-    return QStringLiteral("alter table %1 add %2 %3%4(%5)")
+    return QStringLiteral("alter table %1 add %2 %3%4(%5)%6")
             .arg(wrapTable(blueprint), type, BaseGrammar::wrap(command.index),
                  command.algorithm.isEmpty() ? QString("")
                                              : QStringLiteral(" using %1")
                                                .arg(command.algorithm),
-                 columnize(command.columns));
+                 columnize(getKeyColumns(command, type)),
+                 compileOnline(blueprint, command, lock));
+}
+
+QVector<Column>
+MySqlSchemaGrammar::getKeyColumns(const IndexCommand &command, const QString &type)
+{
+    if (!command.where.isEmpty())
+        throw Exceptions::LogicError(
+                QStringLiteral("The MySQL database doesn't support partial indexes, "
+                               "in %1().")
+                .arg(__tiny_func__));
+
+    if (command.includes.isEmpty())
+        return command.columns;
+
+    /* MySQL doesn't support non-key index columns, the covering index is created
+       by appending them to the index key, this would change the uniqueness of other
+       index types. */
+    if (type != Index)
+        throw Exceptions::LogicError(
+                QStringLiteral("The MySQL database supports include columns only "
+                               "for the plain index, in %1().")
+                .arg(__tiny_func__));
+
+    auto columns = command.columns;
+    columns.reserve(columns.size() + command.includes.size());
+
+    std::ranges::copy(command.includes, std::back_inserter(columns));
+
+    return columns;
+}
+
+QString MySqlSchemaGrammar::compileOnline(const Blueprint &blueprint,
+                                          const IndexCommand &command,
+                                          const QString &lock)
+{
+    if (!isOnlineIndex(blueprint, command))
+        return {};
+
+    return QStringLiteral(", algorithm=inplace, lock=%1").arg(lock);
+}
+
+QString
+MySqlSchemaGrammar::compilePartitionByClause(const Blueprint &blueprint,
+                                             const PartitionByCommand &command) const
+{
+    QString sql;
+
+    /* The key partitioning is the hash partitioning which supports all column types,
+       the columns partitioning supports all integer, date, and string columns. */
+    if (command.method == PartitionHash) {
+        sql = QStringLiteral("partition by key (%1)").arg(columnize(command.columns));
+
+        if (command.partitions > 0)
+            sql += QStringLiteral(" partitions %1").arg(command.partitions);
+    }
+    else
+        sql = QStringLiteral("partition by %1 columns(%2)")
+              .arg(command.method, columnize(command.columns));
+
+    const auto partitionCommands = getCommandsByName(blueprint, AddPartition);
+
+    if (partitionCommands.isEmpty())
+        return sql;
+
+    QStringList partitions;
+    partitions.reserve(partitionCommands.size());
+
+    for (const auto &partition : partitionCommands)
+        partitions << compilePartitionDefinition(
+                          reinterpret_cast<const PartitionCommand &>(*partition));
+
+    return sql += QStringLiteral(" (%1)").arg(partitions.join(COMMA));
+}
+
+QString
+MySqlSchemaGrammar::compilePartitionDefinition(const PartitionCommand &command) const
+{
+    const auto partition = BaseGrammar::wrap(command.partition);
+
+    if (command.method == PartitionRange)
+        return QStringLiteral("partition %1 values less than (%2)")
+                .arg(partition, command.to.isNull() ? QStringLiteral("maxvalue")
+                                                    : getPartitionValue(command.to));
+
+    if (command.method == PartitionList) {
+        QStringList values;
+        values.reserve(command.values.size());
+
+        for (const auto &value : command.values)
+            values << getPartitionValue(value);
+
+        return QStringLiteral("partition %1 values in (%2)")
+                .arg(partition, values.join(COMMA));
+    }
+
+    Q_ASSERT(command.method == PartitionHash);
+
+    return QStringLiteral("partition %1").arg(partition);
 }
 
 // Duplicate in the MysqlGrammar is OK
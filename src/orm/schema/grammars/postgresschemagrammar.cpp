@@ -1,5 +1,7 @@
 #include "orm/schema/grammars/postgresschemagrammar.hpp"
 
+#include <unordered_set>
+
 #include "orm/databaseconnection.hpp"
 #include "orm/exceptions/logicerror.hpp"
 #include "orm/utils/type.hpp"
@@ -91,11 +93,36 @@ QString PostgresSchemaGrammar::compileColumnListing(const QString &/*unused*/) c
 QVector<QString>
 PostgresSchemaGrammar::compileCreate(const Blueprint &blueprint) const
 {
-    return {QStringLiteral("%1 table %2 (%3)")
-                .arg(blueprint.isTemporary() ? QStringLiteral("create temporary")
-                                             : Create,
-                     wrapTable(blueprint),
-                     columnizeWithoutWrap(getColumns(blueprint)))};
+    auto sql = QStringLiteral("%1 table %2 (%3)")
+               .arg(blueprint.isTemporary() ? QStringLiteral("create temporary")
+                                            : Create,
+                    wrapTable(blueprint),
+                    columnizeWithoutWrap(getColumns(blueprint)));
+
+    const auto partitionByCommand = getCommandByName(blueprint, PartitionBy);
+
+    if (!partitionByCommand)
+        return {std::move(sql)};
+
+    const auto &partitionBy =
+            reinterpret_cast<const PartitionByCommand &>(*partitionByCommand);
+
+    sql += QStringLiteral(" partition by %1 (%2)")
+           .arg(partitionBy.method, columnize(partitionBy.columns));
+
+    QVector<QString> statements {std::move(sql)};
+    statements.reserve(partitionBy.partitions + 1);
+
+    // Create the given number of hash partitions, named table_remainder
+    for (auto remainder = 0; remainder < partitionBy.partitions; ++remainder)
+        statements << compilePartitionOf(
+                          blueprint,
+                          QStringLiteral("%1_%2").arg(blueprint.getTable())
+                                                 .arg(remainder),
+                          QStringLiteral("for values with (modulus %1, remainder %2)")
+                          .arg(partitionBy.partitions).arg(remainder));
+
+    return statements;
 }
 
 QVector<QString>
@@ -172,17 +199,33 @@ QVector<QString>
 PostgresSchemaGrammar::compilePrimary(const Blueprint &blueprint,
                                       const IndexCommand &command) const
 {
-    return {QStringLiteral("alter table %1 add primary key (%2)")
-                .arg(wrapTable(blueprint), columnize(command.columns))};
+    // The primary key is always the constraint, it can't be partial
+    if (!command.where.isEmpty())
+        throw Exceptions::LogicError(
+                QStringLiteral("The PostgreSQL database doesn't support partial primary "
+                               "keys, in %1().")
+                .arg(__tiny_func__));
+
+    return {QStringLiteral("alter table %1 add primary key (%2)%3")
+                .arg(wrapTable(blueprint), columnize(command.columns),
+                     compileIndexOptions(command))};
 }
 
 QVector<QString>
 PostgresSchemaGrammar::compileUnique(const Blueprint &blueprint,
                                      const IndexCommand &command) const
 {
-    return {QStringLiteral("alter table %1 add constraint %2 unique (%3)")
+    /* The unique constraint can't be added concurrently or be partial, but the unique
+       index can, it enforces the uniqueness the same way. */
+    if (isOnlineIndex(blueprint, command) || !command.where.isEmpty())
+        return {QStringLiteral("create unique index %1%2 on %3 (%4)%5")
+                    .arg(compileConcurrently(blueprint, command),
+                         BaseGrammar::wrap(command.index), wrapTable(blueprint),
+                         columnize(command.columns), compileIndexOptions(command))};
+
+    return {QStringLiteral("alter table %1 add constraint %2 unique (%3)%4")
                 .arg(wrapTable(blueprint), BaseGrammar::wrap(command.index),
-                     columnize(command.columns))};
+                     columnize(command.columns), compileIndexOptions(command))};
 }
 
 QVector<QString>
@@ -193,9 +236,11 @@ PostgresSchemaGrammar::compileIndex(const Blueprint &blueprint,
                            ? QString("")
                            : QStringLiteral(" using %1").arg(command.algorithm);
 
-    return {QStringLiteral("create index %1 on %2%3 (%4)")
-                .arg(BaseGrammar::wrap(command.index), wrapTable(blueprint),
-                     algorithm, columnize(command.columns))};
+    return {QStringLiteral("create index %1%2 on %3%4 (%5)%6")
+                .arg(compileConcurrently(blueprint, command),
+                     BaseGrammar::wrap(command.index), wrapTable(blueprint),
+                     algorithm, columnize(command.columns),
+                     compileIndexOptions(command))};
 }
 
 QVector<QString>
@@ -217,10 +262,12 @@ PostgresSchemaGrammar::compileFullText(const Blueprint &blueprint,
 
     /* Double (()) described here, simply it's a expression not the column name:
        https://www.postgresql.org/docs/10/indexes-expressional.html */
-    return {QStringLiteral("create index %1 on %2 using gin ((%3))")
-                .arg(BaseGrammar::wrap(command.index),
+    return {QStringLiteral("create index %1%2 on %3 using gin ((%4))%5")
+                .arg(compileConcurrently(blueprint, command),
+                     BaseGrammar::wrap(command.index),
                      wrapTable(blueprint),
-                     ContainerUtils::join(columns, QStringLiteral(" || ")))};
+                     ContainerUtils::join(columns, QStringLiteral(" || ")),
+                     compileIndexOptions(command))};
 }
 
 QVector<QString>
@@ -271,10 +318,12 @@ PostgresSchemaGrammar::compileDropPrimary(const Blueprint &blueprint,
 }
 
 QVector<QString>
-PostgresSchemaGrammar::compileDropIndex(const Blueprint &/*unused*/,
+PostgresSchemaGrammar::compileDropIndex(const Blueprint &blueprint,
                                         const IndexCommand &command) const
 {
-    return {QStringLiteral("drop index %1").arg(BaseGrammar::wrap(command.index))};
+    return {QStringLiteral("drop index %1%2")
+                .arg(compileConcurrently(blueprint, command),
+                     BaseGrammar::wrap(command.index))};
 }
 
 QVector<QString>
@@ -285,6 +334,53 @@ PostgresSchemaGrammar::compileRenameIndex(const Blueprint &/*unused*/,
                 .arg(BaseGrammar::wrap(command.from), BaseGrammar::wrap(command.to))};
 }
 
+QVector<QString>
+PostgresSchemaGrammar::compileValidateForeign(const Blueprint &blueprint,
+                                              const IndexCommand &command) const
+{
+    return {QStringLiteral("alter table %1 validate constraint %2")
+                .arg(wrapTable(blueprint), BaseGrammar::wrap(command.index))};
+}
+
+QVector<QString>
+PostgresSchemaGrammar::compilePartitionBy(const Blueprint &blueprint,
+                                          const PartitionByCommand &/*unused*/) const
+{
+    // The partition by clause is compiled in the compileCreate()
+    if (blueprint.creating())
+        return {};
+
+    throw Exceptions::LogicError(
+                QStringLiteral(
+                    "The PostgreSQL database can't partition the existing '%1' table, "
+                    "the table has to be created as partitioned, in %2().")
+                .arg(blueprint.getTable(), __tiny_func__));
+}
+
+QVector<QString>
+PostgresSchemaGrammar::compileAddPartition(const Blueprint &blueprint,
+                                           const PartitionCommand &command) const
+{
+    return {compilePartitionOf(blueprint, command.partition,
+                               compilePartitionBounds(command))};
+}
+
+QVector<QString>
+PostgresSchemaGrammar::compileDetachPartition(const Blueprint &blueprint,
+                                              const PartitionCommand &command) const
+{
+    return {QStringLiteral("alter table %1 detach partition %2")
+                .arg(wrapTable(blueprint), BaseGrammar::wrapTable(command.partition))};
+}
+
+QVector<QString>
+PostgresSchemaGrammar::compileDropPartition(const Blueprint &/*unused*/,
+                                            const PartitionCommand &command) const
+{
+    return {QStringLiteral("drop table %1")
+                .arg(BaseGrammar::wrapTable(command.partition))};
+}
+
 QVector<QString>
 PostgresSchemaGrammar::compileComment(const Blueprint &blueprint,
                                       const CommentCommand &command) const
@@ -378,11 +474,16 @@ PostgresSchemaGrammar::invokeCompileMethod(const CommandDefinition &command,
 
         // PostgreSQL specific
         {Comment,          bind(&PostgresSchemaGrammar::compileComment)},
+        {ValidateForeign,  bind(&PostgresSchemaGrammar::compileValidateForeign)},
 
         // PostgreSQL and MySQL specific
         {AutoIncrementStartingValue,
                            bind(&PostgresSchemaGrammar::compileAutoIncrementStartingValue)},
         {TableComment,     bind(&PostgresSchemaGrammar::compileTableComment)},
+        {PartitionBy,      bind(&PostgresSchemaGrammar::compilePartitionBy)},
+        {AddPartition,     bind(&PostgresSchemaGrammar::compileAddPartition)},
+        {DetachPartition,  bind(&PostgresSchemaGrammar::compileDetachPartition)},
+        {DropPartition,    bind(&PostgresSchemaGrammar::compileDropPartition)},
     };
 
     Q_ASSERT_X(cached.contains(name),
@@ -407,6 +508,21 @@ PostgresSchemaGrammar::getFluentCommands() const
     return cached;
 }
 
+bool PostgresSchemaGrammar::isNonTransactionalCommand(
+        const CommandDefinition &command, const Blueprint &blueprint) const
+{
+    // The create/drop index concurrently can't be executed inside a transaction block
+    static const std::unordered_set<QString> cached {
+        Unique, Index, Fulltext, SpatialIndex,
+        DropUnique, DropIndex, DropFullText, DropSpatialIndex,
+    };
+
+    const auto &basicCommand = reinterpret_cast<const BasicCommand &>(command);
+
+    return cached.contains(basicCommand.name) &&
+           isOnlineIndex(blueprint, reinterpret_cast<const IndexCommand &>(command));
+}
+
 /* protected */
 
 QString PostgresSchemaGrammar::addModifiers(QString &&sql,
@@ -459,6 +575,61 @@ PostgresSchemaGrammar::compileDropConstraint(const Blueprint &blueprint,
                 .arg(wrapTable(blueprint), BaseGrammar::wrap(command.index))};
 }
 
+QString PostgresSchemaGrammar::compileConcurrently(const Blueprint &blueprint,
+                                                   const IndexCommand &command)
+{
+    return isOnlineIndex(blueprint, command) ? QStringLiteral("concurrently ")
+                                             : QString("");
+}
+
+QString PostgresSchemaGrammar::compileIndexOptions(const IndexCommand &command) const
+{
+    QString options;
+
+    if (!command.includes.isEmpty())
+        options += QStringLiteral(" include (%1)").arg(columnize(command.includes));
+
+    if (!command.where.isEmpty())
+        options += QStringLiteral(" where %1").arg(command.where);
+
+    return options;
+}
+
+QString
+PostgresSchemaGrammar::compilePartitionOf(const Blueprint &blueprint,
+                                          const QString &partition,
+                                          const QString &bounds) const
+{
+    return QStringLiteral("create table %1 partition of %2 %3")
+            .arg(BaseGrammar::wrapTable(partition), wrapTable(blueprint), bounds);
+}
+
+QString
+PostgresSchemaGrammar::compilePartitionBounds(const PartitionCommand &command) const
+{
+    if (command.method == PartitionRange)
+        return QStringLiteral("for values from (%1) to (%2)")
+                .arg(command.from.isNull() ? QStringLiteral("minvalue")
+                                           : getPartitionValue(command.from),
+                     command.to.isNull() ? QStringLiteral("maxvalue")
+                                         : getPartitionValue(command.to));
+
+    if (command.method == PartitionList) {
+        QStringList values;
+        values.reserve(command.values.size());
+
+        for (const auto &value : command.values)
+            values << getPartitionValue(value);
+
+        return QStringLiteral("for values in (%1)").arg(values.join(COMMA));
+    }
+
+    Q_ASSERT(command.method == PartitionHash);
+
+    return QStringLiteral("for values with (modulus %1, remainder %2)")
+            .arg(command.modulus).arg(command.remainder);
+}
+
 QString PostgresSchemaGrammar::escapeString(QString value) const
 {
     /* Different approach used for the MySQL and PostgreSQL, for MySQL are escaped more
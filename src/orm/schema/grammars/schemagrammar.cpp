@@ -1,5 +1,7 @@
 #include "orm/schema/grammars/schemagrammar.hpp"
 
+#include <range/v3/view/filter.hpp>
+
 #include "orm/databaseconnection.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/schema/blueprint.hpp"
@@ -144,6 +146,12 @@ QString SchemaGrammar::wrapTable(const Blueprint &blueprint) const
     return BaseGrammar::wrapTable(blueprint.getTable());
 }
 
+bool SchemaGrammar::isNonTransactionalCommand(const CommandDefinition &/*unused*/,
+                                              const Blueprint &/*unused*/) const
+{
+    return false;
+}
+
 /* protected */
 
 
@@ -153,6 +161,32 @@ bool SchemaGrammar::shouldAddAutoIncrementStartingValue(
     return column.autoIncrement && (column.startingValue || column.from);
 }
 
+std::shared_ptr<CommandDefinition>
+SchemaGrammar::getCommandByName(const Blueprint &blueprint, const QString &name)
+{
+    auto commands = getCommandsByName(blueprint, name);
+
+    return commands.isEmpty() ? nullptr : std::move(commands.first());
+}
+
+QVector<std::shared_ptr<CommandDefinition>>
+SchemaGrammar::getCommandsByName(const Blueprint &blueprint, const QString &name)
+{
+    return blueprint.getCommands()
+            | ranges::views::filter([&name](const auto &command)
+    {
+        return std::reinterpret_pointer_cast<BasicCommand>(command)->name == name;
+    })
+            | ranges::to<QVector<std::shared_ptr<CommandDefinition>>>();
+}
+
+bool SchemaGrammar::isOnlineIndex(const Blueprint &blueprint,
+                                  const IndexCommand &command)
+{
+    // Nobody else can access the table that is being created, nothing to block
+    return (command.online || blueprint.isOnline()) && !blueprint.creating();
+}
+
 QStringList SchemaGrammar::getColumns(const Blueprint &blueprint) const
 {
     auto addedColumns = blueprint.getAddedColumns();
@@ -187,6 +221,21 @@ QString SchemaGrammar::getDefaultValue(const QVariant &value) const
             : quoteString(escapeString(value.value<QString>()));
 }
 
+QString SchemaGrammar::getPartitionValue(const QVariant &value) const
+{
+    switch (Helpers::qVariantTypeId(value)) {
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Double:
+        return value.value<QString>();
+
+    default:
+        return getDefaultValue(value);
+    }
+}
+
 QString SchemaGrammar::typeComputed(const ColumnDefinition &/*unused*/) const
 {
     throw Exceptions::RuntimeError(
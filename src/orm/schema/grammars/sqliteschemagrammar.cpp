@@ -4,10 +4,10 @@
 
 #include <unordered_set>
 
-#include <range/v3/view/filter.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/remove_if.hpp>
 
+#include "orm/exceptions/logicerror.hpp"
 #include "orm/exceptions/runtimeerror.hpp"
 #include "orm/schema/blueprint.hpp"
 #include "orm/utils/type.hpp"
@@ -150,19 +150,21 @@ SQLiteSchemaGrammar::compileRenameColumn(const Blueprint &blueprint,
 QVector<QString> SQLiteSchemaGrammar::compileUnique(const Blueprint &blueprint,
                                                     const IndexCommand &command) const
 {
-    return {QStringLiteral("create unique index %1 on %2 (%3)")
+    return {QStringLiteral("create unique index %1 on %2 (%3)%4")
                 .arg(BaseGrammar::wrap(command.index),
                      wrapTable(blueprint),
-                     columnize(command.columns))};
+                     columnize(command.columns),
+                     compileIndexOptions(command))};
 }
 
 QVector<QString> SQLiteSchemaGrammar::compileIndex(const Blueprint &blueprint,
                                                    const IndexCommand &command) const
 {
-    return {QStringLiteral("create index %1 on %2 (%3)")
+    return {QStringLiteral("create index %1 on %2 (%3)%4")
                 .arg(BaseGrammar::wrap(command.index),
                      wrapTable(blueprint),
-                     columnize(command.columns))};
+                     columnize(command.columns),
+                     compileIndexOptions(command))};
 }
 
 QVector<QString>
@@ -279,8 +281,13 @@ SQLiteSchemaGrammar::invokeCompileMethod(const CommandDefinition &command,
 
         // PostgreSQL specific
         {Comment,          nullptr},
+        {ValidateForeign,  nullptr},
         // PostgreSQL and MySQL specific
         {TableComment,     nullptr},
+        {PartitionBy,      nullptr},
+        {AddPartition,     nullptr},
+        {DetachPartition,  nullptr},
+        {DropPartition,    nullptr},
     };
 
     Q_ASSERT_X(cached.contains(name),
@@ -356,23 +363,18 @@ QString SQLiteSchemaGrammar::addPrimaryKeys(const Blueprint &blueprint) const
                      std::reinterpret_pointer_cast<IndexCommand>(primary)->columns));
 }
 
-std::shared_ptr<CommandDefinition>
-SQLiteSchemaGrammar::getCommandByName(const Blueprint &blueprint, const QString &name)
+QString SQLiteSchemaGrammar::compileIndexOptions(const IndexCommand &command)
 {
-    auto commands = getCommandsByName(blueprint, name);
+    if (!command.includes.isEmpty())
+        throw Exceptions::LogicError(
+                QStringLiteral("The SQLite database doesn't support include columns, "
+                               "in %1().")
+                .arg(__tiny_func__));
 
-    return commands.isEmpty() ? nullptr : std::move(commands.first());
-}
+    if (command.where.isEmpty())
+        return {};
 
-QVector<std::shared_ptr<CommandDefinition>>
-SQLiteSchemaGrammar::getCommandsByName(const Blueprint &blueprint, const QString &name)
-{
-    return blueprint.getCommands()
-            | ranges::views::filter([&name](const auto &command)
-    {
-        return std::reinterpret_pointer_cast<BasicCommand>(command)->name == name;
-    })
-            | ranges::to<QVector<std::shared_ptr<CommandDefinition>>>();
+    return QStringLiteral(" where %1").arg(command.where);
 }
 
 /* Others */
@@ -29,6 +29,28 @@ IndexDefinitionReference::language(const QString &language)
     return *this;
 }
 
+IndexDefinitionReference &IndexDefinitionReference::online(const bool value)
+{
+    m_indexCommand.get().online = value;
+
+    return *this;
+}
+
+IndexDefinitionReference &
+IndexDefinitionReference::includes(const QVector<QString> &columns)
+{
+    m_indexCommand.get().includes = columns;
+
+    return *this;
+}
+
+IndexDefinitionReference &IndexDefinitionReference::where(const QString &predicate)
+{
+    m_indexCommand.get().where = predicate;
+
+    return *this;
+}
+
 } // namespace Orm::SchemaNs
 
 TINYORM_END_COMMON_NAMESPACE
@@ -1,9 +1,14 @@
 #include "orm/schema/mysqlschemabuilder.hpp"
 
 #include "orm/databaseconnection.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
+#include "orm/utils/container.hpp"
+#include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+using ContainerUtils = Orm::Utils::Container;
+
 namespace Orm::SchemaNs
 {
 
@@ -22,6 +27,33 @@ MySqlSchemaBuilder::dropDatabaseIfExists(const QString &name) const
                 m_grammar->compileDropDatabaseIfExists(name));
 }
 
+void MySqlSchemaBuilder::createSnapshot(const QString &name) const
+{
+    const auto snapshot = snapshotDatabaseName(name);
+
+    dropDatabaseIfExists(snapshot);
+    createDatabase(snapshot);
+
+    copyTables(m_connection->getDatabaseName(), snapshot);
+}
+
+void MySqlSchemaBuilder::restoreSnapshot(const QString &name) const
+{
+    const auto snapshot = snapshotDatabaseName(name);
+
+    // Don't drop all tables if there is nothing to restore from
+    throwIfSnapshotMissing(snapshot);
+
+    dropAllTables();
+
+    copyTables(snapshot, m_connection->getDatabaseName());
+}
+
+void MySqlSchemaBuilder::dropSnapshotIfExists(const QString &name) const
+{
+    dropDatabaseIfExists(snapshotDatabaseName(name));
+}
+
 void MySqlSchemaBuilder::dropAllTables() const
 {
     auto query = getAllTables();
@@ -97,6 +129,119 @@ bool MySqlSchemaBuilder::hasTable(const QString &table) const
                 {m_connection->getDatabaseName(), tablePrefixed}).size() > 0;
 }
 
+/* protected */
+
+void MySqlSchemaBuilder::copyTables(const QString &from, const QString &to) const
+{
+    auto query = m_connection->selectFromWriteConnection(
+                     QStringLiteral("select table_name from information_schema.tables "
+                                    "where table_schema = ? and "
+                                    "table_type = 'BASE TABLE'"),
+                     {from});
+
+    QVector<QString> tables;
+    tables.reserve(query.size());
+
+    while (query.next())
+        tables << query.value(0).value<QString>();
+
+    // Nothing to do, empty database
+    if (tables.isEmpty())
+        return;
+
+    const auto fromWrapped = m_grammar->wrap(from);
+    const auto toWrapped = m_grammar->wrap(to);
+
+    /* The tables are copied in the information_schema order, so the foreign key
+       constraints can reference tables that are not created yet. */
+    withoutForeignKeyConstraints([this, &from, &tables, &fromWrapped, &toWrapped]
+    {
+        for (const auto &table : tables) {
+            const auto tableWrapped = m_grammar->wrap(table);
+            const auto source = QStringLiteral("%1.%2").arg(fromWrapped, tableWrapped);
+            const auto target = QStringLiteral("%1.%2").arg(toWrapped, tableWrapped);
+
+            m_connection->unprepared(getCreateTableStatement(source, table, target));
+
+            // Generated columns can't be inserted, they are computed again
+            const auto columns = ContainerUtils::join(
+                                     m_grammar->wrapArray(
+                                         getInsertableColumns(from, table)));
+
+            m_connection->unprepared(
+                        QStringLiteral("insert into %1 (%3) select %3 from %2")
+                        .arg(target, source, columns));
+        }
+    });
+}
+
+void MySqlSchemaBuilder::throwIfSnapshotMissing(const QString &snapshot) const
+{
+    if (m_connection->selectFromWriteConnection(
+            QStringLiteral("select schema_name from information_schema.schemata "
+                           "where schema_name = ?"),
+            {snapshot}).size() > 0
+    )
+        return;
+
+    throw Exceptions::RuntimeError(
+                QStringLiteral("The '%1' database snapshot doesn't exist in %2().")
+                .arg(snapshot, __tiny_func__));
+}
+
+/* private */
+
+QString MySqlSchemaBuilder::getCreateTableStatement(
+        const QString &source, const QString &table, const QString &target) const
+{
+    auto query = m_connection->selectFromWriteConnection(
+                     QStringLiteral("show create table %1").arg(source));
+
+    if (!query.next())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("The 'show create table' for the '%1' table returned "
+                               "no rows in %2().")
+                .arg(source, __tiny_func__));
+
+    /* The show create table returns the unqualified table name, qualify it with
+       the target database, foreign key references without a database are resolved
+       against the database of the created table. */
+    auto createSql = query.value(1).value<QString>();
+    const auto createPrefix = QStringLiteral("CREATE TABLE %1")
+                              .arg(m_grammar->wrap(table));
+
+    if (!createSql.startsWith(createPrefix))
+        throw Exceptions::RuntimeError(
+                QStringLiteral("Unexpected 'show create table' output for the '%1' "
+                               "table, it doesn't start with '%2' in %3().")
+                .arg(source, createPrefix, __tiny_func__));
+
+    return createSql.replace(0, createPrefix.size(),
+                             QStringLiteral("CREATE TABLE %1").arg(target));
+}
+
+QVector<QString> MySqlSchemaBuilder::getInsertableColumns(const QString &database,
+                                                     const QString &table) const
+{
+    /* The generation_expression is empty on MySQL and null on MariaDB for regular
+       columns, the DEFAULT_GENERATED columns (expression defaults) are regular. */
+    auto query = m_connection->selectFromWriteConnection(
+                     QStringLiteral("select column_name from information_schema.columns "
+                                    "where table_schema = ? and table_name = ? and "
+                                    "(generation_expression is null or "
+                                    "generation_expression = '') "
+                                    "order by ordinal_position"),
+                     {database, table});
+
+    QVector<QString> columns;
+    columns.reserve(query.size());
+
+    while (query.next())
+        columns << query.value(0).value<QString>();
+
+    return columns;
+}
+
 } // namespace Orm::SchemaNs
 
 TINYORM_END_COMMON_NAMESPACE
@@ -1,10 +1,17 @@
 #include "orm/schema/postgresschemabuilder.hpp"
 
 #include <QSet>
+#include <QtSql/QSqlDatabase>
+#include <QtSql/QSqlError>
+#include <QtSql/QSqlQuery>
 
+#include "orm/exceptions/queryerror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
 #include "orm/exceptions/searchpathemptyerror.hpp"
+#include "orm/exceptions/sqlerror.hpp"
 #include "orm/postgresconnection.hpp" // IWYU pragma: keep
 #include "orm/schema/grammars/postgresschemagrammar.hpp"
+#include "orm/support/connectionworkers.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -27,6 +34,57 @@ PostgresSchemaBuilder::dropDatabaseIfExists(const QString &name) const
                 m_grammar->compileDropDatabaseIfExists(name));
 }
 
+void PostgresSchemaBuilder::createSnapshot(const QString &name) const
+{
+    const auto snapshot = snapshotDatabaseName(name);
+
+    /* The template database can't have any other sessions connected while it's being
+       copied, that's why the statements are executed on the maintenance database. */
+    runOnMaintenanceDatabase({
+        compileTerminateSessions(snapshot),
+        m_grammar->compileDropDatabaseIfExists(snapshot),
+        compileTerminateSessions(m_connection->getDatabaseName()),
+        QStringLiteral("create database %1 template %2")
+            .arg(m_grammar->wrap(snapshot),
+                 m_grammar->wrap(m_connection->getDatabaseName())),
+    });
+}
+
+void PostgresSchemaBuilder::restoreSnapshot(const QString &name) const
+{
+    const auto snapshot = snapshotDatabaseName(name);
+
+    throwIfSnapshotMissing(snapshot);
+
+    const auto &database = m_connection->getDatabaseName();
+    const auto restoring = QStringLiteral("%1_restoring").arg(database);
+
+    /* The snapshot is copied to the temporary database first and the current
+       database is dropped only after the copy succeeded, so a failed copy never
+       loses the current database. */
+    runOnMaintenanceDatabase({
+        compileTerminateSessions(restoring),
+        m_grammar->compileDropDatabaseIfExists(restoring),
+        compileTerminateSessions(snapshot),
+        QStringLiteral("create database %1 template %2")
+            .arg(m_grammar->wrap(restoring), m_grammar->wrap(snapshot)),
+        compileTerminateSessions(database),
+        m_grammar->compileDropDatabaseIfExists(database),
+        QStringLiteral("alter database %1 rename to %2")
+            .arg(m_grammar->wrap(restoring), m_grammar->wrap(database)),
+    });
+}
+
+void PostgresSchemaBuilder::dropSnapshotIfExists(const QString &name) const
+{
+    const auto snapshot = snapshotDatabaseName(name);
+
+    runOnMaintenanceDatabase({
+        compileTerminateSessions(snapshot),
+        m_grammar->compileDropDatabaseIfExists(snapshot),
+    });
+}
+
 void PostgresSchemaBuilder::dropAllTables() const
 {
     auto query = getAllTables();
@@ -158,6 +216,72 @@ PostgresSchemaBuilder::parseSchemaAndTable(const QString &reference) const
     return {std::move(database), std::move(schema), std::move(parts.first())};
 }
 
+void PostgresSchemaBuilder::runOnMaintenanceDatabase(
+        const QStringList &statements) const
+{
+    const auto &connectionName = m_connection->getName();
+    const auto maintenanceName = QStringLiteral("%1-maintenance").arg(connectionName);
+
+    try {
+        auto maintenance = QSqlDatabase::cloneDatabase(m_connection->getQtConnection(),
+                                                       maintenanceName);
+        maintenance.setDatabaseName(QStringLiteral("postgres"));
+
+        /* Release the current database and the async queries' worker connection,
+           the next query reconnects, other sessions are terminated. */
+        Support::ConnectionWorkers::disconnect(connectionName);
+        m_connection->disconnect();
+
+        if (!maintenance.open())
+            throw Exceptions::SqlError(
+                    QStringLiteral("Open the maintenance database connection for "
+                                   "the '%1' connection failed.")
+                    .arg(connectionName),
+                    maintenance.lastError());
+
+        QSqlQuery query(maintenance);
+
+        for (const auto &statement : statements)
+            if (!query.exec(statement))
+                throw Exceptions::QueryError(
+                        connectionName,
+                        "Statement in PostgresSchemaBuilder::runOnMaintenanceDatabase() "
+                        "failed.",
+                        query);
+
+        maintenance.close();
+
+    } catch (...) {
+        QSqlDatabase::removeDatabase(maintenanceName);
+
+        throw;
+    }
+
+    QSqlDatabase::removeDatabase(maintenanceName);
+}
+
+void PostgresSchemaBuilder::throwIfSnapshotMissing(const QString &snapshot) const
+{
+    if (m_connection->selectFromWriteConnection(
+            QStringLiteral("select datname from pg_database where datname = ?"),
+            {snapshot}).size() > 0
+    )
+        return;
+
+    throw Exceptions::RuntimeError(
+                QStringLiteral("The '%1' database snapshot doesn't exist in %2().")
+                .arg(snapshot, __tiny_func__));
+}
+
+QString PostgresSchemaBuilder::compileTerminateSessions(const QString &database)
+{
+    /* Disconnecting the current connection isn't enough, the database can't be
+       dropped or used as the template while any other session is connected to it. */
+    return QStringLiteral("select pg_terminate_backend(pid) from pg_stat_activity "
+                          "where datname = %1 and pid <> pg_backend_pid()")
+            .arg(BaseGrammar::quoteString(database));
+}
+
 /* private */
 
 void PostgresSchemaBuilder::dropDatabaseForParse(
@@ -36,6 +36,27 @@ SchemaBuilder::dropDatabaseIfExists(const QString &/*unused*/) const
                 .arg(m_connection->driverName()));
 }
 
+void SchemaBuilder::createSnapshot(const QString &/*unused*/) const
+{
+    throw Exceptions::LogicError(
+                QStringLiteral("%1 database driver does not support database snapshots.")
+                .arg(m_connection->driverName()));
+}
+
+void SchemaBuilder::restoreSnapshot(const QString &/*unused*/) const
+{
+    throw Exceptions::LogicError(
+                QStringLiteral("%1 database driver does not support database snapshots.")
+                .arg(m_connection->driverName()));
+}
+
+void SchemaBuilder::dropSnapshotIfExists(const QString &/*unused*/) const
+{
+    throw Exceptions::LogicError(
+                QStringLiteral("%1 database driver does not support database snapshots.")
+                .arg(m_connection->driverName()));
+}
+
 void SchemaBuilder::create(const QString &table,
                            const std::function<void(Blueprint &)> &callback) const
 {
@@ -227,6 +248,11 @@ void SchemaBuilder::build(Blueprint &&blueprint) const // NOLINT(cppcoreguidelin
     blueprint.build(*m_connection, *m_grammar);
 }
 
+QString SchemaBuilder::snapshotDatabaseName(const QString &name) const
+{
+    return QStringLiteral("%1_snapshot_%2").arg(m_connection->getDatabaseName(), name);
+}
+
 } // namespace Orm::SchemaNs
 
 TINYORM_END_COMMON_NAMESPACE
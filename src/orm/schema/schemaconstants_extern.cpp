@@ -21,6 +21,7 @@ namespace Orm::SchemaNs::Constants
     const QString DropSpatialIndex  = QStringLiteral("dropSpatialIndex");
     const QString DropForeign       = QStringLiteral("dropForeign");
     const QString RenameIndex       = QStringLiteral("renameIndex");
+    const QString ValidateForeign   = QStringLiteral("validateForeign");
 
     // PostgreSQL specific command
     const QString Comment           = QStringLiteral("comment");
@@ -29,6 +30,10 @@ namespace Orm::SchemaNs::Constants
     const QString
     AutoIncrementStartingValue      = QStringLiteral("autoIncrementStartingValue");
     const QString TableComment      = QStringLiteral("tableComment");
+    const QString PartitionBy       = QStringLiteral("partitionBy");
+    const QString AddPartition      = QStringLiteral("addPartition");
+    const QString DropPartition     = QStringLiteral("dropPartition");
+    const QString DetachPartition   = QStringLiteral("detachPartition");
 
     // Indexes
     const QString Primary      = QStringLiteral("primary");
@@ -43,6 +48,11 @@ namespace Orm::SchemaNs::Constants
     const QString Restrict = QStringLiteral("restrict");
     const QString SetNull  = QStringLiteral("set null");
 
+    // Partitioning methods
+    const QString PartitionRange = QStringLiteral("range");
+    const QString PartitionList  = QStringLiteral("list");
+    const QString PartitionHash  = QStringLiteral("hash");
+
     // Column types
     const QString integer_ = QStringLiteral("integer");
     const QString varchar_ = QStringLiteral("varchar");
@@ -2,9 +2,11 @@
 
 #include <filesystem>
 #include <fstream>
+#include <vector>
 
 #include "orm/databaseconnection.hpp"
 #include "orm/schema/grammars/sqliteschemagrammar.hpp"
+#include "orm/utils/container.hpp"
 #include "orm/utils/type.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -13,6 +15,8 @@ namespace fs = std::filesystem;
 
 using fspath = std::filesystem::path;
 
+using ContainerUtils = Orm::Utils::Container;
+
 namespace Orm::SchemaNs
 {
 
@@ -49,6 +53,51 @@ SQLiteSchemaBuilder::dropDatabaseIfExists(const QString &name) const
     return std::nullopt;
 }
 
+void SQLiteSchemaBuilder::createSnapshot(const QString &name) const
+{
+    const auto snapshot = snapshotPath(name);
+
+    // The VACUUM INTO fails if the target file already exists
+    if (fs::exists(snapshot))
+        fs::remove(snapshot);
+
+    /* The VACUUM INTO creates a consistent and compacted copy of the database,
+       it works for both the file and in-memory databases. */
+    m_connection->unprepared(QStringLiteral("vacuum into %1").arg(quotePath(snapshot)));
+}
+
+void SQLiteSchemaBuilder::restoreSnapshot(const QString &name) const
+{
+    const auto snapshot = snapshotPath(name);
+
+    if (!fs::exists(snapshot))
+        throw Exceptions::RuntimeError(
+                QStringLiteral("SQLite database snapshot '%1' doesn't exist in %2().")
+                .arg(QString::fromStdString(snapshot.string()), __tiny_func__));
+
+    const auto &databaseName = m_connection->getDatabaseName();
+
+    if (databaseName == QStringLiteral(":memory:"))
+        return restoreMemorySnapshot(snapshot); // clazy:exclude=returning-void-expression
+
+    // The database file can't be overwritten while it's opened, the next query reconnects
+    m_connection->disconnect();
+
+    const fspath databasePath(databaseName.toUtf8().constData());
+
+    fs::copy_file(snapshot, databasePath, fs::copy_options::overwrite_existing);
+
+    /* The -wal and -shm files belong to the overwritten database (journal_mode=wal),
+       the SQLite would replay the stale WAL file on the restored database. */
+    removeSidecarFiles(databasePath);
+}
+
+void SQLiteSchemaBuilder::dropSnapshotIfExists(const QString &name) const
+{
+    if (const auto snapshot = snapshotPath(name); fs::exists(snapshot))
+        fs::remove(snapshot);
+}
+
 void SQLiteSchemaBuilder::dropAllTables() const
 {
     if (m_connection->getDatabaseName() != QStringLiteral(":memory:"))
@@ -108,6 +157,114 @@ void SQLiteSchemaBuilder::refreshDatabaseFile() const
                 .arg(databaseName, __tiny_func__));
 }
 
+/* protected */
+
+fspath SQLiteSchemaBuilder::snapshotPath(const QString &name) const
+{
+    const auto &databaseName = m_connection->getDatabaseName();
+
+    // Snapshot the in-memory database to the temporary directory
+    if (databaseName == QStringLiteral(":memory:"))
+        return fs::temp_directory_path() /
+                QStringLiteral("tinyorm_%1_snapshot_%2.sqlite3")
+                .arg(m_connection->getName(), name).toUtf8().constData();
+
+    return QStringLiteral("%1.snapshot_%2").arg(databaseName, name)
+            .toUtf8().constData();
+}
+
+void SQLiteSchemaBuilder::restoreMemorySnapshot(const fspath &snapshot) const
+{
+    // The views are re-created from the snapshot below, drop them too
+    dropAllViews();
+    dropAllTables();
+
+    m_connection->unprepared(QStringLiteral("attach database %1 as tiny_snapshot")
+                             .arg(quotePath(snapshot)));
+
+    /* Tables have to be created (and filled) first, indexes, triggers, and views
+       after them, the sqlite_sequence table is created by the SQLite internally
+       (the AUTOINCREMENT counters are re-created by the inserted rows). */
+    auto query = m_connection->selectFromWriteConnection(
+                     QStringLiteral("select type, name, sql "
+                                    "from tiny_snapshot.sqlite_master "
+                                    "where sql is not null and "
+                                      "name != 'sqlite_sequence' "
+                                    "order by rowid"));
+
+    // Don't modify the schema while the select statement is still active
+    std::vector<std::pair<QString, QString>> tables;
+    QStringList statements;
+
+    while (query.next()) {
+        auto sql = query.value(QStringLiteral("sql")).value<QString>();
+
+        if (query.value(QStringLiteral("type")).value<QString>() ==
+            QStringLiteral("table")
+        )
+            tables.emplace_back(query.value(QStringLiteral("name")).value<QString>(),
+                                std::move(sql));
+        else
+            statements << std::move(sql);
+    }
+
+    query.finish();
+
+    withoutForeignKeyConstraints([this, &tables, &statements]
+    {
+        for (const auto &[table, createSql] : tables) {
+            m_connection->unprepared(createSql);
+
+            // Generated columns can't be inserted, they are computed again
+            const auto columns = ContainerUtils::join(
+                                     m_grammar->wrapArray(
+                                         getSnapshotInsertableColumns(table)));
+
+            m_connection->unprepared(
+                        QStringLiteral("insert into main.%1 (%2) "
+                                       "select %2 from tiny_snapshot.%1")
+                        .arg(m_grammar->wrap(table), columns));
+        }
+
+        for (const auto &statement : statements)
+            m_connection->unprepared(statement);
+    });
+
+    m_connection->unprepared(QStringLiteral("detach database tiny_snapshot"));
+}
+
+QVector<QString>
+SQLiteSchemaBuilder::getSnapshotInsertableColumns(const QString &table) const
+{
+    // The hidden value is 2 or 3 for the virtual or stored generated columns
+    auto query = m_connection->selectFromWriteConnection(
+                     QStringLiteral("select name "
+                                    "from pragma_table_xinfo(?, 'tiny_snapshot') "
+                                    "where hidden = 0 order by cid"),
+                     {table});
+
+    QVector<QString> columns;
+
+    while (query.next())
+        columns << query.value(0).value<QString>();
+
+    return columns;
+}
+
+void SQLiteSchemaBuilder::removeSidecarFiles(const fspath &database)
+{
+    for (const auto *const suffix : {"-wal", "-shm", "-journal"})
+        if (auto sidecar = fspath(database) += suffix; fs::exists(sidecar))
+            fs::remove(sidecar);
+}
+
+QString SQLiteSchemaBuilder::quotePath(const fspath &path)
+{
+    return QStringLiteral("'%1'").arg(QString::fromStdString(path.string())
+                                      .replace(QLatin1Char('\''),
+                                               QStringLiteral("''")));
+}
+
 } // namespace Orm::SchemaNs
 
 TINYORM_END_COMMON_NAMESPACE
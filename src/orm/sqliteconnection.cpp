@@ -1,5 +1,7 @@
 #include "orm/sqliteconnection.hpp"
 
+#include <QVersionNumber>
+
 #include "orm/query/grammars/sqlitegrammar.hpp"
 #include "orm/query/processors/sqliteprocessor.hpp"
 #include "orm/schema/grammars/sqliteschemagrammar.hpp"
@@ -38,6 +40,24 @@ SQLiteConnection &SQLiteConnection::setReturnQDateTime(const bool value)
     return *this;
 }
 
+bool SQLiteConnection::supportsInsertReturning()
+{
+    // The SQLite version is unknown if pretending
+    if (m_pretending && !m_supportsInsertReturning)
+        return false;
+
+    // Return the cached value
+    if (m_supportsInsertReturning)
+        return *m_supportsInsertReturning;
+
+    // Obtain and cache the value, the returning clause was added in the SQLite 3.35
+    const auto version = QVersionNumber::fromString(
+                             scalar(QStringLiteral("select sqlite_version()"))
+                             .value<QString>());
+
+    return *(m_supportsInsertReturning = version >= QVersionNumber(3, 35));
+}
+
 /* protected */
 
 std::unique_ptr<QueryGrammar> SQLiteConnection::getDefaultQueryGrammar() const
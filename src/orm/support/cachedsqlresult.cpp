@@ -0,0 +1,75 @@
+#include "orm/support/cachedsqlresult.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/* public */
+
+CachedSqlResult::CachedSqlResult(const QSqlDriver *driver, const QString &queryString,
+                                 QueryCacheResult result)
+    : QSqlResult(driver)
+    , m_result(std::move(result))
+{
+    setQuery(queryString);
+    setSelect(true);
+    setActive(true);
+    setAt(QSql::BeforeFirstRow);
+}
+
+/* protected */
+
+QVariant CachedSqlResult::data(const int index)
+{
+    return m_result.rows.at(at()).value(index);
+}
+
+bool CachedSqlResult::isNull(const int index)
+{
+    return m_result.rows.at(at()).isNull(index);
+}
+
+bool CachedSqlResult::reset(const QString &/*unused*/)
+{
+    return false;
+}
+
+bool CachedSqlResult::fetch(const int index)
+{
+    if (index < 0 || index >= m_result.rows.size())
+        return false;
+
+    setAt(index);
+
+    return true;
+}
+
+bool CachedSqlResult::fetchFirst()
+{
+    return fetch(0);
+}
+
+bool CachedSqlResult::fetchLast()
+{
+    return fetch(static_cast<int>(m_result.rows.size()) - 1);
+}
+
+int CachedSqlResult::size()
+{
+    return static_cast<int>(m_result.rows.size());
+}
+
+int CachedSqlResult::numRowsAffected()
+{
+    return -1;
+}
+
+QSqlRecord CachedSqlResult::record() const
+{
+    return m_result.columns;
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
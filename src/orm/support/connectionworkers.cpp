@@ -0,0 +1,248 @@
+#include "orm/support/connectionworkers.hpp"
+
+#include <QException>
+#include <QThreadPool>
+#include <QThreadStorage>
+
+#include <mutex>
+#include <unordered_map>
+
+#include "orm/constants.hpp"
+#include "orm/db.hpp"
+#include "orm/exceptions/logicerror.hpp"
+#include "orm/macros/threadlocal.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::QSQLITE;
+using Orm::Constants::database_;
+
+namespace Orm::Support
+{
+
+namespace
+{
+    /*! Type used to store the worker thread pools. */
+    using WorkersType = std::unordered_map<QString, std::shared_ptr<QThreadPool>>;
+
+    /*! Worker thread pools keyed by the connection name. */
+    WorkersType &workers()
+    {
+        static WorkersType workers;
+
+        return workers;
+    }
+
+    /*! Guards the worker thread pools map. */
+    std::mutex &workersMutex()
+    {
+        static std::mutex mutex;
+
+        return mutex;
+    }
+
+    /*! Connection name of the current worker thread (empty for other threads). */
+    QString &workerConnection()
+    {
+#ifdef TINYORM_HAS_THREAD_LOCAL
+        T_THREAD_LOCAL
+        static QString connection;
+
+        return connection;
+#else
+        // The thread_local is disabled for this compiler, the QThreadStorage works
+        static QThreadStorage<QString> connection;
+
+        return connection.localData();
+#endif
+    }
+} // namespace
+
+/* public */
+
+void ConnectionWorkers::waitForDone()
+{
+    /* Don't hold the lock while waiting, a running task can start another async
+       query and it needs the lock to obtain its worker. */
+    std::vector<std::shared_ptr<QThreadPool>> pools;
+
+    {
+        const std::scoped_lock lock(workersMutex());
+
+        pools.reserve(workers().size());
+
+        for (const auto &[_, worker] : workers())
+            pools.push_back(worker);
+    }
+
+    for (const auto &worker : pools)
+        worker->waitForDone();
+}
+
+void ConnectionWorkers::disconnect(const QString &connection)
+{
+    // The current thread disconnects its own connection itself
+    if (workerConnection() == connection)
+        return;
+
+    std::shared_ptr<QThreadPool> worker;
+
+    {
+        const std::scoped_lock lock(workersMutex());
+
+        const auto it = workers().find(connection);
+
+        // Nothing to disconnect
+        if (it == workers().end())
+            return;
+
+        worker = it->second;
+    }
+
+    worker->start([connection]
+    {
+        if (DB::containsConnection(connection))
+            DB::connection(connection).disconnect();
+    });
+
+    /* Another worker thread can't wait, the worker of the given connection could be
+       waiting for it in the meantime. */
+    if (!isWorkerThread())
+        worker->waitForDone();
+}
+
+void ConnectionWorkers::remove(const QString &connection)
+{
+    std::shared_ptr<QThreadPool> worker;
+
+    {
+        const std::scoped_lock lock(workersMutex());
+
+        const auto it = workers().find(connection);
+
+        // Nothing to remove
+        if (it == workers().end())
+            return;
+
+        throwIfWorkerThread(connection);
+
+        worker = std::move(it->second);
+        workers().erase(it);
+    }
+
+    stop(std::move(worker));
+}
+
+void ConnectionWorkers::shutdown()
+{
+    WorkersType removed;
+
+    {
+        const std::scoped_lock lock(workersMutex());
+
+        if (workers().empty())
+            return;
+
+        throwIfWorkerThread(workerConnection());
+
+        removed.swap(workers());
+    }
+
+    for (auto &[_, worker] : removed)
+        stop(std::move(worker));
+}
+
+/* private */
+
+QThreadPool &ConnectionWorkers::worker(const QString &connection)
+{
+    const std::scoped_lock lock(workersMutex());
+
+    auto &worker = workers()[connection];
+
+    if (worker)
+        return *worker;
+
+    worker = std::make_shared<QThreadPool>();
+
+    /* One thread that never expires, the thread-local database connection has to live
+       as long as the worker thread, otherwise every async query would reconnect. */
+    worker->setMaxThreadCount(1);
+    worker->setExpiryTimeout(-1);
+
+    return *worker;
+}
+
+DatabaseConnection &ConnectionWorkers::connection(const QString &name)
+{
+    auto &connection = DB::connection(name);
+
+    /* Every SQLite in-memory connection has its own empty database, so the worker
+       thread would silently query another database. */
+    if (connection.driverName() == QSQLITE &&
+        connection.getConfig(database_).value<QString>() == QStringLiteral(":memory:")
+    )
+        throw Exceptions::LogicError(
+                QStringLiteral("Async queries aren't supported for the SQLite in-memory "
+                               "database, the '%1' connection's worker thread would "
+                               "use another empty database.")
+                .arg(name));
+
+    return connection;
+}
+
+void ConnectionWorkers::reportException(QFutureInterfaceBase &promise)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    // The QFuture::result() or waitForFinished() rethrows the original exception
+    promise.reportException(std::current_exception());
+#else
+    promise.reportException(QUnhandledException());
+#endif
+}
+
+void ConnectionWorkers::start(const QString &connection, std::function<void()> &&task)
+{
+    worker(connection).start([connection, task = std::move(task)]
+    {
+        workerConnection() = connection;
+
+        std::invoke(task);
+    });
+}
+
+bool ConnectionWorkers::isWorkerThread() noexcept
+{
+    return !workerConnection().isEmpty();
+}
+
+void ConnectionWorkers::throwIfWorkerThread(const QString &connection)
+{
+    if (!isWorkerThread())
+        return;
+
+    throw Exceptions::LogicError(
+                QStringLiteral("The '%1' connection's worker thread can't be removed "
+                               "from an async query.")
+                .arg(connection));
+}
+
+void ConnectionWorkers::stop(std::shared_ptr<QThreadPool> &&worker)
+{
+    /* The QtSql connection can be removed only from the thread that created it,
+       the teardown is queued after all already queued async queries. */
+    worker->start([]
+    {
+        DB::removeThreadConnections();
+
+        workerConnection().clear();
+    });
+
+    // Joins the worker thread
+    worker->waitForDone();
+    worker.reset();
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,232 @@
+#include "orm/support/querycache.hpp"
+
+#include <QDateTime>
+#include <QRegularExpression>
+
+#include "orm/constants.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::ASTERISK;
+
+namespace Orm::Support
+{
+
+/* public */
+
+QueryCache::QueryCache(const qint64 maxSize)
+    : m_maxSize(maxSize)
+{}
+
+std::optional<QueryCacheResult> QueryCache::get(const QString &key)
+{
+    const std::scoped_lock lock(m_mutex);
+
+    const auto itIndex = m_index.find(key);
+
+    if (itIndex == m_index.end()) {
+        ++m_stats.misses;
+        return std::nullopt;
+    }
+
+    const auto entry = itIndex->second;
+
+    if (entry->expires.hasExpired()) {
+        remove(entry);
+        ++m_stats.misses;
+        return std::nullopt;
+    }
+
+    // Move to the front, the least recently used entries are evicted first
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+
+    ++m_stats.hits;
+
+    return entry->result;
+}
+
+void QueryCache::put(const QString &key, const QueryCacheResult &result,
+                     const QStringList &tables, const int ttl)
+{
+    if (ttl <= 0)
+        return;
+
+    const auto size = estimateSize(key, result);
+
+    // Never cache results that would evict the whole cache
+    if (size > m_maxSize)
+        return;
+
+    const std::scoped_lock lock(m_mutex);
+
+    if (const auto itIndex = m_index.find(key); itIndex != m_index.end())
+        remove(itIndex->second);
+
+    m_entries.push_front({key, result, tables,
+                          QDeadlineTimer(static_cast<qint64>(ttl) * 1000), size});
+    m_index.emplace(key, m_entries.begin());
+
+    ++m_stats.entries;
+    m_stats.size += size;
+
+    // Evict the least recently used entries
+    while (m_stats.size > m_maxSize) {
+        remove(std::prev(m_entries.end()));
+        ++m_stats.evictions;
+    }
+}
+
+void QueryCache::invalidate(const QString &table)
+{
+    const std::scoped_lock lock(m_mutex);
+
+    for (auto entry = m_entries.begin(); entry != m_entries.end();) {
+        const auto &tables = entry->tables;
+
+        // The ASTERISK means the tables read by the query are unknown
+        if (tables.contains(table) || tables.contains(ASTERISK)) {
+            remove(entry++);
+            ++m_stats.invalidations;
+        }
+        else
+            ++entry;
+    }
+}
+
+void QueryCache::flush()
+{
+    const std::scoped_lock lock(m_mutex);
+
+    m_stats.invalidations += static_cast<quint64>(m_entries.size());
+
+    m_entries.clear();
+    m_index.clear();
+
+    m_stats.entries = 0;
+    m_stats.size = 0;
+}
+
+bool QueryCache::isEmpty() const
+{
+    const std::scoped_lock lock(m_mutex);
+
+    return m_entries.empty();
+}
+
+QueryCacheStats QueryCache::stats() const
+{
+    const std::scoped_lock lock(m_mutex);
+
+    return m_stats;
+}
+
+QString QueryCache::key(const QString &connection, const QString &queryString,
+                        const QVector<QVariant> &bindings)
+{
+    QString key;
+    key.reserve(connection.size() + queryString.size() + 1 + (bindings.size() * 16));
+
+    /* The cache can be shared by connections, the same query on another connection
+       (or database) must never be served from this connection's result. */
+    key += connection;
+    key += QChar(u'\x1d');
+    key += queryString;
+
+    /* The type is part of the key so eg. 1 and "1" are different bindings, QDateTime
+       and QByteArray are converted explicitly to avoid losing the time zone or data. */
+    for (const auto &binding : bindings) {
+        key += QChar(u'\x1f');
+        key += QString::number(binding.userType());
+        key += QChar(u':');
+
+        if (binding.isNull())
+            key += QChar(u'\x1e');
+        else if (binding.userType() == QMetaType::QDateTime)
+            key += binding.value<QDateTime>().toString(Qt::ISODateWithMs);
+        else if (binding.userType() == QMetaType::QByteArray)
+            key += QString::fromLatin1(binding.value<QByteArray>().toBase64());
+        else
+            key += binding.value<QString>();
+    }
+
+    return key;
+}
+
+QString QueryCache::normalizeTable(const QString &table)
+{
+    auto name = table.trimmed();
+
+    // Remove the table alias
+    if (const auto asIndex = name.indexOf(QStringLiteral(" as "), 0, Qt::CaseInsensitive);
+        asIndex != -1
+    )
+        name.truncate(asIndex);
+
+    // Remove the identifier quotes
+    for (const auto quote : {QChar(u'"'), QChar(u'`'), QChar(u'['), QChar(u']')})
+        name.remove(quote);
+
+    // Remove the schema or database name
+    if (const auto dotIndex = name.lastIndexOf(QChar(u'.')); dotIndex != -1)
+        name = name.mid(dotIndex + 1);
+
+    return name.trimmed().toLower();
+}
+
+QString QueryCache::writtenTable(const QString &queryString)
+{
+    static const QRegularExpression regex(
+                QStringLiteral(
+                    R"(^\s*(?:insert(?:\s+ignore|\s+or\s+\w+)?\s+into|replace\s+into|)"
+                    R"(update(?:\s+ignore)?|delete\s+from|truncate(?:\s+table)?)"
+                    R"()\s+(?:only\s+)?((?:[`"\[]?[\w$]+[`"\]]?\.)?[`"\[]?[\w$]+[`"\]]?))"),
+                QRegularExpression::CaseInsensitiveOption);
+
+    const auto match = regex.match(queryString);
+
+    if (!match.hasMatch())
+        return {};
+
+    return normalizeTable(match.captured(1));
+}
+
+/* private */
+
+void QueryCache::remove(const EntriesType::iterator entry)
+{
+    --m_stats.entries;
+    m_stats.size -= entry->size;
+
+    m_index.erase(entry->key);
+    m_entries.erase(entry);
+}
+
+qint64 QueryCache::estimateSize(const QString &key, const QueryCacheResult &result)
+{
+    // Rough estimate, the QVariant size plus the heap allocated data
+    constexpr static qint64 RowOverhead = 64;
+
+    auto size = static_cast<qint64>(key.size()) * 2 +
+                static_cast<qint64>(sizeof (Entry));
+
+    for (const auto &row : result.rows) {
+        size += RowOverhead;
+
+        for (int i = 0; i < row.count(); ++i) {
+            const auto value = row.value(i);
+
+            size += static_cast<qint64>(sizeof (QVariant));
+
+            if (value.userType() == QMetaType::QString)
+                size += static_cast<qint64>(value.value<QString>().size()) * 2;
+            else if (value.userType() == QMetaType::QByteArray)
+                size += value.value<QByteArray>().size();
+        }
+    }
+
+    return size;
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,120 @@
+#include "orm/support/repeatedqueriesreporter.hpp"
+
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/sort.hpp>
+
+#include "orm/db.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Support
+{
+
+/* public */
+
+RepeatedQueriesReporter::RepeatedQueriesReporter(const QString &connection,
+                                                 const qint64 threshold)
+    : m_threshold(threshold)
+{
+    listen(connection);
+}
+
+RepeatedQueriesReporter::RepeatedQueriesReporter(const QStringList &connections,
+                                                 const qint64 threshold)
+    : m_threshold(threshold)
+{
+    m_listeners.reserve(static_cast<decltype (m_listeners)::size_type>(
+                            connections.size()));
+
+    for (const auto &connection : connections)
+        listen(connection);
+}
+
+RepeatedQueriesReporter::~RepeatedQueriesReporter()
+{
+    /* The listeners capture this pointer so they have to be removed, the connection
+       could already be removed from the DatabaseManager. */
+    for (const auto &[connection, listenerId] : m_listeners)
+        if (const auto connectionShared = connection.lock(); connectionShared)
+            connectionShared->removeQueryListener(listenerId);
+}
+
+QVector<RepeatedQueriesReporter::RepeatedQuery>
+RepeatedQueriesReporter::repeatedQueries() const
+{
+    QVector<RepeatedQuery> result;
+
+    for (const auto &[key, query] : m_queries)
+        if (query.count >= m_threshold)
+            result << query;
+
+    ranges::sort(result, [](const RepeatedQuery &left, const RepeatedQuery &right)
+    {
+        return left.count > right.count;
+    });
+
+    return result;
+}
+
+bool RepeatedQueriesReporter::hasRepeatedQueries() const
+{
+    return ranges::any_of(m_queries, [this](const auto &query)
+    {
+        return query.second.count >= m_threshold;
+    });
+}
+
+QString RepeatedQueriesReporter::report() const
+{
+    QStringList lines;
+
+    for (const auto &query : repeatedQueries())
+        lines << QStringLiteral("Executed %1 times (%2ms, %3) : %4")
+                 .arg(query.count)
+                 .arg(query.elapsed / 1000000)
+                 .arg(query.connection, query.query);
+
+    return lines.join(QChar('\n'));
+}
+
+void RepeatedQueriesReporter::reset() noexcept
+{
+    m_queries.clear();
+}
+
+/* private */
+
+void RepeatedQueriesReporter::listen(const QString &connection)
+{
+    auto &databaseConnection = DB::connection(connection);
+
+    const auto listenerId = databaseConnection.addQueryListener(
+                                [this](const QueryExecutedEvent &event)
+    {
+        aggregate(event);
+    });
+
+    m_listeners.emplace_back(databaseConnection.weak_from_this(), listenerId);
+}
+
+void RepeatedQueriesReporter::aggregate(const QueryExecutedEvent &event)
+{
+    /* The query shape is the executed query with placeholders, the bindings are
+       ignored so the lazy loaded relations of many models aggregate to the same
+       query shape. */
+    auto &query = m_queries[{event.connectionName, event.query}];
+
+    if (query.count == 0) {
+        query.query = event.query;
+        query.connection = event.connectionName;
+    }
+
+    ++query.count;
+
+    if (event.elapsed > 0)
+        query.elapsed += event.elapsed;
+}
+
+} // namespace Orm::Support
+
+TINYORM_END_COMMON_NAMESPACE
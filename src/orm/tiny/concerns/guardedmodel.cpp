@@ -1,5 +1,7 @@
 #include "orm/tiny/concerns/guardedmodel.hpp"
 
+#include <atomic>
+
 #include "orm/macros/threadlocal.hpp"
 
 TINYORM_BEGIN_COMMON_NAMESPACE
@@ -16,9 +18,10 @@ namespace Orm::Tiny::Concerns
 
 namespace
 {
-    /*! Indicates if all mass assignment is enabled. */
+    /*! Indicates if all mass assignment is enabled (atomic because it's shared by all
+        threads if the thread_local is disabled). */
     T_THREAD_LOCAL
-    bool g_unguarded = false;
+    std::atomic_bool g_unguarded = false;
 } // namespace
 
 /* public */
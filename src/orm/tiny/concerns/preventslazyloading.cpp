@@ -0,0 +1,58 @@
+#include "orm/tiny/concerns/preventslazyloading.hpp"
+
+#include <atomic>
+
+#include "orm/macros/threadlocal.hpp"
+#include "orm/tiny/exceptions/lazyloadingviolationerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Concerns
+{
+
+/* These variables have to live in the dll for the same reason as the g_unguarded
+   in the GuardedModel, they would have a different address in the dll and exe. */
+
+namespace
+{
+    /*! Indicates whether lazy loading is prevented on all models (atomic because
+        it's shared by all threads if the thread_local is disabled). */
+    T_THREAD_LOCAL
+    std::atomic_bool g_preventsLazyLoading = false;
+
+    /*! Callback invoked on the lazy loading violation, throws if not set. */
+    T_THREAD_LOCAL
+    PreventsLazyLoading::ViolationCallback g_violationCallback; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace
+
+/* public */
+
+void PreventsLazyLoading::preventLazyLoading(const bool value) noexcept
+{
+    g_preventsLazyLoading = value;
+}
+
+bool PreventsLazyLoading::preventsLazyLoading() noexcept
+{
+    return g_preventsLazyLoading;
+}
+
+void PreventsLazyLoading::handleLazyLoadingViolationUsing(ViolationCallback callback)
+{
+    g_violationCallback = std::move(callback);
+}
+
+/* protected */
+
+void PreventsLazyLoading::handleLazyLoadingViolation(const QString &model,
+                                                     const QString &relation)
+{
+    if (g_violationCallback)
+        return std::invoke(g_violationCallback, model, relation); // clazy:exclude=returning-void-expression
+
+    throw Exceptions::LazyLoadingViolationError(model, relation);
+}
+
+} // namespace Orm::Tiny::Concerns
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,30 @@
+#include "orm/tiny/exceptions/lazyloadingviolationerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny::Exceptions
+{
+
+/* public */
+
+LazyLoadingViolationError::LazyLoadingViolationError(const QString &model,
+                                                     const QString &relation)
+    : RuntimeError(formatMessage(model, relation))
+    , m_model(model)
+    , m_relation(relation)
+{}
+
+/* private */
+
+QString LazyLoadingViolationError::formatMessage(const QString &model,
+                                                 const QString &relation)
+{
+    return QStringLiteral("Attempted to lazy load the '%1' relation on the model "
+                          "'%2' but lazy loading is prevented, eager load the relation "
+                          "using the with() or load() methods instead.")
+            .arg(relation, model);
+}
+
+} // namespace Orm::Tiny::Exceptions
+
+TINYORM_END_COMMON_NAMESPACE
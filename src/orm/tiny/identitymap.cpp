@@ -0,0 +1,70 @@
+#include "orm/tiny/identitymap.hpp"
+
+#include "orm/macros/threadlocal.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Tiny
+{
+
+/* The g_current variable has to live in the dll, the same as in the GuardedModel,
+   otherwise it would have different addresses in the dll and the application exe. */
+
+namespace
+{
+    /*! Identity map active on the current thread. */
+    T_THREAD_LOCAL
+    IdentityMap *g_current = nullptr;
+} // namespace
+
+/* public */
+
+IdentityMap::IdentityMap()
+    : m_previous(g_current)
+{
+    setCurrent(this);
+}
+
+IdentityMap::~IdentityMap()
+{
+    setCurrent(m_previous);
+}
+
+IdentityMap *IdentityMap::current() noexcept
+{
+    return g_current;
+}
+
+std::size_t IdentityMap::size() const noexcept
+{
+    std::size_t size = 0;
+
+    for (const auto &[_, models] : m_models)
+        size += models.size();
+
+    return size;
+}
+
+/* private */
+
+void IdentityMap::setCurrent(IdentityMap *const identityMap) noexcept
+{
+    g_current = identityMap;
+}
+
+/* IdentityMap::Suspended */
+
+IdentityMap::Suspended::Suspended() noexcept
+    : m_suspended(g_current)
+{
+    setCurrent(nullptr);
+}
+
+IdentityMap::Suspended::~Suspended()
+{
+    setCurrent(m_suspended);
+}
+
+} // namespace Orm::Tiny
+
+TINYORM_END_COMMON_NAMESPACE
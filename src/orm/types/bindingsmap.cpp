@@ -0,0 +1,105 @@
+#include "orm/types/bindingsmap.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Types
+{
+
+/* public */
+
+QVector<QVariant> BindingsMap::value(const BindingType type) const
+{
+    const auto bindings = (*this)[type];
+
+    return {bindings.begin(), bindings.end()};
+}
+
+void BindingsMap::append(const BindingType type, const QVariant &binding)
+{
+    m_bindings.insert(sectionEnd(type), binding);
+
+    shiftSectionEnds(type, 1);
+}
+
+void BindingsMap::append(const BindingType type, QVariant &&binding)
+{
+    m_bindings.insert(sectionEnd(type), std::move(binding));
+
+    shiftSectionEnds(type, 1);
+}
+
+void BindingsMap::append(const BindingType type, const QVector<QVariant> &bindings)
+{
+    if (bindings.isEmpty())
+        return;
+
+    auto position = sectionEnd(type);
+
+    // All following sections are empty, append at the end
+    if (position == m_bindings.size())
+        m_bindings += bindings;
+    else {
+        m_bindings.reserve(m_bindings.size() + bindings.size());
+
+        for (const auto &binding : bindings)
+            m_bindings.insert(position++, binding);
+    }
+
+    shiftSectionEnds(type, bindings.size());
+}
+
+void BindingsMap::append(const BindingType type, QVector<QVariant> &&bindings) // NOLINT(cppcoreguidelines-rvalue-reference-param-not-moved)
+{
+    if (bindings.isEmpty())
+        return;
+
+    // Steal the bindings data if this map is empty
+    if (m_bindings.isEmpty()) {
+        const auto count = bindings.size();
+
+        m_bindings = std::move(bindings);
+
+        shiftSectionEnds(type, count);
+        return;
+    }
+
+    auto position = sectionEnd(type);
+
+    m_bindings.reserve(m_bindings.size() + bindings.size());
+
+    for (auto &binding : bindings)
+        m_bindings.insert(position++, std::move(binding));
+
+    shiftSectionEnds(type, bindings.size());
+}
+
+void BindingsMap::set(const BindingType type, QVector<QVariant> &&bindings)
+{
+    clear(type);
+
+    append(type, std::move(bindings));
+}
+
+void BindingsMap::clear(const BindingType type)
+{
+    const auto count = size(type);
+
+    if (count == 0)
+        return;
+
+    m_bindings.remove(sectionBegin(type), count);
+
+    shiftSectionEnds(type, -count);
+}
+
+/* private */
+
+void BindingsMap::shiftSectionEnds(const BindingType type, const size_type count) noexcept
+{
+    for (auto index = static_cast<std::size_t>(type); index < TypesCount; ++index)
+        m_sectionEnds[index] += count; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+} // namespace Orm::Types
+
+TINYORM_END_COMMON_NAMESPACE
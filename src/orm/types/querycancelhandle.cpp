@@ -0,0 +1,36 @@
+#include "orm/types/querycancelhandle.hpp"
+
+#include "orm/db.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm::Types
+{
+
+/* public */
+
+QueryCancelHandle::QueryCancelHandle(QString connection, QVariant backendId)
+    : m_connection(std::move(connection))
+    , m_backendId(std::move(backendId))
+{}
+
+bool QueryCancelHandle::cancel() const
+{
+    if (!isValid())
+        return false;
+
+    /* The cancelled connection is blocked by the running query, the connection
+       instances are thread-local, so this obtains a separate connection. */
+    auto &connection = DB::connection(m_connection);
+
+    /* Nothing to cancel, called from the thread that owns the cancelled connection,
+       so no query can be running on it. */
+    if (connection.getCancelHandle().getBackendId() == m_backendId)
+        return false;
+
+    return connection.cancelQuery(m_backendId);
+}
+
+} // namespace Orm::Types
+
+TINYORM_END_COMMON_NAMESPACE
@@ -32,6 +32,25 @@ SqlQuery::SqlQuery(QSqlQuery &&other, const QtTimeZoneConfig &qtTimeZone, // NOL
     , m_returnQDateTime(returnQDateTime)
 {}
 
+QVector<QSqlRecord> SqlQuery::fetchRecords()
+{
+    QVector<QSqlRecord> records;
+
+    if (const auto querySize = size(); querySize > 0)
+        records.reserve(querySize);
+
+    while (next()) {
+        auto record = this->record();
+
+        for (int i = 0; i < record.count(); ++i)
+            record.setValue(i, value(i));
+
+        records << std::move(record);
+    }
+
+    return records;
+}
+
 /* private */
 
 QVariant SqlQuery::valueInternal(QVariant &&value) const
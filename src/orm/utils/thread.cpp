@@ -1,8 +1,12 @@
 #include "orm/utils/thread.hpp"
 
 #include <QString>
+#include <QThreadStorage>
+
+#include <atomic>
 
 #include "orm/config.hpp" // IWYU pragma: keep
+#include "orm/macros/threadlocal.hpp"
 
 #if !defined(__clang__) && \
     !defined(TINYORM_NO_DEBUG) && defined(_MSC_VER) && !defined(Q_OS_WINRT)
@@ -20,6 +24,9 @@ namespace Orm::Utils
 
 namespace
 {
+    /*! Last assigned thread ordinal. */
+    std::atomic<quint64> g_lastThreadOrdinal = 0;
+
 #if !defined(__clang__) && \
     !defined(TINYORM_NO_DEBUG) && defined(_MSC_VER) && !defined(Q_OS_WINRT)
 
@@ -93,6 +100,26 @@ void Thread::nameThreadForDebugging([[maybe_unused]] const char *threadName,
 #endif
 }
 
+quint64 Thread::currentThreadOrdinal()
+{
+    /* Don't use the thread ID, it can be reused by the operating system after
+       the thread finishes, but data keyed by it can still exist. */
+#ifdef TINYORM_HAS_THREAD_LOCAL
+    T_THREAD_LOCAL
+    static const auto ordinal = ++g_lastThreadOrdinal;
+
+    return ordinal;
+#else
+    // The thread_local is disabled for this compiler, the QThreadStorage works
+    static QThreadStorage<quint64> ordinal;
+
+    if (!ordinal.hasLocalData())
+        ordinal.setLocalData(++g_lastThreadOrdinal);
+
+    return ordinal.localData();
+#endif
+}
+
 } // namespace Orm::Utils
 
 TINYORM_END_COMMON_NAMESPACE
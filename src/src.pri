@@ -5,8 +5,10 @@ extern_constants: \
 
 sourcesList += \
     $$PWD/orm/basegrammar.cpp \
+    $$PWD/orm/concerns/capturesslowqueries.cpp \
     $$PWD/orm/concerns/countsqueries.cpp \
     $$PWD/orm/concerns/detectslostconnections.cpp \
+    $$PWD/orm/concerns/dispatchesqueryevents.cpp \
     $$PWD/orm/concerns/hasconnectionresolver.cpp \
     $$PWD/orm/concerns/logsqueries.cpp \
     $$PWD/orm/concerns/managestransactions.cpp \
@@ -55,6 +57,12 @@ sourcesList += \
     $$PWD/orm/schema/schemabuilder.cpp \
     $$PWD/orm/schema/sqliteschemabuilder.cpp \
     $$PWD/orm/sqliteconnection.cpp \
+    $$PWD/orm/support/cachedsqlresult.cpp \
+    $$PWD/orm/support/connectionworkers.cpp \
+    $$PWD/orm/support/querycache.cpp \
+    $$PWD/orm/support/repeatedqueriesreporter.cpp \
+    $$PWD/orm/types/bindingsmap.cpp \
+    $$PWD/orm/types/querycancelhandle.cpp \
     $$PWD/orm/types/sqlquery.cpp \
     $$PWD/orm/utils/configuration.cpp \
     $$PWD/orm/utils/fs.cpp \
@@ -68,9 +76,12 @@ sourcesList += \
 !disable_orm: \
     sourcesList += \
         $$PWD/orm/tiny/concerns/guardedmodel.cpp \
+        $$PWD/orm/tiny/concerns/preventslazyloading.cpp \
+        $$PWD/orm/tiny/exceptions/lazyloadingviolationerror.cpp \
         $$PWD/orm/tiny/exceptions/modelnotfounderror.cpp \
         $$PWD/orm/tiny/exceptions/relationmappingnotfounderror.cpp \
         $$PWD/orm/tiny/exceptions/relationnotloadederror.cpp \
+        $$PWD/orm/tiny/identitymap.cpp \
         $$PWD/orm/tiny/tinytypes.cpp \
         $$PWD/orm/tiny/utils/attribute.cpp \
 
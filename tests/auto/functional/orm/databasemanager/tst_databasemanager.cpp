@@ -1,7 +1,12 @@
 #include <QCoreApplication>
+#include <QtSql/QSqlDatabase>
 #include <QtTest>
 
+#include <atomic>
+#include <thread>
+
 #include "orm/databasemanager.hpp"
+#include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/sqlitedatabasedoesnotexisterror.hpp"
 #include "orm/utils/type.hpp"
 
@@ -22,12 +27,15 @@ using Orm::Constants::SSL_KEY;
 using Orm::Constants::UTF8;
 using Orm::Constants::Version;
 using Orm::Constants::application_name;
+using Orm::Constants::busy_timeout;
+using Orm::Constants::cache_size;
 using Orm::Constants::charset_;
 using Orm::Constants::check_database_exists;
 using Orm::Constants::database_;
 using Orm::Constants::dont_drop;
 using Orm::Constants::driver_;
 using Orm::Constants::host_;
+using Orm::Constants::journal_mode;
 using Orm::Constants::options_;
 using Orm::Constants::password_;
 using Orm::Constants::port_;
@@ -42,10 +50,13 @@ using Orm::Constants::sslcert;
 using Orm::Constants::sslkey;
 using Orm::Constants::sslmode_;
 using Orm::Constants::sslrootcert;
+using Orm::Constants::synchronous;
+using Orm::Constants::temp_store;
 using Orm::Constants::username_;
 using Orm::Constants::verify_full;
 
 using Orm::DatabaseManager;
+using Orm::Exceptions::InvalidArgumentError;
 using Orm::Exceptions::SQLiteDatabaseDoesNotExistError;
 using Orm::QtTimeZoneConfig;
 using Orm::QtTimeZoneType;
@@ -79,9 +90,14 @@ private Q_SLOTS:
     void sqlite_CheckDatabaseExists_True() const;
     void sqlite_CheckDatabaseExists_False() const;
 
+    void sqlite_Pragmas() const;
+    void sqlite_Pragmas_ThrowException() const;
+
     void addUseAndRemoveConnection_FiveTimes() const;
     void addUseAndRemoveThreeConnections_FiveTimes() const;
 
+    void connection_reconnect_addConnection_MultipleThreads() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Test case class name. */
@@ -783,6 +799,76 @@ void tst_DatabaseManager::sqlite_CheckDatabaseExists_False() const
     QVERIFY(!QFile::exists(checkDatabaseExistsFile()));
 }
 
+void tst_DatabaseManager::sqlite_Pragmas() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,      QSQLITE},
+        {database_,    QStringLiteral(":memory:")},
+        {synchronous,  QStringLiteral("NORMAL")},
+        {cache_size,   -4000},
+        {temp_store,   QStringLiteral("memory")},
+        {busy_timeout, 3000},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    // Connection configuration
+    QCOMPARE(m_dm->getConfigValue(options_, *connectionName)
+                 .value<QVariantHash>().value("QSQLITE_BUSY_TIMEOUT"),
+             QVariant(QStringLiteral("3000")));
+
+    // Verify
+    auto &connection = m_dm->connection(*connectionName);
+
+    const auto pragma = [&connection](const QString &name)
+    {
+        auto query = connection.selectOne(QStringLiteral("PRAGMA %1").arg(name));
+
+        return query.value(0).value<int>();
+    };
+
+    // NORMAL
+    QCOMPARE(pragma(synchronous), 1);
+    QCOMPARE(pragma(cache_size), -4000);
+    // MEMORY
+    QCOMPARE(pragma(temp_store), 2);
+    QCOMPARE(pragma(busy_timeout), 3000);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_DatabaseManager::sqlite_Pragmas_ThrowException() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTemp(
+                                    Databases::SQLITE,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {driver_,       QSQLITE},
+        {database_,     QStringLiteral(":memory:")},
+        {journal_mode,  QStringLiteral("journal")},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    // Verify
+    QVERIFY_EXCEPTION_THROWN(m_dm->connection(*connectionName), InvalidArgumentError);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
 void tst_DatabaseManager::addUseAndRemoveConnection_FiveTimes() const
 {
     for (auto i = 0; i < 5; ++i) {
@@ -837,6 +923,93 @@ void tst_DatabaseManager::addUseAndRemoveThreeConnections_FiveTimes() const
         QVERIFY(Databases::removeConnection(*connectionName1));
     }
 }
+
+void tst_DatabaseManager::connection_reconnect_addConnection_MultipleThreads() const
+{
+    if (!m_dm->isDriverAvailable(QSQLITE))
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::SQLITE)
+              .toUtf8().constData(), );
+
+    constexpr auto ThreadsCount = 16;
+    constexpr auto IterationsCount = 25;
+
+    const QVariantHash configuration {
+        {driver_,   QSQLITE},
+        {database_, QStringLiteral(":memory:")},
+    };
+
+    // Shared by all threads, every thread has its own connection though
+    const auto sharedConnection = QStringLiteral("%1_%2")
+                                  .arg(QString::fromUtf8(ClassName),
+                                       QString::fromUtf8(__func__)); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+
+    m_dm->addConnection(configuration, sharedConnection);
+
+    std::atomic_int failures = 0;
+
+    std::vector<std::thread> threads;
+    threads.reserve(ThreadsCount);
+
+    for (auto t = 0; t < ThreadsCount; ++t)
+        threads.emplace_back([this, t, &configuration, &sharedConnection, &failures]
+        {
+            try {
+                for (auto i = 0; i < IterationsCount; ++i) {
+                    if (m_dm->connection(sharedConnection)
+                            .scalar(QStringLiteral("select 1")).value<int>() != 1
+                    )
+                        ++failures;
+
+                    if (m_dm->reconnect(sharedConnection)
+                            .scalar(QStringLiteral("select 2")).value<int>() != 2
+                    )
+                        ++failures;
+
+                    // Register, use, and remove a connection unique for this iteration
+                    const auto connectionName = QStringLiteral("%1_%2_%3")
+                                                .arg(sharedConnection).arg(t).arg(i);
+
+                    m_dm->addConnection(configuration, connectionName);
+
+                    if (m_dm->connection(connectionName)
+                            .scalar(QStringLiteral("select 3")).value<int>() != 3
+                    )
+                        ++failures;
+
+                    if (!m_dm->removeConnection(connectionName))
+                        ++failures;
+                }
+
+                // Remove this thread's DatabaseConnection and QSqlDatabase connection
+                m_dm->removeThreadConnections();
+
+                if (m_dm->openedConnectionsSize() != 0)
+                    ++failures;
+
+            } catch (...) {
+                ++failures;
+            }
+        });
+
+    for (auto &thread : threads)
+        thread.join();
+
+    // Verify
+    QCOMPARE(failures.load(), 0);
+    QCOMPARE(m_dm->connectionNames().size(), m_initialConnectionsCount + 1);
+
+    // No QSqlDatabase connections of finished threads are left behind
+    const auto threadConnectionPrefix = QStringLiteral("%1-thread")
+                                        .arg(sharedConnection);
+
+    for (const auto &qtConnection : QSqlDatabase::connectionNames())
+        QVERIFY(!qtConnection.startsWith(threadConnectionPrefix));
+
+    // Restore
+    QVERIFY(m_dm->removeConnection(sharedConnection));
+    QCOMPARE(m_dm->connectionNames().size(), m_initialConnectionsCount);
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
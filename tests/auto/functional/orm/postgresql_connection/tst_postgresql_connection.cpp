@@ -2,19 +2,30 @@
 #include <QtTest>
 
 #include "orm/databasemanager.hpp"
+#include "orm/exceptions/querytimeouterror.hpp"
 #include "orm/postgresconnection.hpp"
+#include "orm/support/connectionworkers.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
 
 using Orm::Constants::EMPTY;
 using Orm::Constants::PUBLIC;
+using Orm::Constants::application_name;
+using Orm::Constants::isolation_level;
+using Orm::Constants::query_timeout;
 using Orm::Constants::search_path;
+using Orm::Constants::synchronous_commit;
+using Orm::Constants::timezone_;
 using Orm::Constants::username_;
 
+using Orm::DatabaseConnection;
 using Orm::DatabaseManager;
 using Orm::PostgresConnection;
 
+using Orm::Exceptions::QueryTimeoutError;
+using Orm::Support::ConnectionWorkers;
+
 using TypeUtils = Orm::Utils::Type;
 
 using TestUtils::Databases;
@@ -42,6 +53,12 @@ private Q_SLOTS:
     void searchpath_WithUserVariable_UnQuoted_QString_PostgreSQL() const;
     void searchpath_WithUserVariable_UnQuoted_QStringList_PostgreSQL() const;
 
+    void sessionConfiguration_StartupOptions_PostgreSQL() const;
+
+    void queryTimeout_ThrowQueryTimeoutError_PostgreSQL() const;
+    void queryTimeout_ReappliedAfterRollBack_PostgreSQL() const;
+    void cancelHandle_CancelRunningQuery_PostgreSQL() const;
+
     /* Pretending */
     void searchpath_Pretend_Empty_PostgreSQL() const;
     void searchpath_Pretend_Empty_SingleQuotes_PostgreSQL() const;
@@ -343,6 +360,146 @@ void tst_PostgreSQL_Connection::
     QVERIFY(Databases::removeConnection(*connectionName));
 }
 
+void tst_PostgreSQL_Connection::sessionConfiguration_StartupOptions_PostgreSQL() const
+{
+    /* The session configuration is passed using the connection startup options,
+       values containing whitespaces and quotes must be escaped correctly. */
+
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTempFrom(
+                                    Databases::POSTGRESQL,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {application_name,   QStringLiteral("TinyORM's tests")},
+        {isolation_level,    QStringLiteral("REPEATABLE READ")},
+        {timezone_,          QStringLiteral("Europe/Bratislava")},
+        {synchronous_commit, QStringLiteral("off")},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    // Verify
+    auto &connection = m_dm->connection(*connectionName);
+
+    const auto show = [&connection](const QString &setting)
+    {
+        auto query = connection.unprepared(QStringLiteral("show %1").arg(setting));
+
+        return query.first() ? query.value(0).value<QString>() : QString("");
+    };
+
+    QCOMPARE(show(application_name), QStringLiteral("TinyORM's tests"));
+    QCOMPARE(show(QStringLiteral("default_transaction_isolation")),
+             QStringLiteral("repeatable read"));
+    QCOMPARE(show(QStringLiteral("TimeZone")), QStringLiteral("Europe/Bratislava"));
+    QCOMPARE(show(synchronous_commit), QStringLiteral("off"));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_PostgreSQL_Connection::queryTimeout_ThrowQueryTimeoutError_PostgreSQL() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTempFrom(
+                                    Databases::POSTGRESQL,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {query_timeout, 100},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    // Verify
+    auto &connection = m_dm->connection(*connectionName);
+
+    QCOMPARE(connection.getQueryTimeout(), 100);
+
+    QVERIFY_EXCEPTION_THROWN(connection.select(QStringLiteral("select pg_sleep(1)")),
+                             QueryTimeoutError);
+
+    // The per-query timeout overrides the connection's default timeout
+    auto query = connection.withQueryTimeout(0, [&connection]
+    {
+        return connection.select(QStringLiteral("select pg_sleep(0.2)"));
+    });
+    QVERIFY(query.first());
+
+    // The connection's default timeout was restored
+    auto statementTimeout = connection.unprepared(
+                                QStringLiteral("show statement_timeout"));
+    QVERIFY(statementTimeout.first());
+    QCOMPARE(statementTimeout.value(0).value<QString>(), QStringLiteral("100ms"));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_PostgreSQL_Connection::queryTimeout_ReappliedAfterRollBack_PostgreSQL() const
+{
+    // Add a new database connection
+    const auto connectionName = Databases::createConnectionTempFrom(
+                                    Databases::POSTGRESQL,
+                                    {ClassName, QString::fromUtf8(__func__)}, // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    {
+        {query_timeout, 100},
+    });
+
+    if (!connectionName)
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::POSTGRESQL)
+              .toUtf8().constData(), );
+
+    auto &connection = m_dm->connection(*connectionName);
+
+    const auto statementTimeout = [&connection]
+    {
+        auto query = connection.select(QStringLiteral("show statement_timeout"));
+        return query.first() ? query.value(0).value<QString>() : QString();
+    };
+
+    /* The SET statement_timeout is executed for the first time inside the transaction
+       so the rollback reverts it. */
+    connection.beginTransaction();
+    QCOMPARE(statementTimeout(), QStringLiteral("100ms"));
+    connection.rollBack();
+
+    // Verify
+    QCOMPARE(statementTimeout(), QStringLiteral("100ms"));
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*connectionName));
+}
+
+void tst_PostgreSQL_Connection::cancelHandle_CancelRunningQuery_PostgreSQL() const
+{
+    // The cancelled query runs on the connection's worker thread
+    const auto cancelHandle = ConnectionWorkers::run(m_connection,
+                                                     [](DatabaseConnection &connection)
+    {
+        return connection.getCancelHandle();
+    }).result();
+
+    QVERIFY(cancelHandle.isValid());
+
+    auto future = m_dm->connection(m_connection)
+                  .selectAsync(QStringLiteral("select pg_sleep(5)"));
+
+    // Give the worker thread time to start the query
+    QThread::msleep(500);
+
+    QVERIFY(cancelHandle.cancel());
+
+    // QueryError on Qt6 and QUnhandledException on Qt5
+    QVERIFY_EXCEPTION_THROWN(future.waitForFinished(), std::exception);
+}
+
 /* Pretending */
 
 void tst_PostgreSQL_Connection::searchpath_Pretend_Empty_PostgreSQL() const
@@ -6,6 +6,7 @@
 #include "orm/exceptions/invalidargumenterror.hpp"
 #include "orm/exceptions/multiplerecordsfounderror.hpp"
 #include "orm/exceptions/recordsnotfounderror.hpp"
+#include "orm/support/connectionworkers.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -28,6 +29,7 @@ using Orm::Exceptions::MultipleRecordsFoundError;
 using Orm::Exceptions::RecordsNotFoundError;
 using Orm::Exceptions::RuntimeError;
 using Orm::Query::Builder;
+using Orm::Support::ConnectionWorkers;
 using Orm::Types::SqlQuery;
 
 using QueryBuilder = Orm::Query::Builder;
@@ -92,8 +94,12 @@ private Q_SLOTS:
     void upsert_EmptyUpdate() const;
     void upsert_WithoutUpdate_UpdateAll() const;
 
+    void insertGetIds() const;
+    void insertGetIds_DuplicateUniqueKey_ThrowException() const;
+
     void count() const;
     void count_Distinct() const;
+    void count_Union_WithSelect() const;
     void min_Aggregate() const;
     void sum_Aggregate() const;
     void sum_Aggregate_ShouldReturnZeroInsteadOfNull() const;
@@ -108,6 +114,16 @@ private Q_SLOTS:
 
     void limit() const;
 
+    void batch() const;
+    void batch_FailedStatement_RollBack() const;
+    void batch_EmptyInsertStatement_Skipped() const;
+    void batch_FailedStatement_InTransaction_RollBackToSavepoint() const;
+
+    void getAsync() const;
+    void firstAsync_EmptyResult() const;
+    void getAsync_NestedAsyncQuery_WaitForDone() const;
+    void getAsync_AfterWorkerRemoved() const;
+
     /* Builds Queries */
     void sole() const;
     void sole_RecordsNotFoundError() const;
@@ -1313,6 +1329,62 @@ void tst_QueryBuilder::upsert_WithoutUpdate_UpdateAll() const
     }
 }
 
+void tst_QueryBuilder::insertGetIds() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    if (!DB::connection(connection).supportsInsertReturning())
+        QSKIP("The insert ... returning statement is supported only on the PostgreSQL "
+              "and SQLite >=3.35 databases.", );
+
+    const auto ids = createQuery(connection)->from("tag_properties")
+                     .insertGetIds({
+                         {{"tag_id", 1}, {"color", "green"}, {"position", 10}},
+                         {{"tag_id", 1}, {"color", "blue"},  {"position", 11}},
+                     }, "position");
+
+    QCOMPARE(ids.size(), 2);
+
+    // IDs are matched on the unique key and returned in the insertion order
+    QCOMPARE(createQuery(connection)->from("tag_properties").find(ids.at(0))
+             .value("color"),
+             QVariant(QString("green")));
+    QCOMPARE(createQuery(connection)->from("tag_properties").find(ids.at(1))
+             .value("color"),
+             QVariant(QString("blue")));
+
+    // Restore db
+    auto [affected, query] = createQuery(connection)->from("tag_properties")
+                             .whereIn(ID, {ids.at(0), ids.at(1)})
+                             .remove();
+
+    QVERIFY(!query.isValid() && !query.isSelect() && query.isActive());
+    QCOMPARE(affected, 2);
+}
+
+void tst_QueryBuilder::insertGetIds_DuplicateUniqueKey_ThrowException() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    if (!DB::connection(connection).supportsInsertReturning())
+        QSKIP("The insert ... returning statement is supported only on the PostgreSQL "
+              "and SQLite >=3.35 databases.", );
+
+    // Nothing is inserted, the unique key is validated before the insert
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery(connection)->from("tag_properties")
+                .insertGetIds({
+                    {{"tag_id", 1}, {"color", "green"}, {"position", 10}},
+                    {{"tag_id", 1}, {"color", "blue"},  {"position", 10}},
+                }, "position"),
+                InvalidArgumentError);
+
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery(connection)->from("tag_properties")
+                .insertGetIds({{{"tag_id", 1}, {"color", "green"}}}, "position"),
+                InvalidArgumentError);
+}
+
 void tst_QueryBuilder::count() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -1351,6 +1423,32 @@ void tst_QueryBuilder::count_Distinct() const
     QCOMPARE(count, static_cast<quint64>(5));
 }
 
+void tst_QueryBuilder::count_Union_WithSelect() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    // Ownership of the std::shared_ptr<QueryBuilder>
+    auto unionQuery = createQuery(connection);
+    unionQuery->from("torrent_peers")
+            .selectRaw("id + ? as id_shifted", {99})
+            .whereEq(ID, 2);
+
+    auto builder = createQuery(connection);
+    builder->from("torrent_peers")
+            .selectRaw("id + ? as id_shifted", {100})
+            .whereIn(ID, {1, 2})
+            .union_(*unionQuery);
+
+    // The 101 from the union query is a duplicate
+    const auto count = builder->count();
+
+    QCOMPARE(typeid (count), typeid (quint64));
+    QCOMPARE(count, static_cast<quint64>(2));
+
+    // The aggregate column is selected from the wrapped union query
+    QCOMPARE(builder->sum("id_shifted").value<quint64>(), static_cast<quint64>(203));
+}
+
 void tst_QueryBuilder::min_Aggregate() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -1563,6 +1661,220 @@ void tst_QueryBuilder::limit() const
     }
 }
 
+void tst_QueryBuilder::batch() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto results = DB::batch({
+        createQuery(connection)->from("tag_properties")
+                .toInsertStatement({{"tag_id", 1}, {"color", "pink"}, {"position", 4}}),
+        createQuery(connection)->from("tag_properties")
+                .whereEq("position", 4)
+                .toUpdateStatement({{"color", "purple"}}),
+        createQuery(connection)->from("tag_properties")
+                .whereEq("position", 4)
+                .toDeleteStatement(),
+    }, connection);
+
+    QCOMPARE(results.size(), 3);
+
+    for (const auto &result : results) {
+        QVERIFY(result.executed);
+        QVERIFY(!result.error.isValid());
+        QCOMPARE(result.affected, 1);
+    }
+
+    // Validate the db is unchanged
+    QCOMPARE(createQuery(connection)->from("tag_properties")
+             .whereEq("tag_id", 1)
+             .count(),
+             static_cast<quint64>(1));
+}
+
+void tst_QueryBuilder::batch_FailedStatement_RollBack() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto results = DB::batch({
+        createQuery(connection)->from("tag_properties")
+                .whereEq(ID, 1)
+                .toUpdateStatement({{"color", "black"}}),
+        createQuery(connection)->from("tag_properties")
+                .toInsertStatement({{"column_not_exists", 1}}),
+        createQuery(connection)->from("tag_properties")
+                .whereEq(ID, 1)
+                .toDeleteStatement(),
+    }, connection);
+
+    QCOMPARE(results.size(), 3);
+
+    QVERIFY(results.at(0).executed);
+    QCOMPARE(results.at(0).affected, 1);
+
+    QVERIFY(!results.at(1).executed);
+    QVERIFY(results.at(1).error.isValid());
+
+    // The statement after the failed statement is not executed
+    QVERIFY(!results.at(2).executed);
+    QCOMPARE(results.at(2).affected, -1);
+
+    // Validate the update was rolled back
+    QCOMPARE(createQuery(connection)->from("tag_properties")
+             .whereEq(ID, 1)
+             .value("color"),
+             QVariant(QString("white")));
+}
+
+void tst_QueryBuilder::batch_EmptyInsertStatement_Skipped() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    const auto emptyStatement = createQuery(connection)->from("tag_properties")
+                                .toInsertStatement(QVector<QVariantMap>());
+
+    QVERIFY(emptyStatement.query.isEmpty());
+    QVERIFY(emptyStatement.bindings.isEmpty());
+
+    auto results = DB::batch({
+        emptyStatement,
+        createQuery(connection)->from("tag_properties")
+                .whereEq(ID, 1)
+                .toUpdateStatement({{"color", "black"}}),
+    }, connection);
+
+    QCOMPARE(results.size(), 2);
+
+    // The empty statement is not executed and it doesn't stop the batch
+    QVERIFY(!results.at(0).executed);
+    QVERIFY(!results.at(0).error.isValid());
+    QCOMPARE(results.at(0).affected, -1);
+
+    QVERIFY(results.at(1).executed);
+    QVERIFY(!results.at(1).error.isValid());
+    QCOMPARE(results.at(1).affected, 1);
+
+    // Validate the update was committed
+    QCOMPARE(createQuery(connection)->from("tag_properties")
+             .whereEq(ID, 1)
+             .value("color"),
+             QVariant(QString("black")));
+
+    // Restore
+    createQuery(connection)->from("tag_properties")
+            .whereEq(ID, 1)
+            .update({{"color", "white"}});
+}
+
+void tst_QueryBuilder::batch_FailedStatement_InTransaction_RollBackToSavepoint() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    DB::beginTransaction(connection);
+
+    createQuery(connection)->from("tag_properties")
+            .whereEq(ID, 1)
+            .update({{"color", "red"}});
+
+    auto results = DB::batch({
+        createQuery(connection)->from("tag_properties")
+                .whereEq(ID, 1)
+                .toUpdateStatement({{"color", "black"}}),
+        createQuery(connection)->from("tag_properties")
+                .toInsertStatement({{"column_not_exists", 1}}),
+    }, connection);
+
+    QCOMPARE(results.size(), 2);
+
+    QVERIFY(results.at(0).executed);
+    QVERIFY(!results.at(1).executed);
+    QVERIFY(results.at(1).error.isValid());
+
+    // The caller's transaction is still usable and only the batch was rolled back
+    QVERIFY(DB::connection(connection).inTransaction());
+    QCOMPARE(createQuery(connection)->from("tag_properties")
+             .whereEq(ID, 1)
+             .value("color"),
+             QVariant(QString("red")));
+
+    DB::rollBack(connection);
+
+    // Validate the caller's transaction was rolled back
+    QCOMPARE(createQuery(connection)->from("tag_properties")
+             .whereEq(ID, 1)
+             .value("color"),
+             QVariant(QString("white")));
+}
+
+void tst_QueryBuilder::getAsync() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto builder = createQuery(connection);
+
+    auto future = builder->from("torrents").whereEq(ID, 2).getAsync({ID, NAME});
+
+    // The query was copied when the async query was started
+    builder->whereEq(ID, 3);
+
+    const auto records = future.result();
+
+    QCOMPARE(records.size(), 1);
+    QCOMPARE(records.constFirst().value(ID), QVariant(2));
+    QCOMPARE(records.constFirst().value(NAME), QVariant("test2"));
+}
+
+void tst_QueryBuilder::firstAsync_EmptyResult() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    const auto record = createQuery(connection)->from("torrents")
+                        .whereEq(ID, 100).firstAsync().result();
+
+    QVERIFY(record.isEmpty());
+}
+
+void tst_QueryBuilder::getAsync_NestedAsyncQuery_WaitForDone() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    // The running task obtains the worker while the main thread waits for all workers
+    auto future = ConnectionWorkers::run(connection, [](auto &workerConnection)
+    {
+        QThread::msleep(50);
+
+        return workerConnection.table("torrents")->whereEq(ID, 2).getAsync({ID});
+    });
+
+    ConnectionWorkers::waitForDone();
+
+    QVERIFY(future.isFinished());
+
+    const auto records = future.result().result();
+
+    QCOMPARE(records.size(), 1);
+    QCOMPARE(records.constFirst().value(ID), QVariant(2));
+}
+
+void tst_QueryBuilder::getAsync_AfterWorkerRemoved() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto future = createQuery(connection)->from("torrents").whereEq(ID, 2).getAsync();
+
+    // Waits for the queued query and removes the worker thread's connection
+    ConnectionWorkers::remove(connection);
+
+    QVERIFY(future.isFinished());
+    QCOMPARE(future.result().size(), 1);
+
+    // A new worker thread is created for the next async query
+    const auto records = createQuery(connection)->from("torrents")
+                         .whereEq(ID, 3).getAsync({ID}).result();
+
+    QCOMPARE(records.size(), 1);
+    QCOMPARE(records.constFirst().value(ID), QVariant(3));
+}
+
 /* Builds Queries */
 
 void tst_QueryBuilder::sole() const
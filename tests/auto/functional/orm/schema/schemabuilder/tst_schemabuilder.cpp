@@ -4,6 +4,7 @@
 #include <filesystem>
 
 #include "orm/db.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
 #include "orm/postgresconnection.hpp"
 #include "orm/schema.hpp"
 #include "orm/utils/type.hpp"
@@ -25,6 +26,7 @@ using Orm::Constants::database_;
 using Orm::Constants::username_;
 
 using Orm::DB;
+using Orm::Exceptions::RuntimeError;
 using Orm::PostgresConnection;
 using Orm::Schema;
 using Orm::SchemaNs::Blueprint;
@@ -46,6 +48,8 @@ private Q_SLOTS:
     void getAllTables() const;
     void getAllViews_dropAllViews() const;
 
+    void createSnapshot_restoreSnapshot_dropSnapshotIfExists() const;
+
     void getColumnListing() const;
 
     void hasTable() const;
@@ -62,6 +66,8 @@ private:
     inline static const auto *ClassName = "tst_SchemaBuilder";
     /*! Database name used in the current test case. */
     inline static const auto DatabaseName = QStringLiteral("tinyorm_tests_schemabuilder");
+    /*! Database snapshot name used in tests. */
+    inline static const auto SnapshotName = QStringLiteral("migrated");
 
     /*! Get all database tables for the given connection. */
     static QSet<QString> getAllTablesFor(const QString &connection);
@@ -244,6 +250,75 @@ void tst_SchemaBuilder::getAllViews_dropAllViews() const
     QVERIFY(getAllViewsFor(connection).isEmpty());
 }
 
+void tst_SchemaBuilder::createSnapshot_restoreSnapshot_dropSnapshotIfExists() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto database = DatabaseName;
+    if (DB::driverName(connection) == QSQLITE)
+        database.append(QStringLiteral(".sqlite3"));
+
+    Schema::on(connection).createDatabase(database);
+
+    /* Create an alternative connection for connecting to another database because
+       the restoreSnapshot() replaces the whole database. */
+    const auto alternativeConnection =
+            tst_SchemaBuilder::alternativeConnection(connection);
+
+    // Prepare the database to snapshot (the generated column can't be copied)
+    Schema::on(*alternativeConnection).create(Firewalls, [](Blueprint &table)
+    {
+        table.id();
+        table.string(NAME);
+        table.integer(QStringLiteral("name_length")).storedAs("length(name)");
+    });
+
+    DB::table(Firewalls, *alternativeConnection)->insert({{NAME, "firewall_1"}});
+
+    // createSnapshot()
+    Schema::on(*alternativeConnection).createSnapshot(SnapshotName);
+
+    // Modify the database after the snapshot was created
+    DB::table(Firewalls, *alternativeConnection)->insert({{NAME, "firewall_2"}});
+
+    Schema::on(*alternativeConnection)
+            .create(QStringLiteral("tinyorm_test_table_to_drop_1"), [](Blueprint &table)
+    {
+        table.id();
+    });
+
+    // restoreSnapshot()
+    Schema::on(*alternativeConnection).restoreSnapshot(SnapshotName);
+
+    // Verify restoreSnapshot()
+    {
+        QCOMPARE(getAllTablesFor(*alternativeConnection), QSet<QString> {Firewalls});
+
+        auto count = DB::table(Firewalls, *alternativeConnection)->count();
+        QCOMPARE(count, 1);
+
+        // The generated column is computed again
+        QCOMPARE(DB::table(Firewalls, *alternativeConnection)
+                 ->value(QStringLiteral("name_length")).value<int>(),
+                 10);
+    }
+
+    // The missing snapshot must not touch the current database
+    QVERIFY_EXCEPTION_THROWN(Schema::on(*alternativeConnection)
+                             .restoreSnapshot(QStringLiteral("missing")),
+                             RuntimeError);
+
+    QCOMPARE(DB::table(Firewalls, *alternativeConnection)->count(), 1);
+
+    // dropSnapshotIfExists()
+    Schema::on(*alternativeConnection).dropSnapshotIfExists(SnapshotName);
+
+    // Restore
+    QVERIFY(Databases::removeConnection(*alternativeConnection));
+
+    Schema::on(connection).dropDatabaseIfExists(database);
+}
+
 void tst_SchemaBuilder::getColumnListing() const
 {
     QFETCH_GLOBAL(QString, connection);
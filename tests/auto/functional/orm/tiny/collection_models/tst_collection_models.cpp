@@ -2,6 +2,8 @@
 #include <QtSql/QSqlDriver>
 #include <QtTest>
 
+#include "orm/db.hpp"
+
 #include "common/collection.hpp"
 #include "databases.hpp"
 
@@ -19,6 +21,7 @@ using Orm::Constants::SIZE_;
 using Orm::Constants::SPACE_IN;
 using Orm::Constants::UPDATED_AT;
 
+using Orm::DB;
 using Orm::Exceptions::InvalidArgumentError;
 using Orm::One;
 using Orm::Utils::NullVariant;
@@ -89,6 +92,7 @@ private Q_SLOTS:
     void map_CustomReturnType_WithIndex() const;
 
     void mapWithModelKeys() const;
+    void keyBy() const;
 
     void mapWithKeys_IdAndName() const;
     void mapWithKeys_NameAndId() const;
@@ -161,6 +165,8 @@ private Q_SLOTS:
     void stableSortBy_Projection() const;
     void stableSortByDesc_Projection() const;
 
+    void stableSortBy_Parallel() const;
+
     void unique() const;
     void unique_NoSorting() const;
 
@@ -189,6 +195,8 @@ private Q_SLOTS:
     void load_rvalue_WithLambdaConstraint() const;
     void load_rvalue_NonExistentRelation_Failed() const;
 
+    void saveAll() const;
+
     /* EnumeratesValues */
     void toVector() const;
     void toMap() const;
@@ -807,6 +815,31 @@ void tst_Collection_Models::mapWithModelKeys() const
     QCOMPARE(result, expected);
 }
 
+void tst_Collection_Models::keyBy() const
+{
+    auto images = AlbumImage::whereEq(Common::album_id, 2)->get();
+    QCOMPARE(images.size(), 5);
+    QCOMPARE(typeid (images), typeid (ModelsCollection<AlbumImage>));
+    QVERIFY(Common::verifyIds(images, {2, 3, 4, 5, 6}));
+
+    // Get result
+    const auto keyed = images.keyBy();
+
+    // Verify
+    QCOMPARE(keyed.size(), static_cast<std::size_t>(5));
+
+    QCOMPARE(keyed.find(2), &images[0]); // NOLINT(readability-container-data-pointer)
+    QCOMPARE(keyed.find(6), &images[4]);
+    QCOMPARE(keyed.find(QVariant(4)), &images[2]);
+    QVERIFY(keyed.find(1) == nullptr);
+    QCOMPARE(keyed.find(1, &images[1]), &images[1]);
+
+    QVERIFY(keyed.contains(3));
+    QVERIFY(keyed.contains(QVariant(5)));
+    QVERIFY(keyed.doesntContain(1));
+    QVERIFY(keyed.doesntContain(QVariant(7)));
+}
+
 void tst_Collection_Models::mapWithKeys_IdAndName() const
 {
     auto images = AlbumImage::whereEq(Common::album_id, 2)->get();
@@ -2087,6 +2120,37 @@ void tst_Collection_Models::stableSortByDesc_Projection() const
     QCOMPARE(sorted, expectedAlbums);
 }
 
+void tst_Collection_Models::stableSortBy_Parallel() const
+{
+    // Big enough to be sorted using more threads
+    constexpr ModelsCollection<Album>::size_type count = 20000;
+
+    ModelsCollection<Album> albums;
+    albums.reserve(count);
+
+    for (ModelsCollection<Album>::size_type i = 0; i < count; ++i)
+        albums.push_back(Album {{ID, i}, {SIZE_, (i * 7) % 100}});
+
+    auto sorted = albums.stableSortBy<quint64>(SIZE_, false, true);
+    QCOMPARE(typeid (sorted), typeid (ModelsCollection<Album *>));
+    QCOMPARE(sorted.size(), count);
+
+    for (ModelsCollection<Album *>::size_type i = 1; i < count; ++i) {
+        const auto *const previous = sorted.at(i - 1);
+        const auto *const current = sorted.at(i);
+
+        const auto previousSize = previous->getAttribute<quint64>(SIZE_);
+        const auto size = current->getAttribute<quint64>(SIZE_);
+
+        QVERIFY(previousSize <= size);
+
+        // Stable sort must preserve the original order of models with the same size
+        if (previousSize == size)
+            QVERIFY(previous->getAttribute<quint64>(ID) <
+                    current->getAttribute<quint64>(ID));
+    }
+}
+
 void tst_Collection_Models::unique() const
 {
     ModelsCollection<Album> albums = Orm::collect<Album>({
@@ -2929,6 +2993,81 @@ void tst_Collection_Models::load_rvalue_NonExistentRelation_Failed() const
     verify();
 }
 
+void tst_Collection_Models::saveAll() const
+{
+    auto images = AlbumImage::whereIn(ID, {2, 3})->orderBy(ID).get();
+    QCOMPARE(images.size(), 2);
+    QVERIFY(Common::verifyIds(images, {2, 3}));
+
+    // Backup updated_at values to restore them later
+    const auto updatedAtOriginals = images.pluck(UPDATED_AT);
+
+    // Dirty models
+    for (auto &image : images)
+        image.setAttribute(SIZE_, image.getAttribute<int>(SIZE_) + 1);
+
+    // New model
+    AlbumImage imageNew;
+    imageNew.setAttribute("album_id", 2)
+            .setAttribute(NAME, "album2_image6")
+            .setAttribute("ext", "png")
+            .setAttribute(SIZE_, 100);
+    images << std::move(imageNew);
+
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    QVERIFY(images.saveAll());
+    DB::disableQueryLog(m_connection);
+
+    // Both dirty models were updated using one update statement
+    {
+        const auto queryLog = DB::getQueryLog(m_connection);
+        const auto updatesCount = std::ranges::count_if(*queryLog,
+                                                        [](const auto &log)
+        {
+            return log.query.startsWith(QStringLiteral("update "));
+        });
+        QCOMPARE(updatesCount, static_cast<decltype (updatesCount)>(1));
+    }
+
+    // Verify
+    for (const auto &image : images) {
+        QVERIFY(image.exists);
+        QVERIFY(!image.isDirty());
+    }
+    QVERIFY(images.last().getKey().isValid());
+
+    {
+        auto imagesFresh = AlbumImage::whereIn(ID, {2, 3})->orderBy(ID).get();
+        QCOMPARE(imagesFresh.size(), 2);
+        QCOMPARE(imagesFresh.at(0).getAttribute<int>(SIZE_), 425);
+        QCOMPARE(imagesFresh.at(1).getAttribute<int>(SIZE_), 513);
+
+        auto imageNewFresh = AlbumImage::find(images.last().getKey());
+        QVERIFY(imageNewFresh);
+        QCOMPARE(imageNewFresh->getAttribute<QString>(NAME),
+                 QStringLiteral("album2_image6"));
+    }
+
+    // Restore
+    QVERIFY(images.last().remove());
+    images.removeLast();
+
+    for (ModelsCollection<AlbumImage>::size_type i = 0; i < images.size(); ++i) {
+        auto &image = images[i];
+        image.setAttribute(SIZE_, image.getAttribute<int>(SIZE_) - 1)
+             .setAttribute(UPDATED_AT, updatedAtOriginals.at(i));
+    }
+
+    QVERIFY(images.saveAll());
+
+    // Verify restored
+    auto imagesRestored = AlbumImage::whereIn(ID, {2, 3})->orderBy(ID).get();
+    QCOMPARE(imagesRestored.size(), 2);
+    QCOMPARE(imagesRestored.at(0).getAttribute<int>(SIZE_), 424);
+    QCOMPARE(imagesRestored.at(1).getAttribute<int>(SIZE_), 512);
+}
+
 /* EnumeratesValues */
 
 void tst_Collection_Models::toVector() const
@@ -29,6 +29,7 @@ using TypeUtils = Orm::Utils::Type;
 
 using Orm::Tiny::AttributeItem;
 using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::IdentityMap;
 using Orm::Tiny::Exceptions::MassAssignmentError;
 using Orm::Tiny::Types::ModelsCollection;
 
@@ -109,6 +110,13 @@ private Q_SLOTS:
     void with_WithSelectConstraint_WithoutQualifiedColumnsForRelatedTable() const;
     void with_BelongsToMany_WithSelectConstraint_QualifiedColumnsForRelatedTable() const;
 
+    /* Identity map */
+    void identityMap_find() const;
+    void identityMap_find_SoftDeletes() const;
+    void identityMap_with_BelongsTo() const;
+    void identityMap_with_BelongsTo_AllFound() const;
+    void identityMap_with_BelongsTo_SoftDeletes() const;
+
     /* Retrieving results */
     void pluck() const;
     void pluck_EmptyResult() const;
@@ -1001,6 +1009,135 @@ void tst_Model_Connection_Independent::
                  "where `tag_torrent`.`torrent_id` in (?)"));
 }
 
+/* Identity map */
+
+void tst_Model_Connection_Independent::identityMap_find() const
+{
+    IdentityMap identityMap;
+
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    auto file1 = TorrentPreviewableFile::find(2);
+    auto file2 = TorrentPreviewableFile::find(2);
+    // Constrained query can't be served from the identity map
+    auto file3 = TorrentPreviewableFile::whereEq("torrent_id", 2)->find(2);
+    DB::disableQueryLog(m_connection);
+
+    QVERIFY(file1);
+    QVERIFY(file2);
+    QVERIFY(file3);
+    QVERIFY(file2->exists);
+    QVERIFY(file1->is(file2));
+    QCOMPARE(file1->getAttributes(), file2->getAttributes());
+
+    const auto queryLog = DB::getQueryLog(m_connection);
+    QCOMPARE(queryLog->size(), 2);
+    QCOMPARE(identityMap.size(), static_cast<std::size_t>(1));
+}
+
+void tst_Model_Connection_Independent::identityMap_find_SoftDeletes() const
+{
+    IdentityMap identityMap;
+
+    // The SoftDeletes scope constrains the query, it can't be served
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    auto torrent1 = Torrent::find(2);
+    auto torrent2 = Torrent::find(2);
+    DB::disableQueryLog(m_connection);
+
+    QVERIFY(torrent1);
+    QVERIFY(torrent2);
+
+    const auto queryLog = DB::getQueryLog(m_connection);
+    QCOMPARE(queryLog->size(), 2);
+    QCOMPARE(identityMap.size(), static_cast<std::size_t>(0));
+}
+
+void tst_Model_Connection_Independent::identityMap_with_BelongsTo() const
+{
+    IdentityMap identityMap;
+
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    auto file = TorrentPreviewableFile::find(2);
+    auto properties = TorrentPreviewableFileProperty::with("torrentFile")
+                      ->whereIn(ID, {1, 2, 3})
+                      .get();
+    DB::disableQueryLog(m_connection);
+
+    QVERIFY(file);
+    QCOMPARE(properties.size(), 3);
+
+    for (auto &property : properties) {
+        auto relatedFile = property.getRelation<TorrentPreviewableFile, One>(
+                               "torrentFile");
+        QVERIFY(relatedFile);
+        QCOMPARE((*relatedFile)[ID].value(), property["previewable_file_id"].value());
+    }
+
+    // The previewable file with the ID 2 was served from the identity map
+    const auto queryLog = DB::getQueryLog(m_connection);
+    QCOMPARE(queryLog->size(), 3);
+    QCOMPARE(queryLog->at(2).query,
+             QString("select * from `torrent_previewable_files` "
+                     "where `torrent_previewable_files`.`id` in (?, ?)"));
+
+    // Eager loaded previewable file with the ID 3 is shared through the identity map
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    QVERIFY(TorrentPreviewableFile::find(3));
+    DB::disableQueryLog(m_connection);
+
+    QVERIFY(DB::getQueryLog(m_connection)->isEmpty());
+}
+
+void tst_Model_Connection_Independent::identityMap_with_BelongsTo_AllFound() const
+{
+    IdentityMap identityMap;
+
+    QVERIFY(TorrentPreviewableFile::find(2));
+    QVERIFY(TorrentPreviewableFile::find(3));
+
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    auto properties = TorrentPreviewableFileProperty::with("torrentFile")
+                      ->whereIn(ID, {1, 2})
+                      .get();
+    DB::disableQueryLog(m_connection);
+
+    QCOMPARE(properties.size(), 2);
+
+    for (auto &property : properties)
+        QVERIFY(property.getRelation<TorrentPreviewableFile, One>("torrentFile"));
+
+    // All previewable files were served from the identity map, no eager query
+    QCOMPARE(DB::getQueryLog(m_connection)->size(), 1);
+}
+
+void tst_Model_Connection_Independent::identityMap_with_BelongsTo_SoftDeletes() const
+{
+    IdentityMap identityMap;
+
+    // The withTrashed() query isn't constrained, the torrent is remembered
+    QVERIFY(Torrent::withTrashed()->find(2));
+    QCOMPARE(identityMap.size(), static_cast<std::size_t>(1));
+
+    DB::flushQueryLog(m_connection);
+    DB::enableQueryLog(m_connection);
+    auto files = TorrentPreviewableFile::with("torrent")->whereIn(ID, {2, 4}).get();
+    DB::disableQueryLog(m_connection);
+
+    QCOMPARE(files.size(), 2);
+
+    // The SoftDeletes scope constrains the eager query, all keys are queried
+    const auto queryLog = DB::getQueryLog(m_connection);
+    QCOMPARE(queryLog->size(), 2);
+    QCOMPARE(queryLog->at(1).query,
+             QString("select * from `torrents` where `torrents`.`id` in (?, ?) "
+                     "and `torrents`.`deleted_at` is null"));
+}
+
 /* Retrieving results */
 
 void tst_Model_Connection_Independent::pluck() const
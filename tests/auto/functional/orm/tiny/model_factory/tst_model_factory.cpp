@@ -0,0 +1,201 @@
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "orm/db.hpp"
+#include "orm/tiny/factory.hpp"
+
+#include "databases.hpp"
+
+#include "models/tag.hpp"
+#include "models/tagproperty.hpp"
+
+using Orm::Constants::NAME;
+using Orm::Constants::NOTE;
+
+using Orm::DB;
+
+using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Factory;
+using Orm::Tiny::Types::ModelsCollection;
+
+using TypeUtils = Orm::Utils::Type;
+
+using TestUtils::Databases;
+
+using Models::Tag;
+using Models::TagProperty;
+
+/*! Tag model factory. */
+class TagFactory final : public Factory<TagFactory, Tag>
+{
+    friend Factory;
+
+    /*! Define the model's default attributes. */
+    Attributes definition() const
+    {
+        return {{NOTE, "factory"}};
+    }
+};
+
+/*! Tag property model factory. */
+class TagPropertyFactory final : public Factory<TagPropertyFactory, TagProperty>
+{
+    friend Factory;
+
+    /*! Define the model's default attributes. */
+    Attributes definition() const
+    {
+        return {{"color", "white"}};
+    }
+};
+
+class tst_Model_Factory : public QObject // clazy:exclude=ctor-missing-parent-argument
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void init() const;
+    void cleanup() const;
+
+    void make_DoesNotPersist() const;
+    void create_InBatches_AssignsKeys() const;
+    void insert_ReturnsCount() const;
+    void state_sequence() const;
+    void has_CreatesChildModels() const;
+
+    void batchSize_Zero_ThrowsException() const;
+
+// NOLINTNEXTLINE(readability-redundant-access-specifiers)
+private:
+    /*! Name sequence callback, the name column is unique. */
+    static TagFactory::Attributes tagName(std::size_t index);
+
+    /*! Connection name used in this test case. */
+    QString m_connection {};
+};
+
+/* private slots */
+
+// NOLINTBEGIN(readability-convert-member-functions-to-static)
+void tst_Model_Factory::initTestCase()
+{
+    ConnectionOverride::connection = m_connection =
+            Databases::createConnection(Databases::MYSQL);
+
+    if (m_connection.isEmpty())
+        QSKIP(TestUtils::AutoTestSkipped
+              .arg(TypeUtils::classPureBasename(*this), Databases::MYSQL)
+              .toUtf8().constData(), );
+}
+
+void tst_Model_Factory::init() const
+{
+    // Every test method is rolled back to keep the test database clean
+    DB::beginTransaction(m_connection);
+}
+
+void tst_Model_Factory::cleanup() const
+{
+    DB::rollBack(m_connection);
+}
+
+void tst_Model_Factory::make_DoesNotPersist() const
+{
+    auto tags = TagFactory().count(3).sequence(tagName).make();
+
+    QCOMPARE(tags.size(), static_cast<ModelsCollection<Tag>::size_type>(3));
+
+    for (const auto &tag : tags) {
+        QVERIFY(!tag.exists);
+        QVERIFY(!tag.getKey().isValid());
+        QCOMPARE(tag.getAttribute(NOTE), QVariant(QString("factory")));
+        QVERIFY(Tag::whereEq(NAME, tag.getAttribute(NAME))->doesntExist());
+    }
+}
+
+void tst_Model_Factory::create_InBatches_AssignsKeys() const
+{
+    // 5 models in 3 batches
+    auto tags = TagFactory().count(5).batchSize(2).sequence(tagName).create();
+
+    QCOMPARE(tags.size(), static_cast<ModelsCollection<Tag>::size_type>(5));
+
+    for (const auto &tag : tags) {
+        QVERIFY(tag.exists);
+        QVERIFY(tag.getKey().isValid());
+        QVERIFY(!tag.isDirty());
+
+        auto tagDb = Tag::find(tag.getKey());
+
+        QVERIFY(tagDb);
+        QCOMPARE(tagDb->getAttribute(NAME), tag.getAttribute(NAME));
+        QVERIFY(tagDb->getAttribute("created_at").isValid());
+    }
+}
+
+void tst_Model_Factory::insert_ReturnsCount() const
+{
+    const auto countBefore = Tag::count();
+
+    const auto inserted = TagFactory().count(4).sequence(tagName).insert();
+
+    QCOMPARE(inserted, static_cast<std::size_t>(4));
+    QCOMPARE(Tag::count(), countBefore + 4);
+}
+
+void tst_Model_Factory::state_sequence() const
+{
+    auto tags = TagFactory().count(4)
+                            .sequence(tagName)
+                            .state({{NOTE, "state"}})
+                            .sequence({{{NOTE, "odd"}}, {{NOTE, "even"}}})
+                            .make();
+
+    QCOMPARE(tags.size(), static_cast<ModelsCollection<Tag>::size_type>(4));
+    QCOMPARE(tags.at(0).getAttribute(NOTE), QVariant(QString("odd")));
+    QCOMPARE(tags.at(1).getAttribute(NOTE), QVariant(QString("even")));
+    QCOMPARE(tags.at(2).getAttribute(NOTE), QVariant(QString("odd")));
+    QCOMPARE(tags.at(3).getAttribute(NOTE), QVariant(QString("even")));
+}
+
+void tst_Model_Factory::has_CreatesChildModels() const
+{
+    // The position column is unique
+    const auto nextPosition = [position = std::make_shared<quint32>(1000)]
+                              (const TagPropertyFactory::Attributes &/*unused*/)
+                              -> TagPropertyFactory::Attributes
+    {
+        return {{"position", (*position)++}};
+    };
+
+    auto tags = TagFactory().count(3)
+                            .sequence(tagName)
+                            .has(TagPropertyFactory().count(2).state(nextPosition))
+                            .create();
+
+    QCOMPARE(tags.size(), static_cast<ModelsCollection<Tag>::size_type>(3));
+
+    for (const auto &tag : tags)
+        QCOMPARE(TagProperty::whereEq("tag_id", tag.getKey())->count(),
+                 static_cast<quint64>(2));
+}
+
+void tst_Model_Factory::batchSize_Zero_ThrowsException() const
+{
+    QVERIFY_EXCEPTION_THROWN(TagFactory().batchSize(0),
+                             Orm::Exceptions::InvalidArgumentError);
+}
+// NOLINTEND(readability-convert-member-functions-to-static)
+
+/* private */
+
+TagFactory::Attributes tst_Model_Factory::tagName(const std::size_t index)
+{
+    return {{NAME, QStringLiteral("factory tag %1").arg(index)}};
+}
+
+QTEST_MAIN(tst_Model_Factory)
+
+#include "tst_model_factory.moc"
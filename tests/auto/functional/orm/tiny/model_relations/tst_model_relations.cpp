@@ -1,9 +1,12 @@
 #include <QCoreApplication>
+#include <QScopeGuard>
 #include <QtTest>
 
 #include <typeinfo>
 
 #include "orm/db.hpp"
+#include "orm/support/repeatedqueriesreporter.hpp"
+#include "orm/tiny/exceptions/lazyloadingviolationerror.hpp"
 #include "orm/utils/query.hpp"
 
 #include "databases.hpp"
@@ -30,9 +33,11 @@ using Orm::Exceptions::RuntimeError;
 using Orm::One;
 using Orm::QtTimeZoneConfig;
 using Orm::QtTimeZoneType;
+using Orm::Support::RepeatedQueriesReporter;
 
 using Orm::Tiny::AttributeItem;
 using Orm::Tiny::ConnectionOverride;
+using Orm::Tiny::Exceptions::LazyLoadingViolationError;
 using Orm::Tiny::Exceptions::RelationMappingNotFoundError;
 using Orm::Tiny::Exceptions::RelationNotLoadedError;
 using Orm::Tiny::Relations::Pivot;
@@ -85,6 +90,9 @@ private Q_SLOTS:
     getRelationValue_LazyLoad_BelongsToMany_BasicPivot_WithoutPivotAttributes() const;
     void getRelationValue_LazyLoad_Failed() const;
 
+    void preventLazyLoading_ModelsCollection_Failed() const;
+    void preventLazyLoading_ViolationCallback_RepeatedQueries() const;
+
     void u_with_Empty() const;
     void with_HasOne() const;
     void with_HasMany() const;
@@ -665,6 +673,83 @@ void tst_Model_Relations::getRelationValue_LazyLoad_Failed() const
              ModelsCollection<Tag *>());
 }
 
+void tst_Model_Relations::preventLazyLoading_ModelsCollection_Failed() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    Torrent::preventLazyLoading();
+
+    // Restore also if any of the QVERIFY() below fails
+    const auto restore = qScopeGuard([]
+    {
+        Torrent::preventLazyLoading(false);
+    });
+
+    auto torrents = Torrent::all();
+    QVERIFY(torrents.size() > 1);
+
+    auto violated = false;
+    try {
+        torrents.first().getRelationValue<TorrentPeer, One>("torrentPeer");
+    } catch (const LazyLoadingViolationError &) {
+        violated = true;
+    }
+
+    // A single model can't cause the N+1 problem
+    auto torrent = Torrent::find(2);
+    QVERIFY(torrent);
+
+    auto *peer = torrent->getRelationValue<TorrentPeer, One>("torrentPeer");
+
+    QVERIFY(violated);
+    QVERIFY(peer);
+    QVERIFY(peer->exists);
+}
+
+void
+tst_Model_Relations::preventLazyLoading_ViolationCallback_RepeatedQueries() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    QStringList violations;
+
+    Torrent::preventLazyLoading();
+    Torrent::handleLazyLoadingViolationUsing([&violations](const QString &model,
+                                                           const QString &relation)
+    {
+        violations << QStringLiteral("%1::%2").arg(model, relation);
+    });
+
+    // Restore also if any of the QCOMPARE() below fails
+    const auto restore = qScopeGuard([]
+    {
+        Torrent::handleLazyLoadingViolationUsing(nullptr);
+        Torrent::preventLazyLoading(false);
+    });
+
+    RepeatedQueriesReporter reporter(connection);
+
+    auto torrents = Torrent::all();
+
+    // The callback only reports the violation, relations are still lazy loaded
+    for (auto &torrent : torrents)
+        torrent.getRelationValue<TorrentPeer, One>("torrentPeer");
+
+    QCOMPARE(violations.size(), torrents.size());
+    QVERIFY(violations.contains("Torrent::torrentPeer"));
+
+    QVERIFY(reporter.hasRepeatedQueries());
+
+    const auto repeatedQueries = reporter.repeatedQueries();
+    QCOMPARE(repeatedQueries.size(), 1);
+    QCOMPARE(repeatedQueries.first().count, static_cast<qint64>(torrents.size()));
+    QCOMPARE(repeatedQueries.first().connection, connection);
+}
+
 void tst_Model_Relations::u_with_Empty() const
 {
     QFETCH_GLOBAL(QString, connection);
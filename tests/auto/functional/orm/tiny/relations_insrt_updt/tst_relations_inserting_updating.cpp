@@ -24,6 +24,7 @@ using Orm::One;
 using Orm::Tiny::AttributeItem;
 using Orm::Tiny::ConnectionOverride;
 using Orm::Tiny::Types::ModelsCollection;
+using Orm::Utils::Helpers;
 
 using TypeUtils = Orm::Utils::Type;
 
@@ -111,6 +112,10 @@ private Q_SLOTS:
     void syncWithoutDetaching_BasicPivot_IdsWithAttributes() const;
     void syncWithoutDetaching_CustomPivot_WithIds() const;
     void syncWithoutDetaching_CustomPivot_IdsWithAttributes() const;
+
+    void syncBulk_BasicPivot_WithIds() const;
+    void toggle_BasicPivot_WithIds() const;
+    void updateExistingPivot_BasicPivot_WithIds() const;
 };
 
 /* private slots */
@@ -3299,6 +3304,155 @@ void tst_Relations_Inserting_Updating::
     tag102.remove();
     tag103.remove();
 }
+
+void tst_Relations_Inserting_Updating::syncBulk_BasicPivot_WithIds() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent100 {
+        {NAME, "test100"}, {SIZE_, 100}, {Progress, 555},
+        {HASH_, "xyzhash100"}, {NOTE, "sync bulk with pivot"},
+    };
+    torrent100.save();
+    Torrent torrent101 {
+        {NAME, "test101"}, {SIZE_, 101}, {Progress, 556},
+        {HASH_, "xyzhash101"}, {NOTE, "sync bulk with pivot"},
+    };
+    torrent101.save();
+    Torrent torrent102 {
+        {NAME, "test102"}, {SIZE_, 102}, {Progress, 557},
+        {HASH_, "xyzhash102"}, {NOTE, "sync bulk with pivot"},
+    };
+    torrent102.save();
+
+    auto tag5 = Tag::find(5);
+    QVERIFY(tag5);
+    QVERIFY(tag5->exists);
+
+    const auto tagId = (*tag5)[ID];
+
+    tag5->torrents()->attach({{torrent101}, {torrent102}}, {}, false);
+
+    // Duplicate IDs are allowed
+    const auto changed =
+            tag5->torrents()->syncBulk({*torrent100[ID], *torrent101[ID],
+                                        *torrent100[ID]});
+
+    // Verify result
+    QCOMPARE(changed.attached(), QVector<QVariant> {torrent100[ID]});
+    QCOMPARE(changed.detached(), QVector<QVariant> {torrent102[ID]});
+    QVERIFY(changed.updated().isEmpty());
+
+    // IDs are cast to the related model's key type, the same as the sync() returns
+    QCOMPARE(Helpers::qVariantTypeId(changed.attached().constFirst()),
+             QMetaType::ULongLong);
+    QCOMPARE(Helpers::qVariantTypeId(changed.detached().constFirst()),
+             QMetaType::ULongLong);
+
+    // Verify tagged values in the database
+    auto torrentIds = Tagged::whereEq("tag_id", tagId)
+                      ->whereIn("torrent_id", {torrent100[ID], torrent101[ID],
+                                               torrent102[ID]})
+                      .orderBy("torrent_id")
+                      .pluck("torrent_id");
+
+    QCOMPARE(torrentIds, (QVector<QVariant> {torrent100[ID], torrent101[ID]}));
+
+    // Nothing to change
+    const auto unchanged =
+            tag5->torrents()->syncBulkWithoutDetaching({*torrent101[ID]});
+
+    QVERIFY(unchanged.attached().isEmpty());
+    QVERIFY(unchanged.detached().isEmpty());
+
+    torrent100.remove();
+    torrent101.remove();
+    torrent102.remove();
+}
+
+void tst_Relations_Inserting_Updating::toggle_BasicPivot_WithIds() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    Torrent torrent100 {
+        {NAME, "test100"}, {SIZE_, 100}, {Progress, 555},
+        {HASH_, "xyzhash100"}, {NOTE, "toggle with pivot"},
+    };
+    torrent100.save();
+    Torrent torrent101 {
+        {NAME, "test101"}, {SIZE_, 101}, {Progress, 556},
+        {HASH_, "xyzhash101"}, {NOTE, "toggle with pivot"},
+    };
+    torrent101.save();
+
+    auto tag5 = Tag::find(5);
+    QVERIFY(tag5);
+    QVERIFY(tag5->exists);
+
+    const auto tagId = (*tag5)[ID];
+
+    tag5->torrents()->attach({{torrent101}}, {}, false);
+
+    const auto changed =
+            tag5->torrents()->toggle({*torrent100[ID], *torrent101[ID]});
+
+    // Verify result
+    QCOMPARE(changed.attached(), QVector<QVariant> {torrent100[ID]});
+    QCOMPARE(changed.detached(), QVector<QVariant> {torrent101[ID]});
+
+    // Verify tagged values in the database
+    const auto torrentIds = Tagged::whereEq("tag_id", tagId)
+                            ->whereIn("torrent_id", {torrent100[ID], torrent101[ID]})
+                            .pluck("torrent_id");
+
+    QCOMPARE(torrentIds, QVector<QVariant> {torrent100[ID]});
+
+    torrent100.remove();
+    torrent101.remove();
+}
+
+void tst_Relations_Inserting_Updating::updateExistingPivot_BasicPivot_WithIds() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto tag = Tag::find(2);
+    QVERIFY(tag);
+    QVERIFY(tag->exists);
+
+    const auto tagId = (*tag)[ID];
+
+    // Check values before update
+    auto taggeds = Tagged::whereEq("tag_id", tagId)
+                   ->whereIn("torrent_id", {2, 3})
+                   .get();
+
+    QCOMPARE(taggeds.size(), 2);
+    for (auto &tagged : taggeds)
+        QCOMPARE(tagged["active"].value(), QVariant(true));
+
+    auto updated = tag->torrents()->updateExistingPivot(QVector<QVariant> {2, 3},
+                                                        {{"active", false}}, false);
+    QCOMPARE(updated, 2);
+
+    // Check values after update
+    taggeds = Tagged::whereEq("tag_id", tagId)
+              ->whereIn("torrent_id", {2, 3})
+              .get();
+
+    QCOMPARE(taggeds.size(), 2);
+    for (auto &tagged : taggeds)
+        QCOMPARE(tagged["active"].value(), QVariant(false));
+
+    // Restore db
+    tag->torrents()->updateExistingPivot(QVector<QVariant> {2, 3},
+                                         {{"active", true}}, false);
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 QTEST_MAIN(tst_Relations_Inserting_Updating)
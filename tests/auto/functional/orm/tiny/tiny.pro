@@ -7,6 +7,7 @@ SUBDIRS = \
     model \
     model_appends \
     model_conn_indep \
+    model_factory \
     model_hidesattributes \
     model_qdatetime \
     model_relations \
@@ -31,6 +31,12 @@ private Q_SLOTS:
 
     void get() const;
     void get_Columns() const;
+    void getAsync() const;
+
+    void unionAll_HydratesModels() const;
+    void unionAll_Count() const;
+
+    void withRecursiveExpression_HydratesModels() const;
 
     void value() const;
     void value_ModelNotFound() const;
@@ -108,6 +114,85 @@ void tst_TinyBuilder::get_Columns() const
     QCOMPARE(torrent.getAttributes().at(2).key, QString(SIZE_));
 }
 
+void tst_TinyBuilder::getAsync() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    auto future = createQuery<Torrent>()->whereIn(ID, {2, 3}).orderBy(ID)
+                  .getAsync({ID, NAME});
+
+    const auto torrents = future.result();
+
+    QCOMPARE(torrents.size(), 2);
+    QCOMPARE(torrents.at(0).getAttribute(ID), QVariant(2));
+    QCOMPARE(torrents.at(0).getAttribute(NAME), QVariant("test2"));
+    QCOMPARE(torrents.at(1).getAttribute(ID), QVariant(3));
+    QCOMPARE(torrents.at(1).getAttribute(NAME), QVariant("test3"));
+    QVERIFY(torrents.at(0).exists);
+}
+
+void tst_TinyBuilder::unionAll_HydratesModels() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    // The orderBy() after the unionAll() orders the whole union query
+    auto torrents = createQuery<Torrent>()->whereEq(ID, 3)
+                    .unionAll(createQuery<Torrent>()->whereEq(ID, 2))
+                    .orderBy(ID)
+                    .get();
+
+    QCOMPARE(torrents.size(), 2);
+    QCOMPARE(torrents.at(0).getAttribute(ID), QVariant(2));
+    QCOMPARE(torrents.at(0).getAttribute(NAME), QVariant("test2"));
+    QCOMPARE(torrents.at(1).getAttribute(ID), QVariant(3));
+    QCOMPARE(torrents.at(1).getAttribute(NAME), QVariant("test3"));
+    QVERIFY(torrents.at(0).exists);
+}
+
+void tst_TinyBuilder::unionAll_Count() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    // The aggregate is computed over the whole union query
+    const auto count = createQuery<Torrent>()->whereIn(ID, {2, 3})
+                       .unionAll(createQuery<Torrent>()->whereEq(ID, 2))
+                       .count();
+
+    QCOMPARE(count, static_cast<quint64>(3));
+}
+
+void tst_TinyBuilder::withRecursiveExpression_HydratesModels() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    ConnectionOverride::connection = connection;
+
+    // The recursive CTE generates the torrent IDs 1-3
+    auto torrents = createQuery<Torrent>()->withRecursiveExpression(
+                        "torrent_ids",
+                        "select 1 union all "
+                        "select torrent_id + 1 from torrent_ids where torrent_id < 3",
+                        {"torrent_id"})
+                    .whereRaw("id in (select torrent_id from torrent_ids)")
+                    .orderBy(ID)
+                    .get();
+
+    QCOMPARE(torrents.size(), 3);
+    QCOMPARE(torrents.at(0).getAttribute(ID), QVariant(1));
+    QCOMPARE(torrents.at(0).getAttribute(NAME), QVariant("test1"));
+    QCOMPARE(torrents.at(1).getAttribute(ID), QVariant(2));
+    QCOMPARE(torrents.at(1).getAttribute(NAME), QVariant("test2"));
+    QCOMPARE(torrents.at(2).getAttribute(ID), QVariant(3));
+    QCOMPARE(torrents.at(2).getAttribute(NAME), QVariant("test3"));
+    QVERIFY(torrents.at(0).exists);
+}
+
 void tst_TinyBuilder::value() const
 {
     QFETCH_GLOBAL(QString, connection);
@@ -1,6 +1,7 @@
 #include <QCoreApplication>
 #include <QtTest>
 
+#include "orm/constants.hpp"
 #include "orm/utils/type.hpp"
 
 #include "tom/application.hpp"
@@ -13,6 +14,8 @@
 #include "migrations/2014_10_12_200000_create_properties_table.hpp"
 #include "migrations/2014_10_12_300000_create_phones_table.hpp"
 
+using Orm::Constants::QSQLITE;
+
 using Orm::Exceptions::RuntimeError;
 
 using TypeUtils = Orm::Utils::Type;
@@ -27,6 +30,7 @@ using Tom::Constants::MigrateReset;
 using Tom::Constants::MigrateRollback;
 using Tom::Constants::MigrateStatus;
 using Tom::Constants::MigrateUninstall;
+using Tom::Constants::SchemaDump;
 
 using TestUtils::Databases;
 
@@ -49,6 +53,10 @@ private Q_SLOTS:
 
     void migrate() const;
     void migrate_Step() const;
+    void migrate_Report() const;
+    void migrate_Pretend_SqlPath() const;
+
+    void schemaDump_Load_SQLite() const;
 
     void reset() const;
 
@@ -274,6 +282,173 @@ void tst_Migrate::migrate_Step() const
     }
 }
 
+void tst_Migrate::migrate_Report() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const auto reportPath = tempDir.filePath(QStringLiteral("report.json"));
+    const auto reportOption = QStringLiteral("--report=%1").arg(reportPath).toUtf8();
+
+    {
+        auto exitCode = invokeCommand(connection, Migrate, {reportOption.constData()});
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+    }
+
+    QFile reportFile(reportPath);
+    QVERIFY(reportFile.open(QIODevice::ReadOnly));
+
+    const auto report = QJsonDocument::fromJson(reportFile.readAll()).object();
+
+    QCOMPARE(report.value("command").toString(), Migrate);
+    QVERIFY(!report.value("pretend").toBool());
+    QVERIFY(!report.value("failed").toBool());
+
+    const auto migrations = report.value("migrations").toArray();
+    QCOMPARE(migrations.size(), 4);
+
+    const auto migration = migrations.first().toObject();
+    QCOMPARE(migration.value("migration").toString(),
+             QString(s_2014_10_12_000000_create_posts_table));
+    QCOMPARE(migration.value("method").toString(), QStringLiteral("up"));
+    QCOMPARE(migration.value("connection").toString(), connection);
+    QVERIFY(migration.value("elapsed").toDouble() >= 0);
+
+    const auto queries = migration.value("queries").toArray();
+    QVERIFY(!queries.isEmpty());
+    QVERIFY(queries.first().toObject().value("elapsed").toDouble() >= 0);
+
+    {
+        auto exitCode = invokeTestStatusCommand(connection);
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+        QCOMPARE(status(), createStatus(FullyMigrated));
+    }
+}
+
+void tst_Migrate::migrate_Pretend_SqlPath() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const auto sqlPath = tempDir.filePath(QStringLiteral("migrate.sql"));
+    const auto sqlOption = QStringLiteral("--sql-path=%1").arg(sqlPath).toUtf8();
+
+    {
+        auto exitCode = invokeCommand(connection, Migrate,
+                                      {"--pretend", sqlOption.constData()});
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+    }
+
+    QFile sqlFile(sqlPath);
+    QVERIFY(sqlFile.open(QIODevice::ReadOnly | QIODevice::Text));
+
+    const auto sql = QString::fromUtf8(sqlFile.readAll());
+
+    // Migrations are in the migrate order
+    const auto postsIndex = sql.indexOf(
+                                QStringLiteral("-- %1 (up")
+                                .arg(s_2014_10_12_000000_create_posts_table));
+    const auto phonesIndex = sql.indexOf(
+                                 QStringLiteral("-- %1 (up")
+                                 .arg(s_2014_10_12_300000_create_phones_table));
+
+    QVERIFY(postsIndex > -1);
+    QVERIFY(phonesIndex > postsIndex);
+    QVERIFY(sql.contains(QStringLiteral("create table"), Qt::CaseInsensitive));
+
+    // Nothing was migrated
+    {
+        auto exitCode = invokeTestStatusCommand(connection);
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+        QCOMPARE(status(), createResetStatus());
+    }
+}
+
+void tst_Migrate::schemaDump_Load_SQLite() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    if (Databases::manager().connection(connection).driverName() != QSQLITE)
+        QSKIP("The schema dump is tested using the SQLite database only.", );
+
+    if (QStandardPaths::findExecutable(QStringLiteral("sqlite3")).isEmpty())
+        QSKIP("The sqlite3 command-line client is not on the system path.", );
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const auto schemaPath = tempDir.filePath(QStringLiteral("sqlite-schema.sql"));
+
+    {
+        auto exitCode = invokeCommand(connection, Migrate);
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+    }
+
+    // Dump the schema and the migrations table content
+    {
+        const auto pathOption = QStringLiteral("--path=%1").arg(schemaPath).toUtf8();
+
+        auto exitCode = invokeCommand(connection, SchemaDump, {pathOption.constData()});
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+    }
+
+    QFile schemaFile(schemaPath);
+    QVERIFY(schemaFile.open(QIODevice::ReadOnly | QIODevice::Text));
+
+    const auto schema = QString::fromUtf8(schemaFile.readAll());
+    schemaFile.close();
+
+    QVERIFY(schema.contains(QStringLiteral("\"posts\"")));
+    QVERIFY(schema.contains(QStringLiteral("\"phones\"")));
+    QVERIFY(!schema.contains(QStringLiteral("sqlite_sequence")));
+    QVERIFY(schema.contains(QStringLiteral("insert into \"%1\"")
+                            .arg(MigrationsTable)));
+    QVERIFY(schema.contains(s_2014_10_12_300000_create_phones_table));
+
+    // Drop all tables, the migrations table stays empty
+    {
+        auto exitCode = invokeCommand(connection, MigrateReset);
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+    }
+
+    const auto &schemaBuilder = Databases::manager().connection(connection)
+                                .getSchemaBuilder();
+
+    QVERIFY(!schemaBuilder.hasTable(QStringLiteral("posts")));
+
+    // Load the schema dump, all migrations are a part of it so nothing is migrated
+    {
+        const auto schemaPathOption = QStringLiteral("--schema-path=%1")
+                                      .arg(schemaPath).toUtf8();
+
+        auto exitCode = invokeCommand(connection, Migrate,
+                                      {schemaPathOption.constData()});
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+    }
+
+    QVERIFY(schemaBuilder.hasTable(QStringLiteral("posts")));
+    QVERIFY(schemaBuilder.hasTable(QStringLiteral("phones")));
+
+    {
+        auto exitCode = invokeTestStatusCommand(connection);
+
+        QVERIFY(exitCode == EXIT_SUCCESS);
+        QCOMPARE(status(), createStatus(FullyMigrated));
+    }
+}
+
 void tst_Migrate::reset() const
 {
     QFETCH_GLOBAL(QString, connection);
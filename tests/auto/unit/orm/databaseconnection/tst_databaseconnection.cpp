@@ -5,6 +5,7 @@
 #include "orm/db.hpp"
 #include "orm/exceptions/multiplecolumnsselectederror.hpp"
 #include "orm/mysqlconnection.hpp"
+#include "orm/support/querycache.hpp"
 #include "orm/utils/type.hpp"
 
 #include "databases.hpp"
@@ -20,11 +21,16 @@ using Orm::Constants::UTC;
 using Orm::Constants::qt_timezone;
 using Orm::Constants::timezone_;
 
+using Orm::Concerns::CapturesSlowQueries;
+using Orm::ConnectionEvent;
 using Orm::DB;
 using Orm::Exceptions::MultipleColumnsSelectedError;
 using Orm::MySqlConnection;
 using Orm::QtTimeZoneConfig;
 using Orm::QtTimeZoneType;
+using Orm::QueryExecutedEvent;
+using Orm::SlowQuery;
+using Orm::Support::QueryCache;
 
 using QueryBuilder = Orm::Query::Builder;
 using TypeUtils = Orm::Utils::Type;
@@ -60,6 +66,15 @@ private Q_SLOTS:
     void scalar_EmptyResult() const;
     void scalar_MultipleColumnsSelectedError() const;
 
+    void remember_CacheHit_And_Invalidation() const;
+    void remember_FlushedOnRollBack_KeptOnCommit() const;
+
+    void listen_QueryExecutedEvent() const;
+    void listenForConnectionEvents_Transaction() const;
+
+    void captureSlowQueries_ZeroThreshold() const;
+    void explainSlowQueries_InTransaction() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Create QueryBuilder instance for the given connection. */
@@ -873,6 +888,208 @@ void tst_DatabaseConnection::scalar_MultipleColumnsSelectedError() const
                                  "select id, name from torrents order by id"),
                              MultipleColumnsSelectedError);
 }
+
+void tst_DatabaseConnection::remember_CacheHit_And_Invalidation() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &db = DB::connection(connection);
+
+    // Start with an empty cache
+    db.setQueryCache(std::make_shared<QueryCache>());
+
+    const auto &cache = db.getQueryCache();
+
+    for (auto i = 0; i < 2; ++i) {
+        auto query = createQuery(connection)->from("torrents").whereEq(ID, 1)
+                     .remember(60).get({ID, NAME});
+
+        QVERIFY(query.first());
+        QCOMPARE(query.value(ID), QVariant(1));
+        QCOMPARE(query.value(NAME), QVariant(QString("test1")));
+        QVERIFY(!query.next());
+    }
+
+    QCOMPARE(cache.stats().misses, 1ULL);
+    QCOMPARE(cache.stats().hits, 1ULL);
+    QCOMPARE(cache.stats().entries, 1LL);
+
+    // Writing to another table doesn't invalidate the cached result
+    db.statement("update tag_properties set color = color where id = ?", {0});
+
+    QCOMPARE(cache.stats().entries, 1LL);
+
+    // Writing to the table the query reads invalidates the cached result
+    db.statement("update torrents set name = name where id = ?", {0});
+
+    QCOMPARE(cache.stats().entries, 0LL);
+    QCOMPARE(cache.stats().invalidations, 1ULL);
+}
+
+void tst_DatabaseConnection::remember_FlushedOnRollBack_KeptOnCommit() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &db = DB::connection(connection);
+
+    // Start with an empty cache
+    db.setQueryCache(std::make_shared<QueryCache>());
+
+    const auto &cache = db.getQueryCache();
+
+    // The committed transaction keeps the results cached inside it
+    db.beginTransaction();
+    {
+        auto query = createQuery(connection)->from("torrents").whereEq(ID, 1)
+                     .remember(60).get({ID, NAME});
+        QVERIFY(query.first());
+    }
+    db.commit();
+
+    QCOMPARE(cache.stats().entries, 1LL);
+
+    // The rolled back transaction flushes the cache as it could read reverted data
+    db.beginTransaction();
+    db.rollBack();
+
+    QCOMPARE(cache.stats().entries, 0LL);
+}
+
+void tst_DatabaseConnection::listen_QueryExecutedEvent() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    QStringList queries;
+    QVector<QVariant> bindings;
+    QStringList connectionNames;
+    qint64 elapsed = -1;
+
+    DB::listen([&](const QueryExecutedEvent &event)
+    {
+        queries << event.query;
+        bindings = event.bindings;
+        connectionNames << event.connectionName;
+        elapsed = event.elapsed;
+    },
+        connection);
+
+    auto query = DB::select("select id from torrents where id = ?", {1}, connection);
+
+    DB::forgetListeners(connection);
+
+    QVERIFY(query.first());
+    QCOMPARE(queries, QStringList {"select id from torrents where id = ?"});
+    QCOMPARE(bindings, QVector<QVariant> {1});
+    QCOMPARE(connectionNames, QStringList {connection});
+    QVERIFY(elapsed >= 0);
+
+    // Nothing is dispatched after the listeners were removed
+    DB::select("select id from torrents where id = ?", {1}, connection);
+
+    QCOMPARE(queries.size(), 1);
+}
+
+void tst_DatabaseConnection::listenForConnectionEvents_Transaction() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    QVector<ConnectionEvent::Type> events;
+
+    DB::listenForConnectionEvents([&events](const ConnectionEvent &event)
+    {
+        events << event.type;
+    },
+        connection);
+
+    DB::beginTransaction(connection);
+    DB::rollBack(connection);
+    DB::beginTransaction(connection);
+    DB::commit(connection);
+
+    DB::forgetListeners(connection);
+
+    QCOMPARE(events,
+             (QVector<ConnectionEvent::Type> {
+                 ConnectionEvent::Type::TRANSACTION_BEGINNING,
+                 ConnectionEvent::Type::TRANSACTION_ROLLED_BACK,
+                 ConnectionEvent::Type::TRANSACTION_BEGINNING,
+                 ConnectionEvent::Type::TRANSACTION_COMMITTED,
+             }));
+}
+
+void tst_DatabaseConnection::captureSlowQueries_ZeroThreshold() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &db = DB::connection(connection);
+
+    QStringList captured;
+
+    // The 0 threshold captures all queries
+    db.setSlowQueryThreshold(0)
+      .setSlowQueriesLimit(2)
+      .onSlowQuery([&captured](const SlowQuery &slowQuery)
+    {
+        captured << slowQuery.query;
+    });
+
+    db.select("select id from torrents where id = ?", {1});
+    db.select("select id from torrents where id = ?", {2});
+    db.select("select name from torrents where id = ?", {3});
+
+    auto slowQueries = db.setSlowQueryThreshold(-1)
+                         .onSlowQuery(nullptr)
+                         .takeSlowQueries();
+
+    QCOMPARE(captured.size(), 3);
+
+    // The bounded buffer drops the oldest slow queries
+    QCOMPARE(slowQueries.size(), static_cast<std::size_t>(2));
+
+    const auto &slowQuery = slowQueries.back();
+    QCOMPARE(slowQuery.query, QString("select name from torrents where id = ?"));
+    QCOMPARE(slowQuery.bindings, QVector<QVariant> {3});
+    QCOMPARE(slowQuery.connectionName, connection);
+    QVERIFY(slowQuery.elapsed > 0);
+    QVERIFY(slowQuery.plan.isEmpty());
+
+    QVERIFY(db.getSlowQueries().empty());
+
+    db.setSlowQueriesLimit(CapturesSlowQueries::DefaultSlowQueriesLimit);
+}
+
+void tst_DatabaseConnection::explainSlowQueries_InTransaction() const
+{
+    QFETCH_GLOBAL(QString, connection);
+
+    auto &db = DB::connection(connection);
+
+    db.setSlowQueryThreshold(0)
+      .explainSlowQueries(true);
+
+    db.beginTransaction();
+
+    db.select("select id from torrents where id = ?", {1});
+
+    // The EXPLAIN inside the savepoint must keep the transaction usable
+    QVERIFY(db.inTransaction());
+    QCOMPARE(db.scalar("select count(*) from torrents where id = ?", {1})
+             .value<int>(),
+             1);
+
+    db.rollBack();
+
+    auto slowQueries = db.setSlowQueryThreshold(-1)
+                         .explainSlowQueries(false)
+                         .takeSlowQueries();
+
+    QCOMPARE(slowQueries.size(), static_cast<std::size_t>(2));
+    QVERIFY(!slowQueries.front().plan.isEmpty());
+
+    // The side connection isn't used in the transaction
+    QVERIFY(!DB::connectionNames().contains(QStringLiteral("%1-explain")
+                                            .arg(connection)));
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
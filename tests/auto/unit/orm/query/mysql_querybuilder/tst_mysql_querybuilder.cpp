@@ -3,6 +3,7 @@
 
 #include "orm/db.hpp"
 #include "orm/exceptions/invalidargumenterror.hpp"
+#include "orm/exceptions/runtimeerror.hpp"
 #include "orm/mysqlconnection.hpp"
 #include "orm/utils/type.hpp"
 
@@ -25,8 +26,10 @@ using Orm::Constants::OR;
 using Orm::Constants::Progress;
 using Orm::Constants::SIZE_;
 
+using Orm::BindingType;
 using Orm::DB;
 using Orm::Exceptions::InvalidArgumentError;
+using Orm::Exceptions::RuntimeError;
 using Orm::MySqlConnection;
 using Orm::Query::Builder;
 using Orm::Query::Expression;
@@ -118,6 +121,7 @@ private Q_SLOTS:
     void from_TableWrappingQuotationMarks() const;
     void from_WithPrefix() const;
     void from_AliasWithPrefix() const;
+    void from_PrefixChanged_InvalidatesWrapCache() const;
 
     void fromRaw() const;
     void fromRaw_WithWhere() const;
@@ -127,11 +131,20 @@ private Q_SLOTS:
     void fromSub_QueryBuilderOverload_WithWhere() const;
     void fromSub_CallbackOverload() const;
 
+    void withExpression_QueryBuilder_BindingsOrder() const;
+    void withExpression_CallbackOverload_Columns() const;
+    void withRecursiveExpression_QStringOverload() const;
+
+    void union_QueryBuilder_BindingsOrder() const;
+    void unionAll_Callback_OrdersLimitOffset() const;
+
     void joinSub_QStringOverload() const;
     void joinSub_QueryBuilderOverload_WithWhere() const;
     void joinSub_CallbackOverload() const;
 
     void where() const;
+    void where_OperatorCaseInsensitive() const;
+    void where_InvalidOperator_ThrowException() const;
     void where_WithVectorValue() const;
     void where_WithVectorValue_DefaultCondition() const;
     void where_QueryableValue() const;
@@ -235,12 +248,19 @@ private Q_SLOTS:
     void remove() const;
     void remove_WithExpression() const;
 
+    void timeout_UpdateDelete_ThrowException() const;
+    void timeout_UpdateDelete_Maria() const;
+
     /* Builds Queries */
     void tap() const;
 
     void sole() const;
     void soleValue() const;
 
+    void getBindings_OrderedByType() const;
+    void getBindings_ImplicitlyShared() const;
+    void reorder_ClearsOrderBindingsOnly() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Create QueryBuilder instance for the given connection. */
@@ -1122,6 +1142,28 @@ void tst_MySql_QueryBuilder::from_AliasWithPrefix() const
     builder->getConnection().setTablePrefix("");
 }
 
+void tst_MySql_QueryBuilder::from_PrefixChanged_InvalidatesWrapCache() const
+{
+    auto builder = createQuery();
+
+    builder->from("table", "alias");
+
+    // Fill the wrap cache
+    QCOMPARE(builder->toSql(),
+             "select * from `table` as `alias`");
+
+    builder->getConnection().setTablePrefix(QStringLiteral("xyz_"));
+
+    QCOMPARE(builder->toSql(),
+             "select * from `xyz_table` as `xyz_alias`");
+
+    // Restore
+    builder->getConnection().setTablePrefix("");
+
+    QCOMPARE(builder->toSql(),
+             "select * from `table` as `alias`");
+}
+
 void tst_MySql_QueryBuilder::fromRaw() const
 {
     auto builder = createQuery();
@@ -1234,6 +1276,113 @@ void tst_MySql_QueryBuilder::fromSub_CallbackOverload() const
              QVector<QVariant>({QVariant(5), QVariant("xyz")}));
 }
 
+void tst_MySql_QueryBuilder::withExpression_QueryBuilder_BindingsOrder() const
+{
+    auto builder = createQuery();
+
+    // Ownership of the std::shared_ptr<QueryBuilder>
+    auto subQuery = createQuery();
+    subQuery->from("user_sessions")
+            .select({ID, NAME})
+            .where(ID, "<", 5);
+
+    // The with clause bindings go first even if the expression is added later
+    builder->from("sessions")
+            .whereEq(NAME, "xyz")
+            .withExpression("sessions", *subQuery);
+
+    QCOMPARE(builder->toSql(),
+             "with `sessions` as (select `id`, `name` from `user_sessions` "
+             "where `id` < ?) "
+             "select * from `sessions` where `name` = ?");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(5), QVariant("xyz")}));
+}
+
+void tst_MySql_QueryBuilder::withExpression_CallbackOverload_Columns() const
+{
+    auto builder = createQuery();
+
+    builder->withExpression("a", [](auto &query)
+    {
+        query.from("torrents").select({ID, NAME}).whereEq(ID, 1);
+    }, {"a_id", "a_name"})
+            .withExpression("b", "select 2")
+            .from("a")
+            .join("b", "a.a_id", "<", "b.id");
+
+    QCOMPARE(builder->toSql(),
+             "with `a` (`a_id`, `a_name`) as (select `id`, `name` "
+             "from `torrents` where `id` = ?), `b` as (select 2) "
+             "select * from `a` inner join `b` on `a`.`a_id` < `b`.`id`");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1)}));
+}
+
+void tst_MySql_QueryBuilder::withRecursiveExpression_QStringOverload() const
+{
+    auto builder = createQuery();
+
+    builder->withRecursiveExpression(
+                "numbers",
+                "select 1 union all select number + 1 from numbers where number < 5",
+                {"number"})
+            .from("numbers");
+
+    QCOMPARE(builder->toSql(),
+             "with recursive `numbers` (`number`) as (select 1 union all "
+             "select number + 1 from numbers where number < 5) "
+             "select * from `numbers`");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
+void tst_MySql_QueryBuilder::union_QueryBuilder_BindingsOrder() const
+{
+    auto builder = createQuery();
+
+    // Ownership of the std::shared_ptr<QueryBuilder>
+    auto unionQuery = createQuery();
+    unionQuery->from("torrents")
+            .select({ID, NAME})
+            .whereEq(ID, 2);
+
+    builder->from("torrents")
+            .select({ID, NAME})
+            .whereEq(ID, 1)
+            .union_(*unionQuery);
+
+    QCOMPARE(builder->toSql(),
+             "(select `id`, `name` from `torrents` where `id` = ?) "
+             "union (select `id`, `name` from `torrents` where `id` = ?)");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(2)}));
+}
+
+void tst_MySql_QueryBuilder::unionAll_Callback_OrdersLimitOffset() const
+{
+    auto builder = createQuery();
+
+    // The orders, limit, and offset after the union apply to the whole union query
+    builder->from("torrents")
+            .whereEq(ID, 1)
+            .unionAll([](auto &query)
+    {
+        query.from("torrents").whereEq(ID, 2);
+    })
+            .orderByRaw("case when id = ? then 0 else 1 end", {2})
+            .orderBy(NAME)
+            .limit(10)
+            .offset(5);
+
+    QCOMPARE(builder->toSql(),
+             "(select * from `torrents` where `id` = ?) "
+             "union all (select * from `torrents` where `id` = ?) "
+             "order by case when id = ? then 0 else 1 end, `name` asc "
+             "limit 10 offset 5");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(2), QVariant(2)}));
+}
+
 void tst_MySql_QueryBuilder::joinSub_QStringOverload() const
 {
     auto builder = createQuery();
@@ -1372,6 +1521,36 @@ void tst_MySql_QueryBuilder::where() const
     }
 }
 
+void tst_MySql_QueryBuilder::where_OperatorCaseInsensitive() const
+{
+    auto builder = createQuery();
+
+    builder->select("*").from("torrents")
+            .where(NAME, "LIKE", "test%")
+            .where(NOTE, "Not Like", "%xyz");
+
+    QCOMPARE(builder->toSql(),
+             "select * from `torrents` where `name` LIKE ? and `note` Not Like ?");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant("test%"), QVariant("%xyz")}));
+}
+
+void tst_MySql_QueryBuilder::where_InvalidOperator_ThrowException() const
+{
+#ifndef TINYORM_DEBUG
+    QSKIP("Operators are validated in the Debug build only.", );
+#endif
+
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->select("*").from("torrents")
+                .where(ID, "=>", 3),
+                InvalidArgumentError);
+    QVERIFY_EXCEPTION_THROWN(
+                createQuery()->select("*").from("torrents")
+                .where(NAME, "LIKES", "test%"),
+                InvalidArgumentError);
+}
+
 void tst_MySql_QueryBuilder::where_WithVectorValue() const
 {
     {
@@ -3623,6 +3802,52 @@ void tst_MySql_QueryBuilder::remove_WithExpression() const
     QVERIFY(firstLog.boundValues.isEmpty());
 }
 
+void tst_MySql_QueryBuilder::timeout_UpdateDelete_ThrowException() const
+{
+    // Need to be set before pretending
+    auto &mysqlConnection = dynamic_cast<MySqlConnection &>(DB::connection(m_connection));
+    mysqlConnection.setConfigVersion("8.0.32");
+
+    auto log = mysqlConnection.pretend([](auto &connection)
+    {
+        // The max_execution_time applies to the select statements only
+        QVERIFY_EXCEPTION_THROWN(
+                    connection.query()->from("torrents").timeout(100)
+                    .whereEq(ID, 1).update({{NAME, "xyz"}}),
+                    RuntimeError);
+        QVERIFY_EXCEPTION_THROWN(
+                    connection.query()->from("torrents").timeout(100)
+                    .remove(2222),
+                    RuntimeError);
+
+        // No timeout
+        connection.query()->from("torrents").timeout(0).remove(2222);
+    });
+
+    QCOMPARE(log.size(), 1);
+}
+
+void tst_MySql_QueryBuilder::timeout_UpdateDelete_Maria() const
+{
+    // Need to be set before pretending
+    auto &mysqlConnection = dynamic_cast<MySqlConnection &>(DB::connection(m_connection));
+    mysqlConnection.setConfigVersion("11.0.1-MariaDB");
+
+    auto log = mysqlConnection.pretend([](auto &connection)
+    {
+        // The max_statement_time applies to all statements
+        connection.query()->from("torrents").timeout(100)
+                .whereEq(ID, 1).update({{NAME, "xyz"}});
+        connection.query()->from("torrents").timeout(100).remove(2222);
+    });
+
+    QCOMPARE(log.size(), 2);
+    QCOMPARE(log.at(0).query,
+             "update `torrents` set `name` = ? where `id` = ?");
+    QCOMPARE(log.at(1).query,
+             "delete from `torrents` where `torrents`.`id` = ?");
+}
+
 /* Builds Queries */
 
 void tst_MySql_QueryBuilder::tap() const
@@ -3678,6 +3903,72 @@ void tst_MySql_QueryBuilder::soleValue() const
     QCOMPARE(firstLog.boundValues,
              QVector<QVariant>({QVariant(QString("dummy-NON_EXISTENT"))}));
 }
+
+void tst_MySql_QueryBuilder::getBindings_OrderedByType() const
+{
+    auto builder = createQuery();
+
+    // Bindings are flattened by the binding type, not by the order of calls
+    builder->selectRaw("`size` + ? as `size_plus`", {1}).from("torrents")
+            .orderByRaw("field(`id`, ?, ?)", {5, 4})
+            .having(SIZE_, GT, 10)
+            .whereEq(NAME, "test3")
+            .groupBy(SIZE_);
+
+    QCOMPARE(builder->toSql(),
+             "select `size` + ? as `size_plus` from `torrents` where `name` = ? "
+             "group by `size` having `size` > ? order by field(`id`, ?, ?)");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant("test3"), QVariant(10),
+                                QVariant(5), QVariant(4)}));
+}
+
+void tst_MySql_QueryBuilder::getBindings_ImplicitlyShared() const
+{
+    auto builder = createQuery();
+
+    // No bindings, nothing is allocated
+    QCOMPARE(builder->getRawBindings().flatten().capacity(), 0);
+
+    builder->select("*").from("torrents")
+            .whereIn(ID, {1, 2, 3})
+            .orderByRaw("field(`id`, ?, ?)", {3, 1});
+
+    /* Bindings are stored flattened, every getBindings() call returns the same
+       implicitly shared data, they aren't copied for every executed query. */
+    const auto bindings1 = builder->getBindings();
+    const auto bindings2 = builder->getBindings();
+
+    QVERIFY(bindings1.constData() == bindings2.constData());
+    QVERIFY(bindings1.constData() == builder->getRawBindings().flatten().constData());
+    QCOMPARE(bindings1,
+             QVector<QVariant>({QVariant(1), QVariant(2), QVariant(3),
+                                QVariant(3), QVariant(1)}));
+}
+
+void tst_MySql_QueryBuilder::reorder_ClearsOrderBindingsOnly() const
+{
+    auto builder = createQuery();
+
+    builder->select("*").from("torrents")
+            .orderByRaw("field(`id`, ?, ?)", {3, 1})
+            .whereEq(NAME, "test3")
+            .having(SIZE_, GT, 10);
+
+    const auto &bindings = builder->getRawBindings();
+
+    QCOMPARE(bindings.size(BindingType::WHERE), 1);
+    QCOMPARE(bindings.size(BindingType::HAVING), 1);
+    QCOMPARE(bindings.size(BindingType::ORDER), 2);
+
+    builder->reorder().whereEq(SIZE_, 5);
+
+    QCOMPARE(bindings.size(BindingType::ORDER), 0);
+    QCOMPARE(bindings.value(BindingType::WHERE),
+             QVector<QVariant>({QVariant("test3"), QVariant(5)}));
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant("test3"), QVariant(5), QVariant(10)}));
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
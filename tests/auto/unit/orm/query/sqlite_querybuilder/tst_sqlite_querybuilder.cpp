@@ -69,6 +69,13 @@ private Q_SLOTS:
     void fromSub_QueryBuilderOverload_WithWhere() const;
     void fromSub_CallbackOverload() const;
 
+    void withExpression_QueryBuilder_BindingsOrder() const;
+    void withExpression_CallbackOverload_Columns() const;
+    void withRecursiveExpression_QStringOverload() const;
+
+    void union_QueryBuilder_BindingsOrder() const;
+    void unionAll_Callback_OrdersLimitOffset() const;
+
     void joinSub_QStringOverload() const;
     void joinSub_QueryBuilderOverload_WithWhere() const;
     void joinSub_CallbackOverload() const;
@@ -694,6 +701,114 @@ void tst_SQLite_QueryBuilder::fromSub_CallbackOverload() const
              QVector<QVariant>({QVariant(5), QVariant("xyz")}));
 }
 
+void tst_SQLite_QueryBuilder::withExpression_QueryBuilder_BindingsOrder() const
+{
+    auto builder = createQuery();
+
+    // Ownership of the std::shared_ptr<QueryBuilder>
+    auto subQuery = createQuery();
+    subQuery->from("user_sessions")
+            .select({ID, NAME})
+            .where(ID, "<", 5);
+
+    // The with clause bindings go first even if the expression is added later
+    builder->from("sessions")
+            .whereEq(NAME, "xyz")
+            .withExpression("sessions", *subQuery);
+
+    QCOMPARE(builder->toSql(),
+             "with \"sessions\" as (select \"id\", \"name\" from \"user_sessions\" "
+             "where \"id\" < ?) "
+             "select * from \"sessions\" where \"name\" = ?");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(5), QVariant("xyz")}));
+}
+
+void tst_SQLite_QueryBuilder::withExpression_CallbackOverload_Columns() const
+{
+    auto builder = createQuery();
+
+    builder->withExpression("a", [](auto &query)
+    {
+        query.from("torrents").select({ID, NAME}).whereEq(ID, 1);
+    }, {"a_id", "a_name"})
+            .withExpression("b", "select 2")
+            .from("a")
+            .join("b", "a.a_id", "<", "b.id");
+
+    QCOMPARE(builder->toSql(),
+             "with \"a\" (\"a_id\", \"a_name\") as (select \"id\", \"name\" "
+             "from \"torrents\" where \"id\" = ?), \"b\" as (select 2) "
+             "select * from \"a\" inner join \"b\" on \"a\".\"a_id\" < \"b\".\"id\"");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1)}));
+}
+
+void tst_SQLite_QueryBuilder::withRecursiveExpression_QStringOverload() const
+{
+    auto builder = createQuery();
+
+    builder->withRecursiveExpression(
+                "numbers",
+                "select 1 union all select number + 1 from numbers where number < 5",
+                {"number"})
+            .from("numbers");
+
+    QCOMPARE(builder->toSql(),
+             "with recursive \"numbers\" (\"number\") as (select 1 union all "
+             "select number + 1 from numbers where number < 5) "
+             "select * from \"numbers\"");
+    QVERIFY(builder->getBindings().isEmpty());
+}
+
+void tst_SQLite_QueryBuilder::union_QueryBuilder_BindingsOrder() const
+{
+    auto builder = createQuery();
+
+    // Ownership of the std::shared_ptr<QueryBuilder>
+    auto unionQuery = createQuery();
+    unionQuery->from("torrents")
+            .select({ID, NAME})
+            .whereEq(ID, 2);
+
+    builder->from("torrents")
+            .select({ID, NAME})
+            .whereEq(ID, 1)
+            .union_(*unionQuery);
+
+    QCOMPARE(builder->toSql(),
+             "select * from (select \"id\", \"name\" from \"torrents\" where \"id\" = ?) "
+             "union select * from (select \"id\", \"name\" from \"torrents\" "
+             "where \"id\" = ?)");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(2)}));
+}
+
+void tst_SQLite_QueryBuilder::unionAll_Callback_OrdersLimitOffset() const
+{
+    auto builder = createQuery();
+
+    // The orders, limit, and offset after the union apply to the whole union query
+    builder->from("torrents")
+            .whereEq(ID, 1)
+            .unionAll([](auto &query)
+    {
+        query.from("torrents").whereEq(ID, 2);
+    })
+            .orderByRaw("case when id = ? then 0 else 1 end", {2})
+            .orderBy(NAME)
+            .limit(10)
+            .offset(5);
+
+    QCOMPARE(builder->toSql(),
+             "select * from (select * from \"torrents\" where \"id\" = ?) "
+             "union all select * from (select * from \"torrents\" where \"id\" = ?) "
+             "order by case when id = ? then 0 else 1 end, \"name\" asc "
+             "limit 10 offset 5");
+    QCOMPARE(builder->getBindings(),
+             QVector<QVariant>({QVariant(1), QVariant(2), QVariant(2)}));
+}
+
 void tst_SQLite_QueryBuilder::joinSub_QStringOverload() const
 {
     auto builder = createQuery();
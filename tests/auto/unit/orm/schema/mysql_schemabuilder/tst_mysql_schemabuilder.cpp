@@ -154,6 +154,9 @@ private Q_SLOTS:
     /* Indexes */
     void indexes_Fluent() const;
     void indexes_Blueprint() const;
+    void indexes_Online() const;
+    void indexes_Includes() const;
+    void indexes_Includes_Where_ThrowException() const;
 
     void add_PrimaryKey() const;
     void add_PrimaryKey_WithAlgorithm() const;
@@ -172,6 +175,11 @@ private Q_SLOTS:
 
     void dropForeign() const;
 
+    /* Partitioning */
+    void partitionByRange_CreateTable() const;
+    void partitions_ModifyTable() const;
+    void detachPartition_ThrowException() const;
+
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
     /*! Table or database name used in tests. */
@@ -2544,6 +2552,97 @@ void tst_MySql_SchemaBuilder::indexes_Blueprint() const
     QVERIFY(log8.boundValues.isEmpty());
 }
 
+void tst_MySql_SchemaBuilder::indexes_Online() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.unique({"name_u"}).online();
+            table.index({"name_i"}).online();
+            table.fullText({"name_f"}).online();
+            table.spatialIndex({"coordinates_s"}).online();
+
+            // Not online
+            table.index({"name_n"});
+        });
+
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.online();
+
+            table.dropUnique({"name_u"});
+            table.dropIndex({"name_i"});
+            table.dropFullText({"name_f"});
+            table.dropSpatialIndex({"coordinates_s"});
+
+            // MySQL validates foreign keys when they are added, no query
+            table.validateForeign({"user_id"});
+        });
+    });
+
+    QCOMPARE(log.size(), 9);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "alter table `firewalls` "
+             "add unique index `firewalls_name_u_unique`(`name_u`), "
+             "algorithm=inplace, lock=none");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "alter table `firewalls` add index `firewalls_name_i_index`(`name_i`), "
+             "algorithm=inplace, lock=none");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "alter table `firewalls` "
+             "add fulltext index `firewalls_name_f_fulltext`(`name_f`), "
+             "algorithm=inplace, lock=shared");
+    QVERIFY(log2.boundValues.isEmpty());
+
+    const auto &log3 = log.at(3);
+    QCOMPARE(log3.query,
+             "alter table `firewalls` "
+             "add spatial index `firewalls_coordinates_s_spatialindex`(`coordinates_s`), "
+             "algorithm=inplace, lock=shared");
+    QVERIFY(log3.boundValues.isEmpty());
+
+    const auto &log4 = log.at(4);
+    QCOMPARE(log4.query,
+             "alter table `firewalls` add index `firewalls_name_n_index`(`name_n`)");
+    QVERIFY(log4.boundValues.isEmpty());
+
+    const auto &log5 = log.at(5);
+    QCOMPARE(log5.query,
+             "alter table `firewalls` drop index `firewalls_name_u_unique`, "
+             "algorithm=inplace, lock=none");
+    QVERIFY(log5.boundValues.isEmpty());
+
+    const auto &log6 = log.at(6);
+    QCOMPARE(log6.query,
+             "alter table `firewalls` drop index `firewalls_name_i_index`, "
+             "algorithm=inplace, lock=none");
+    QVERIFY(log6.boundValues.isEmpty());
+
+    const auto &log7 = log.at(7);
+    QCOMPARE(log7.query,
+             "alter table `firewalls` drop index `firewalls_name_f_fulltext`, "
+             "algorithm=inplace, lock=none");
+    QVERIFY(log7.boundValues.isEmpty());
+
+    const auto &log8 = log.at(8);
+    QCOMPARE(log8.query,
+             "alter table `firewalls` "
+             "drop index `firewalls_coordinates_s_spatialindex`, "
+             "algorithm=inplace, lock=none");
+    QVERIFY(log8.boundValues.isEmpty());
+}
+
 void tst_MySql_SchemaBuilder::add_PrimaryKey() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
@@ -2584,6 +2683,49 @@ void tst_MySql_SchemaBuilder::add_PrimaryKey_WithAlgorithm() const
     QVERIFY(firstLog.boundValues.isEmpty());
 }
 
+void tst_MySql_SchemaBuilder::indexes_Includes() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.index({"name_i"}).includes({"name_c"});
+        });
+    });
+
+    QCOMPARE(log.size(), 1);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "alter table `firewalls` "
+             "add index `firewalls_name_i_index`(`name_i`, `name_c`)");
+    QVERIFY(log0.boundValues.isEmpty());
+}
+
+void tst_MySql_SchemaBuilder::indexes_Includes_Where_ThrowException() const
+{
+    // Verify
+    DB::connection(m_connection).pretend([](auto &connection)
+    {
+        QVERIFY_EXCEPTION_THROWN(
+                    Schema::on(connection.getName())
+                    .table(Firewalls, [](Blueprint &table)
+        {
+            table.unique({"name_u"}).includes({"name_c"});
+        }),
+                    LogicError);
+
+        QVERIFY_EXCEPTION_THROWN(
+                    Schema::on(connection.getName())
+                    .table(Firewalls, [](Blueprint &table)
+        {
+            table.index({"name_w"}).where("deleted_at is null");
+        }),
+                    LogicError);
+    });
+}
+
 void tst_MySql_SchemaBuilder::renameIndex() const
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
@@ -3192,6 +3334,95 @@ void tst_MySql_SchemaBuilder::dropForeign() const
              "alter table `firewalls` drop `role_id`");
     QVERIFY(log7.boundValues.isEmpty());
 }
+
+void tst_MySql_SchemaBuilder::partitionByRange_CreateTable() const
+{
+    auto &connection = DB::connection(m_connection);
+
+    auto log = connection.pretend([](auto &connection_)
+    {
+        Schema::on(connection_.getName())
+                .create(Firewalls, [](Blueprint &table)
+        {
+            table.bigInteger(ID);
+            table.date("created_at");
+
+            table.partitionByRange({"created_at"});
+
+            table.rangePartition("p2022", {}, QDate(2023, 1, 1));
+            table.rangePartition("pmax", {}, {});
+        });
+    });
+
+    QCOMPARE(log.size(), 1);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             QStringLiteral(
+                 "create table `firewalls` ("
+                 "`id` bigint not null, "
+                 "`created_at` date not null) "
+                 "default character set %1 collate '%2' "
+                 "engine = %3 "
+                 "partition by range columns(`created_at`) ("
+                 "partition `p2022` values less than ('2023-01-01'), "
+                 "partition `pmax` values less than (maxvalue))")
+             .arg(m_charset, m_collation,
+                  connection.getConfig(engine_).value<QString>()));
+    QVERIFY(log0.boundValues.isEmpty());
+}
+
+void tst_MySql_SchemaBuilder::partitions_ModifyTable() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.partitionByHash({ID}, 4);
+        });
+
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.listPartition("p_eu", {1, 2});
+            table.dropPartition("p2022");
+        });
+    });
+
+    QCOMPARE(log.size(), 3);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "alter table `firewalls` partition by key (`id`) partitions 4");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "alter table `firewalls` "
+             "add partition (partition `p_eu` values in (1, 2))");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "alter table `firewalls` drop partition `p2022`");
+    QVERIFY(log2.boundValues.isEmpty());
+}
+
+void tst_MySql_SchemaBuilder::detachPartition_ThrowException() const
+{
+    // Verify
+    DB::connection(m_connection).pretend([](auto &connection)
+    {
+        QVERIFY_EXCEPTION_THROWN(
+                    Schema::on(connection.getName())
+                    .table(Firewalls, [](Blueprint &table)
+        {
+            table.detachPartition("p2022");
+        }),
+                    LogicError);
+    });
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 /* private */
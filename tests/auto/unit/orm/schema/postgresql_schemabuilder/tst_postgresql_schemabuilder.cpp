@@ -162,6 +162,10 @@ private Q_SLOTS:
     /* Indexes */
     void indexes_Fluent() const;
     void indexes_Blueprint() const;
+    void indexes_Online() const;
+    void indexes_Includes_Where() const;
+    void indexes_Primary_Where_Exception() const;
+    void dropIndex_PartialUnique() const;
 
     void renameIndex() const;
 
@@ -176,6 +180,13 @@ private Q_SLOTS:
 #endif
 
     void dropForeign() const;
+    void validateForeign() const;
+
+    /* Partitioning */
+    void partitionByRange_CreateTable() const;
+    void partitionByHash_CreateTable() const;
+    void partitionBy_ModifyTable_ThrowException() const;
+    void partitions_ModifyTable() const;
 
 // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private:
@@ -2828,7 +2839,168 @@ void tst_PostgreSQL_SchemaBuilder::indexes_Blueprint() const
     QVERIFY(log8.boundValues.isEmpty());
 }
 
-void tst_PostgreSQL_SchemaBuilder::renameIndex() const
+void tst_PostgreSQL_SchemaBuilder::indexes_Online() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.unique({"name_u"}).online();
+            table.index({"name_i"}).online();
+            table.fullText({"name_f"}).online();
+            table.spatialIndex({"coordinates_s"}).online();
+
+            // Not online
+            table.index({"name_n"});
+        });
+
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.online();
+
+            table.dropUnique({"name_u"});
+            table.dropIndex({"name_i"});
+            table.dropFullText({"name_f"});
+            table.dropSpatialIndex({"coordinates_s"});
+        });
+    });
+
+    QCOMPARE(log.size(), 9);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "create unique index concurrently \"firewalls_name_u_unique\" "
+             "on \"firewalls\" (\"name_u\")");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "create index concurrently \"firewalls_name_i_index\" "
+             "on \"firewalls\" (\"name_i\")");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "create index concurrently \"firewalls_name_f_fulltext\" "
+             "on \"firewalls\" using gin ((to_tsvector('english', \"name_f\")))");
+    QVERIFY(log2.boundValues.isEmpty());
+
+    const auto &log3 = log.at(3);
+    QCOMPARE(log3.query,
+             "create index concurrently \"firewalls_coordinates_s_spatialindex\" "
+             "on \"firewalls\" using gist (\"coordinates_s\")");
+    QVERIFY(log3.boundValues.isEmpty());
+
+    const auto &log4 = log.at(4);
+    QCOMPARE(log4.query,
+             R"(create index "firewalls_name_n_index" on "firewalls" ("name_n"))");
+    QVERIFY(log4.boundValues.isEmpty());
+
+    const auto &log5 = log.at(5);
+    QCOMPARE(log5.query,
+             R"(drop index concurrently "firewalls_name_u_unique")");
+    QVERIFY(log5.boundValues.isEmpty());
+
+    const auto &log6 = log.at(6);
+    QCOMPARE(log6.query,
+             R"(drop index concurrently "firewalls_name_i_index")");
+    QVERIFY(log6.boundValues.isEmpty());
+
+    const auto &log7 = log.at(7);
+    QCOMPARE(log7.query,
+             R"(drop index concurrently "firewalls_name_f_fulltext")");
+    QVERIFY(log7.boundValues.isEmpty());
+
+    const auto &log8 = log.at(8);
+    QCOMPARE(log8.query,
+             R"(drop index concurrently "firewalls_coordinates_s_spatialindex")");
+    QVERIFY(log8.boundValues.isEmpty());
+}
+
+void tst_PostgreSQL_SchemaBuilder::indexes_Includes_Where() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.index({"name_i"}).includes({"name_c"});
+            table.index({"name_w"}).where("deleted_at is null");
+            table.unique({"name_u"}).includes({"name_c"});
+            table.unique({"name_uw"}).where("deleted_at is null");
+        });
+    });
+
+    QCOMPARE(log.size(), 4);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "create index \"firewalls_name_i_index\" on \"firewalls\" (\"name_i\") "
+             "include (\"name_c\")");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "create index \"firewalls_name_w_index\" on \"firewalls\" (\"name_w\") "
+             "where deleted_at is null");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "alter table \"firewalls\" "
+             "add constraint \"firewalls_name_u_unique\" unique (\"name_u\") "
+             "include (\"name_c\")");
+    QVERIFY(log2.boundValues.isEmpty());
+
+    const auto &log3 = log.at(3);
+    QCOMPARE(log3.query,
+             "create unique index \"firewalls_name_uw_unique\" "
+             "on \"firewalls\" (\"name_uw\") where deleted_at is null");
+    QVERIFY(log3.boundValues.isEmpty());
+}
+
+void tst_PostgreSQL_SchemaBuilder::indexes_Primary_Where_Exception() const
+{
+    QVERIFY_EXCEPTION_THROWN(
+                DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.primary({ID}).where("deleted_at is null");
+        });
+    }),
+                LogicError);
+}
+
+void tst_PostgreSQL_SchemaBuilder::dropIndex_PartialUnique() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.unique({"name_uw"}).where("deleted_at is null");
+            // The partial unique index isn't the constraint
+            table.dropIndex("firewalls_name_uw_unique");
+        });
+    });
+
+    QCOMPARE(log.size(), 2);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "create unique index \"firewalls_name_uw_unique\" "
+             "on \"firewalls\" (\"name_uw\") where deleted_at is null");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query, R"(drop index "firewalls_name_uw_unique")");
+    QVERIFY(log1.boundValues.isEmpty());
+}
+
 {
     auto log = DB::connection(m_connection).pretend([](auto &connection)
     {
@@ -3403,6 +3575,207 @@ void tst_PostgreSQL_SchemaBuilder::dropForeign() const
              R"(alter table "firewalls" drop column "role_id")");
     QVERIFY(log7.boundValues.isEmpty());
 }
+
+void tst_PostgreSQL_SchemaBuilder::validateForeign() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.foreignId("user_id").constrained().notValid();
+            table.foreignId("torrent_id").constrained().notValid();
+        });
+
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            // By column name
+            table.validateForeign({"user_id"});
+            // By index name
+            table.validateForeign("firewalls_torrent_id_foreign");
+        });
+    });
+
+    QCOMPARE(log.size(), 5);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "alter table \"firewalls\" "
+             "add column \"user_id\" bigint not null, "
+             "add column \"torrent_id\" bigint not null");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "alter table \"firewalls\" "
+             "add constraint \"firewalls_user_id_foreign\" "
+             "foreign key (\"user_id\") "
+             "references \"users\" (\"id\") not valid");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "alter table \"firewalls\" "
+             "add constraint \"firewalls_torrent_id_foreign\" "
+             "foreign key (\"torrent_id\") "
+             "references \"torrents\" (\"id\") not valid");
+    QVERIFY(log2.boundValues.isEmpty());
+
+    const auto &log3 = log.at(3);
+    QCOMPARE(log3.query,
+             "alter table \"firewalls\" "
+             "validate constraint \"firewalls_user_id_foreign\"");
+    QVERIFY(log3.boundValues.isEmpty());
+
+    const auto &log4 = log.at(4);
+    QCOMPARE(log4.query,
+             "alter table \"firewalls\" "
+             "validate constraint \"firewalls_torrent_id_foreign\"");
+    QVERIFY(log4.boundValues.isEmpty());
+}
+
+void tst_PostgreSQL_SchemaBuilder::partitionByRange_CreateTable() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .create(Firewalls, [](Blueprint &table)
+        {
+            table.bigInteger(ID);
+            table.date("created_at");
+
+            table.partitionByRange({"created_at"});
+
+            table.rangePartition("firewalls_old", {}, QDate(2022, 1, 1));
+            table.rangePartition("firewalls_2022", QDate(2022, 1, 1), QDate(2023, 1, 1));
+            table.rangePartition("firewalls_new", QDate(2023, 1, 1), {});
+        });
+    });
+
+    QCOMPARE(log.size(), 4);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "create table \"firewalls\" ("
+             "\"id\" bigint not null, "
+             "\"created_at\" date not null) "
+             "partition by range (\"created_at\")");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "create table \"firewalls_old\" partition of \"firewalls\" "
+             "for values from (minvalue) to ('2022-01-01')");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "create table \"firewalls_2022\" partition of \"firewalls\" "
+             "for values from ('2022-01-01') to ('2023-01-01')");
+    QVERIFY(log2.boundValues.isEmpty());
+
+    const auto &log3 = log.at(3);
+    QCOMPARE(log3.query,
+             "create table \"firewalls_new\" partition of \"firewalls\" "
+             "for values from ('2023-01-01') to (maxvalue)");
+    QVERIFY(log3.boundValues.isEmpty());
+}
+
+void tst_PostgreSQL_SchemaBuilder::partitionByHash_CreateTable() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .create(Firewalls, [](Blueprint &table)
+        {
+            table.bigInteger(ID);
+
+            table.partitionByHash({ID}, 2);
+        });
+    });
+
+    QCOMPARE(log.size(), 3);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "create table \"firewalls\" (\"id\" bigint not null) "
+             "partition by hash (\"id\")");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "create table \"firewalls_0\" partition of \"firewalls\" "
+             "for values with (modulus 2, remainder 0)");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "create table \"firewalls_1\" partition of \"firewalls\" "
+             "for values with (modulus 2, remainder 1)");
+    QVERIFY(log2.boundValues.isEmpty());
+}
+
+void tst_PostgreSQL_SchemaBuilder::partitionBy_ModifyTable_ThrowException() const
+{
+    // Verify
+    DB::connection(m_connection).pretend([](auto &connection)
+    {
+        QVERIFY_EXCEPTION_THROWN(
+                    Schema::on(connection.getName())
+                    .table(Firewalls, [](Blueprint &table)
+        {
+            table.partitionByRange({"created_at"});
+        }),
+                    LogicError);
+    });
+}
+
+void tst_PostgreSQL_SchemaBuilder::partitions_ModifyTable() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.listPartition("firewalls_eu", {"sk", "cz"});
+            table.listPartition("firewalls_ids", {1, 2});
+            table.hashPartition("firewalls_h3", 4, 3);
+            table.detachPartition("firewalls_2022");
+            table.dropPartition("firewalls_old");
+        });
+    });
+
+    QCOMPARE(log.size(), 5);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "create table \"firewalls_eu\" partition of \"firewalls\" "
+             "for values in ('sk', 'cz')");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "create table \"firewalls_ids\" partition of \"firewalls\" "
+             "for values in (1, 2)");
+    QVERIFY(log1.boundValues.isEmpty());
+
+    const auto &log2 = log.at(2);
+    QCOMPARE(log2.query,
+             "create table \"firewalls_h3\" partition of \"firewalls\" "
+             "for values with (modulus 4, remainder 3)");
+    QVERIFY(log2.boundValues.isEmpty());
+
+    const auto &log3 = log.at(3);
+    QCOMPARE(log3.query,
+             R"(alter table "firewalls" detach partition "firewalls_2022")");
+    QVERIFY(log3.boundValues.isEmpty());
+
+    const auto &log4 = log.at(4);
+    QCOMPARE(log4.query,
+             R"(drop table "firewalls_old")");
+    QVERIFY(log4.boundValues.isEmpty());
+}
 // NOLINTEND(readability-convert-member-functions-to-static)
 
 QTEST_MAIN(tst_PostgreSQL_SchemaBuilder)
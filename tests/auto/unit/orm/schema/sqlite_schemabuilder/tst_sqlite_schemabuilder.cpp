@@ -107,6 +107,9 @@ private Q_SLOTS:
     void indexes_Fluent_Fulltext_SpatialIndex_Exceptions() const;
     void indexes_Blueprint_Fulltext_SpatialIndex_Exceptions() const;
 
+    void indexes_Where() const;
+    void indexes_Includes_Exception() const;
+
     void renameIndex() const;
 
     void dropIndex_ByIndexName() const;
@@ -1334,6 +1337,50 @@ void tst_SQLite_SchemaBuilder::indexes_Blueprint_Fulltext_SpatialIndex_Exception
                     RuntimeError);
 }
 
+void tst_SQLite_SchemaBuilder::indexes_Where() const
+{
+    auto log = DB::connection(m_connection).pretend([](auto &connection)
+    {
+        Schema::on(connection.getName())
+                .table(Firewalls, [](Blueprint &table)
+        {
+            table.index({"name_w"}).where("deleted_at is null");
+            table.unique({"name_uw"}).where("deleted_at is null");
+        });
+    });
+
+    QCOMPARE(log.size(), 2);
+
+    const auto &log0 = log.at(0);
+    QCOMPARE(log0.query,
+             "create index \"firewalls_name_w_index\" on \"firewalls\" (\"name_w\") "
+             "where deleted_at is null");
+    QVERIFY(log0.boundValues.isEmpty());
+
+    const auto &log1 = log.at(1);
+    QCOMPARE(log1.query,
+             "create unique index \"firewalls_name_uw_unique\" "
+             "on \"firewalls\" (\"name_uw\") where deleted_at is null");
+    QVERIFY(log1.boundValues.isEmpty());
+}
+
+void tst_SQLite_SchemaBuilder::indexes_Includes_Exception() const
+{
+    QVERIFY_EXCEPTION_THROWN(
+                Schema::on(m_connection).table(Firewalls, [](Blueprint &table)
+                {
+                    table.index({"name_i"}).includes({"name_c"});
+                }),
+                    LogicError);
+
+    QVERIFY_EXCEPTION_THROWN(
+                Schema::on(m_connection).table(Firewalls, [](Blueprint &table)
+                {
+                    table.unique({"name_u"}).includes({"name_c"});
+                }),
+                    LogicError);
+}
+
 void tst_SQLite_SchemaBuilder::renameIndex() const
 {
     QVERIFY_EXCEPTION_THROWN(
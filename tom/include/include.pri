@@ -13,6 +13,7 @@ headersList += \
     $$PWD/tom/commands/command.hpp \
     $$PWD/tom/commands/completecommand.hpp \
     $$PWD/tom/commands/database/seedcommand.hpp \
+    $$PWD/tom/commands/database/snapshotcommand.hpp \
     $$PWD/tom/commands/database/wipecommand.hpp \
     $$PWD/tom/commands/environmentcommand.hpp \
     $$PWD/tom/commands/helpcommand.hpp \
@@ -45,6 +46,7 @@ headersList += \
     $$PWD/tom/commands/migrations/rollbackcommand.hpp \
     $$PWD/tom/commands/migrations/statuscommand.hpp \
     $$PWD/tom/commands/migrations/uninstallcommand.hpp \
+    $$PWD/tom/commands/schema/dumpcommand.hpp \
     $$PWD/tom/commands/stubs/integratestubs.hpp \
     $$PWD/tom/concerns/callscommands.hpp \
     $$PWD/tom/concerns/confirmable.hpp \
@@ -60,8 +62,13 @@ headersList += \
     $$PWD/tom/exceptions/runtimeerror.hpp \
     $$PWD/tom/exceptions/tomerror.hpp \
     $$PWD/tom/migration.hpp \
+    $$PWD/tom/migrationreport.hpp \
     $$PWD/tom/migrationrepository.hpp \
     $$PWD/tom/migrator.hpp \
+    $$PWD/tom/schema/mysqlschemastate.hpp \
+    $$PWD/tom/schema/postgresschemastate.hpp \
+    $$PWD/tom/schema/schemastate.hpp \
+    $$PWD/tom/schema/sqliteschemastate.hpp \
     $$PWD/tom/seeder.hpp \
     $$PWD/tom/terminal.hpp \
     $$PWD/tom/tomconstants.hpp \
@@ -0,0 +1,68 @@
+#pragma once
+#ifndef TOM_COMMANDS_DATABASE_SNAPSHOTCOMMAND_HPP
+#define TOM_COMMANDS_DATABASE_SNAPSHOTCOMMAND_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include "tom/commands/command.hpp"
+#include "tom/concerns/confirmable.hpp"
+#include "tom/concerns/usingconnection.hpp"
+#include "tom/tomconstants.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Tom::Commands::Database
+{
+
+    /*! Create, restore, or drop the database snapshot. */
+    class SnapshotCommand : public Command,
+                            public Concerns::Confirmable,
+                            public Concerns::UsingConnection
+    {
+        Q_DISABLE_COPY(SnapshotCommand)
+
+        /*! Alias for the Command. */
+        using Command = Commands::Command;
+
+    public:
+        /*! Constructor. */
+        SnapshotCommand(Application &application, QCommandLineParser &parser);
+        /*! Virtual destructor. */
+        inline ~SnapshotCommand() override = default;
+
+        /*! The console command name. */
+        inline QString name() const override;
+        /*! The console command description. */
+        inline QString description() const override;
+
+        /*! The console command positional arguments signature. */
+        const std::vector<PositionalArgument> &positionalArguments() const override;
+        /*! The signature of the console command. */
+        QList<CommandLineOption> optionsSignature() const override;
+
+        /*! Execute the console command. */
+        int run() override;
+
+    protected:
+        /*! Throw if the --restore and --drop options are set at once. */
+        void throwIfRestoreAndDrop() const;
+    };
+
+    /* public */
+
+    QString SnapshotCommand::name() const
+    {
+        return Constants::DbSnapshot;
+    }
+
+    QString SnapshotCommand::description() const
+    {
+        return QStringLiteral("Create, restore, or drop the database snapshot");
+    }
+
+} // namespace Tom::Commands::Database
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_COMMANDS_DATABASE_SNAPSHOTCOMMAND_HPP
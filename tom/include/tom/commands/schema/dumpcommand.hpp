@@ -0,0 +1,77 @@
+#pragma once
+#ifndef TOM_COMMANDS_SCHEMA_DUMPCOMMAND_HPP
+#define TOM_COMMANDS_SCHEMA_DUMPCOMMAND_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include <filesystem>
+
+#include "tom/commands/command.hpp"
+#include "tom/concerns/usingconnection.hpp"
+#include "tom/tomconstants.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Tom
+{
+    class Migrator;
+
+namespace Commands::Schema
+{
+
+    /*! Dump the given database schema. */
+    class DumpCommand : public Command,
+                        public Concerns::UsingConnection
+    {
+        Q_DISABLE_COPY(DumpCommand)
+
+        /*! Alias for the filesystem path. */
+        using fspath = std::filesystem::path;
+
+    public:
+        /*! Constructor. */
+        DumpCommand(Application &application, QCommandLineParser &parser,
+                    std::shared_ptr<Migrator> migrator);
+        /*! Virtual destructor. */
+        inline ~DumpCommand() override = default;
+
+        /*! The console command name. */
+        inline QString name() const override;
+        /*! The console command description. */
+        inline QString description() const override;
+
+        /*! The signature of the console command. */
+        QList<CommandLineOption> optionsSignature() const override;
+
+        /*! Execute the console command. */
+        int run() override;
+
+    protected:
+        /*! Get the path where the schema dump file should be stored. */
+        fspath schemaPath(const QString &database) const;
+        /*! Show migration files that are a part of the schema dump. */
+        void pruneMigrations() const;
+
+        /*! The migrator service instance. */
+        std::shared_ptr<Migrator> m_migrator;
+    };
+
+    /* public */
+
+    QString DumpCommand::name() const
+    {
+        return Constants::SchemaDump;
+    }
+
+    QString DumpCommand::description() const
+    {
+        return QStringLiteral("Dump the given database schema");
+    }
+
+} // namespace Commands::Schema
+} // namespace Tom
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_COMMANDS_SCHEMA_DUMPCOMMAND_HPP
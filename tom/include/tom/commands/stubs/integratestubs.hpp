@@ -143,12 +143,12 @@ _tom()
 
     # Inaccurate completion if the tom command is not on the system path, it doesn't
     # provide all options
-    commands='env help inspire integrate list migrate db:seed db:wipe
-        make:migration make:model make:seeder migrate:fresh migrate:install
+    commands='env help inspire integrate list migrate db:seed db:snapshot
+        db:wipe make:migration make:model make:seeder migrate:fresh migrate:install
         migrate:refresh migrate:reset migrate:rollback migrate:status
-        migrate:uninstall'
+        migrate:uninstall schema:dump'
 
-    namespaces='global db make migrate namespaced all'
+    namespaces='global db make migrate schema namespaced all'
 
     common_options='--ansi --no-ansi --env= --help --no-interaction --quiet
         --version --verbose'
@@ -210,6 +210,7 @@ __tom_commands() {
         'list:List commands'
         'migrate:Run the database migrations'
         'db\:seed:Seed the database with records'
+        'db\:snapshot:Create, restore, or drop the database snapshot'
         'db\:wipe:Drop all tables, views, and types'
         'make\:migration:Create a new migration file'
         'make\:model:Create a new model class'
@@ -221,6 +222,7 @@ __tom_commands() {
         'migrate\:rollback:Rollback the last database migration'
         'migrate\:status:Show the status of each migration'
         'migrate\:uninstall:Drop the migration repository with an optional reset'
+        'schema\:dump:Dump the given database schema'
     )
 
     _describe -t commands command commands
@@ -231,7 +233,7 @@ __tom_environments() {
 }
 
 __tom_namespaces() {
-    _values namespace 'global' 'db' 'make' 'migrate' 'namespaced' 'all'
+    _values namespace 'global' 'db' 'make' 'migrate' 'schema' 'namespaced' 'all'
 }
 
 # Try to infer database connection names if a user is in the right folder and have tagged
@@ -365,7 +367,10 @@ _tom() {
                 '--database=[The database connection to use]:connection:__tom_connections' \
                 '(-f --force)'{-f,--force}'[Force the operation to run when in production]' \
                 '--pretend[Dump the SQL queries that would be run]' \
+                '--report=[Write the migration report in the JSON format to the given file]:file path:_files' \
+                '--schema-path=[The path to a schema dump file]:file path:_files' \
                 '--seed[Indicates if the seed task should be re-run]' \
+                '--sql-path=[Write the executed (or pretended) SQL queries to the given file]:file path:_files' \
                 '--step[Force the migrations to be run so they can be rolled back individually]'
             ;;
 
@@ -378,6 +383,16 @@ _tom() {
                 '(-f --force)'{-f,--force}'[Force the operation to run when in production]'
             ;;
 
+        db:snapshot)
+            _arguments \
+                $common_options \
+                '1::snapshot name' \
+                '--database=[The database connection to use]:connection:__tom_connections' \
+                '(--drop)--restore[Restore the database from the snapshot]' \
+                '(--restore)--drop[Drop the snapshot]' \
+                '(-f --force)'{-f,--force}'[Force the operation to run when in production]'
+            ;;
+
         db:wipe)
             _arguments \
                 $common_options \
@@ -459,6 +474,7 @@ _tom() {
                 '--drop-views[Drop all tables and views]' \
                 '--drop-types[Drop all tables and types (Postgres only)]' \
                 '(-f --force)'{-f,--force}'[Force the operation to run when in production]' \
+                '--schema-path=[The path to a schema dump file]:file path:_files' \
                 '--seed[Indicates if the seed task should be re-run]' \
                 '--seeder=[The class name of the root seeder]:class name:__tom_seeders' \
                 '--step[Force the migrations to be run so they can be rolled back individually]'
@@ -475,8 +491,10 @@ _tom() {
                 $common_options \
                 '--database=[The database connection to use]:connection:__tom_connections' \
                 '(-f --force)'{-f,--force}'[Force the operation to run when in production]' \
+                '--report=[Write the migration report in the JSON format to the given file]:file path:_files' \
                 '--seed[Indicates if the seed task should be re-run]' \
                 '--seeder=[The class name of the root seeder]:class name:__tom_seeders' \
+                '--sql-path=[Write the executed SQL queries to the given file]:file path:_files' \
                 '--step=[The number of migrations to be reverted & re-run]:number' \
                 '--step-migrate[Force the migrations to be run so they can be rolled back individually]'
             ;;
@@ -486,7 +504,9 @@ _tom() {
                 $common_options \
                 '--database=[The database connection to use]:connection:__tom_connections' \
                 '(-f --force)'{-f,--force}'[Force the operation to run when in production]' \
-                '--pretend[Dump the SQL queries that would be run]'
+                '--pretend[Dump the SQL queries that would be run]' \
+                '--report=[Write the migration report in the JSON format to the given file]:file path:_files' \
+                '--sql-path=[Write the executed (or pretended) SQL queries to the given file]:file path:_files'
             ;;
 
         migrate:rollback)
@@ -495,6 +515,8 @@ _tom() {
                 '--database=[The database connection to use]:connection:__tom_connections' \
                 '(-f --force)'{-f,--force}'[Force the operation to run when in production]' \
                 '--pretend[Dump the SQL queries that would be run]' \
+                '--report=[Write the migration report in the JSON format to the given file]:file path:_files' \
+                '--sql-path=[Write the executed (or pretended) SQL queries to the given file]:file path:_files' \
                 '--step=[The number of migrations to be reverted & re-run]:number' \
                 '--batch=[The batch of migrations (identified by their batch number) to be reverted]:number'
             ;;
@@ -513,6 +535,14 @@ _tom() {
                 '--force[Force the operation to run when in production]' \
                 '--pretend[Dump the SQL queries that would be run]'
             ;;
+
+        schema:dump)
+            _arguments \
+                $common_options \
+                '--database=[The database connection to use]:connection:__tom_connections' \
+                '--path=[The path where the schema dump file should be stored]:file path:_files' \
+                '--prune[Delete all existing migration files that are a part of the schema dump]'
+            ;;
     esac
 }
 
@@ -0,0 +1,120 @@
+#pragma once
+#ifndef TOM_MIGRATIONREPORT_HPP
+#define TOM_MIGRATIONREPORT_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include <QDateTime>
+#include <QJsonDocument>
+
+#include <vector>
+
+#include <orm/types/log.hpp>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Tom
+{
+namespace Concerns
+{
+    class InteractsWithIO;
+}
+
+    /*! Migration report, records executed migrations and their queries (used by
+        the --report and --sql-path options). */
+    class MigrationReport
+    {
+        Q_DISABLE_COPY(MigrationReport)
+
+        /*! Alias for the query Log. */
+        using Log = Orm::Types::Log;
+        /*! Alias for the InteractsWithIO. */
+        using InteractsWithIO = Concerns::InteractsWithIO;
+
+    public:
+        /*! Executed (or pretended) migration. */
+        struct Item
+        {
+            /*! Migration name. */
+            QString migration;
+            /*! Migrate method (up/down). */
+            QString method;
+            /*! Database connection name. */
+            QString connection;
+            /*! Migration execution time (-1 for the pretended migration). */
+            qint64 elapsed = -1;
+            /*! Executed queries in the execution order. */
+            QVector<Log> queries;
+        };
+
+        /*! Constructor. */
+        MigrationReport(QString command, bool pretend, QString reportPath,
+                        QString sqlPath);
+        /*! Default destructor. */
+        inline ~MigrationReport() = default;
+
+        /*! Factory method, returns nullptr if the report and SQL paths are empty. */
+        static std::shared_ptr<MigrationReport>
+        make(const QString &command, bool pretend, const QString &reportPath,
+             const QString &sqlPath);
+
+        /*! Record the executed migration. */
+        void addMigration(Item &&item);
+        /*! Get the recorded migrations. */
+        inline const std::vector<Item> &migrations() const noexcept;
+
+        /*! Mark the report as failed, it contains migrations executed before
+            the failed migration only. */
+        void markFailed(QString error);
+        /*! Determine whether the recorded command failed. */
+        inline bool failed() const noexcept;
+
+        /*! Get the report in the JSON format. */
+        QJsonDocument toJson() const;
+        /*! Get the SQL script of all recorded queries in the execution order. */
+        QString toSql() const;
+
+        /*! Write the JSON report and the SQL script to the given paths. */
+        void write(const InteractsWithIO &io) const;
+
+    protected:
+        /*! Write the given content to the file. */
+        static void writeFile(const QString &path, const QByteArray &content);
+
+        /*! Command name that executed migrations. */
+        QString m_command;
+        /*! Were migrations pretended? */
+        bool m_pretend;
+        /*! The path to the JSON report file. */
+        QString m_reportPath;
+        /*! The path to the SQL script file. */
+        QString m_sqlPath;
+        /*! Time when the recording started. */
+        QDateTime m_startedAt;
+        /*! Recorded migrations. */
+        std::vector<Item> m_migrations {};
+        /*! Is the report partial because the recorded command failed? */
+        bool m_failed = false;
+        /*! Error message of the failed command. */
+        QString m_error {};
+    };
+
+    /* public */
+
+    const std::vector<MigrationReport::Item> &
+    MigrationReport::migrations() const noexcept
+    {
+        return m_migrations;
+    }
+
+    bool MigrationReport::failed() const noexcept
+    {
+        return m_failed;
+    }
+
+} // namespace Tom
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_MIGRATIONREPORT_HPP
@@ -80,6 +80,8 @@ namespace Tom
         DatabaseConnection &connection() const;
         /*! Set the connection name to use in the repository. */
         inline void setConnection(const QString &name) noexcept;
+        /*! Get the name of the migration table. */
+        inline const QString &getTable() const noexcept;
 
     protected:
         /*! Get a query builder for the migration table. */
@@ -103,6 +105,11 @@ namespace Tom
         m_connection = name;
     }
 
+    const QString &MigrationRepository::getTable() const noexcept
+    {
+        return m_table;
+    }
+
 } // namespace Tom
 
 TINYORM_END_COMMON_NAMESPACE
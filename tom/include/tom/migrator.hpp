@@ -2,6 +2,7 @@
 #ifndef TOM_MIGRATOR_HPP
 #define TOM_MIGRATOR_HPP
 
+#include <functional>
 #include <set>
 #include <typeindex>
 
@@ -16,6 +17,7 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 namespace Tom
 {
 
+    class MigrationReport;
     class MigrationRepository;
 
     /*! Migration service class. */
@@ -62,11 +64,18 @@ namespace Tom
         /*! Rolls all of the currently applied migrations back. */
         std::vector<RollbackItem> reset(bool pretend = false) const;
 
+        /* Migration report */
+        /*! Record executed migrations into the given report during the callback and
+            write it, also the partial report if the callback throws (the nullptr
+            report doesn't change the currently recorded report). */
+        int withReport(const std::shared_ptr<MigrationReport> &report,
+                       const std::function<int()> &callback) const;
+
         /* Proxies to MigrationRepository */
         /*! Determine if the migration repository exists. */
         bool repositoryExists() const;
         /*! Determine if any migrations have been run. */
-//        bool hasRunAnyMigrations() const;
+        bool hasRunAnyMigrations() const;
 
         /* Getters / Setters */
         /*! Get the migration repository instance. */
@@ -121,8 +130,26 @@ namespace Tom
         QVector<Log> getQueries(const Migration &migration, MigrateMethod method) const;
 
         /* Migrate up/down common */
+        /*! Run a migration inside a transaction if the database supports it, returns
+            executed queries if the report is recorded. */
+        QVector<Log> runMigration(const Migration &migration, MigrateMethod method) const;
+        /*! Run a migration and collect executed queries from the query log. */
+        static QVector<Log>
+        runMigrationWithQueryLog(const Migration &migration, MigrateMethod method,
+                                 DatabaseConnection &connection,
+                                 bool withinTransaction);
         /*! Run a migration inside a transaction if the database supports it. */
-        void runMigration(const Migration &migration, MigrateMethod method) const;
+        static void runMigrationInternal(const Migration &migration, MigrateMethod method,
+                                         DatabaseConnection &connection,
+                                         bool withinTransaction);
+        /*! Mark the given report as failed and write it (doesn't throw). */
+        void writeFailedReport(MigrationReport &report, QString error) const;
+        /*! Record the executed migration into the report (if recording). */
+        void recordMigration(const Migration &migration, QString migrationName,
+                             MigrateMethod method, qint64 elapsed,
+                             QVector<Log> &&queries) const;
+        /*! Get the database connection name used by the given migration. */
+        QString migrationConnectionName(const Migration &migration) const;
         /*! Migrate by the given method (up/down). */
         static void migrateByMethod(const Migration &migration, MigrateMethod method);
 
@@ -161,6 +188,8 @@ namespace Tom
         /*! Map a migration instances by migration names (used by reset). */
         std::unordered_map<QString,
                            std::shared_ptr<Migration>> m_migrationInstancesMap {};
+        /*! Report of executed migrations (used by the --report, --sql-path). */
+        mutable std::shared_ptr<MigrationReport> m_report = nullptr;
     };
 
     /* public */
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef TOM_SCHEMA_MYSQLSCHEMASTATE_HPP
+#define TOM_SCHEMA_MYSQLSCHEMASTATE_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include "tom/schema/schemastate.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Tom::Schema
+{
+
+    /*! Dump and load the MySQL database schema (mysqldump and mysql clients). */
+    class MySqlSchemaState final : public SchemaState
+    {
+        Q_DISABLE_COPY(MySqlSchemaState)
+
+    public:
+        /*! Inherit constructors. */
+        using SchemaState::SchemaState;
+
+        /*! Virtual destructor. */
+        inline ~MySqlSchemaState() final = default;
+
+        /*! Dump the database's schema and the migrations table data into a file. */
+        void dump(const fspath &path) const final;
+        /*! Load the given schema file into the database. */
+        void load(const fspath &path) const final;
+
+    protected:
+        /*! Get the base arguments for the mysql and mysqldump clients. */
+        QStringList baseArguments() const;
+        /*! Run the mysqldump client. */
+        void runDump(const fspath &path, bool columnStatistics) const;
+        /*! Remove the auto-incrementing state from the given schema dump. */
+        static void removeAutoIncrementingState(const fspath &path);
+
+        /*! Get the environment for the database command-line client. */
+        QProcessEnvironment processEnvironment() const final;
+    };
+
+} // namespace Tom::Schema
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_SCHEMA_MYSQLSCHEMASTATE_HPP
@@ -0,0 +1,47 @@
+#pragma once
+#ifndef TOM_SCHEMA_POSTGRESSCHEMASTATE_HPP
+#define TOM_SCHEMA_POSTGRESSCHEMASTATE_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include "tom/schema/schemastate.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Tom::Schema
+{
+
+    /*! Dump and load the PostgreSQL database schema (pg_dump and psql clients). */
+    class PostgresSchemaState final : public SchemaState
+    {
+        Q_DISABLE_COPY(PostgresSchemaState)
+
+    public:
+        /*! Inherit constructors. */
+        using SchemaState::SchemaState;
+
+        /*! Virtual destructor. */
+        inline ~PostgresSchemaState() final = default;
+
+        /*! Dump the database's schema and the migrations table data into a file. */
+        void dump(const fspath &path) const final;
+        /*! Load the given schema file into the database. */
+        void load(const fspath &path) const final;
+
+    protected:
+        /*! Get the base arguments for the pg_dump and psql clients. */
+        QStringList baseArguments() const;
+
+        /*! Get the SQL statement executed after the migrations table data
+            were inserted. */
+        QString migrationDataEpilogue() const final;
+        /*! Get the environment for the database command-line client. */
+        QProcessEnvironment processEnvironment() const final;
+    };
+
+} // namespace Tom::Schema
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_SCHEMA_POSTGRESSCHEMASTATE_HPP
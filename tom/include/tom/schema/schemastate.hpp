@@ -0,0 +1,99 @@
+#pragma once
+#ifndef TOM_SCHEMA_SCHEMASTATE_HPP
+#define TOM_SCHEMA_SCHEMASTATE_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include <QProcessEnvironment>
+
+#include <filesystem>
+#include <memory>
+
+#include <orm/macros/commonnamespace.hpp>
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Orm
+{
+    class DatabaseConnection;
+}
+
+namespace Tom
+{
+    class MigrationRepository;
+
+namespace Schema
+{
+
+    /*! Dump and load the database schema (base class), the database schema and
+        the content of the migrations table are stored in the SQL file, the dump
+        and load are done using the database command-line clients. */
+    class SchemaState
+    {
+        Q_DISABLE_COPY(SchemaState)
+
+    protected:
+        /*! Alias for the DatabaseConnection. */
+        using DatabaseConnection = Orm::DatabaseConnection;
+        /*! Alias for the filesystem path. */
+        using fspath = std::filesystem::path;
+
+    public:
+        /*! Constructor. */
+        SchemaState(DatabaseConnection &connection, MigrationRepository &repository);
+        /*! Pure virtual destructor. */
+        inline virtual ~SchemaState() = 0;
+
+        /*! Create the schema state instance for the given connection's driver. */
+        static std::unique_ptr<SchemaState>
+        make(DatabaseConnection &connection, MigrationRepository &repository);
+
+        /*! Get the default schema file path for the given connection. */
+        static fspath defaultPath(const fspath &migrationsPath,
+                                  const QString &connection);
+
+        /*! Dump the database's schema and the migrations table data into a file. */
+        virtual void dump(const fspath &path) const = 0;
+        /*! Load the given schema file into the database. */
+        virtual void load(const fspath &path) const = 0;
+
+    protected:
+        /*! Append the content of the migrations table to the schema file. */
+        void appendMigrationData(const fspath &path) const;
+        /*! Get the SQL statement executed after the migrations table data
+            were inserted. */
+        virtual QString migrationDataEpilogue() const;
+
+        /*! Run the given database command-line client. */
+        void runProcess(const QString &program, const QStringList &arguments,
+                        const fspath &inputFile = {},
+                        const fspath &outputFile = {}) const;
+        /*! Get the environment for the database command-line client. */
+        virtual QProcessEnvironment processEnvironment() const;
+
+        /*! Get the connection configuration value as the QString. */
+        QString configValue(const QString &option) const;
+
+        /*! Read the whole schema file. */
+        static QString readSchemaFile(const fspath &path);
+        /*! Write the given content to the schema file. */
+        static void writeSchemaFile(const fspath &path, const QString &content,
+                                    bool append = false);
+
+        /*! The database connection instance. */
+        std::reference_wrapper<DatabaseConnection> m_connection;
+        /*! The migration repository instance. */
+        std::reference_wrapper<MigrationRepository> m_repository;
+    };
+
+    /* public */
+
+    SchemaState::~SchemaState() = default;
+
+} // namespace Schema
+} // namespace Tom
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_SCHEMA_SCHEMASTATE_HPP
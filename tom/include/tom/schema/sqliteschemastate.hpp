@@ -0,0 +1,43 @@
+#pragma once
+#ifndef TOM_SCHEMA_SQLITESCHEMASTATE_HPP
+#define TOM_SCHEMA_SQLITESCHEMASTATE_HPP
+
+#include <orm/macros/systemheader.hpp>
+TINY_SYSTEM_HEADER
+
+#include "tom/schema/schemastate.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace Tom::Schema
+{
+
+    /*! Dump and load the SQLite database schema (sqlite3 client). */
+    class SQLiteSchemaState final : public SchemaState
+    {
+        Q_DISABLE_COPY(SQLiteSchemaState)
+
+    public:
+        /*! Inherit constructors. */
+        using SchemaState::SchemaState;
+
+        /*! Virtual destructor. */
+        inline ~SQLiteSchemaState() final = default;
+
+        /*! Dump the database's schema and the migrations table data into a file. */
+        void dump(const fspath &path) const final;
+        /*! Load the given schema file into the database. */
+        void load(const fspath &path) const final;
+
+    protected:
+        /*! Get the database file path, throw for the in-memory database. */
+        QString databasePath() const;
+        /*! Remove the internal sqlite_sequence table from the given schema dump. */
+        static void removeSequenceTable(const fspath &path);
+    };
+
+} // namespace Tom::Schema
+
+TINYORM_END_COMMON_NAMESPACE
+
+#endif // TOM_SCHEMA_SQLITESCHEMASTATE_HPP
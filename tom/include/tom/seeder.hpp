@@ -7,6 +7,7 @@ TINY_SYSTEM_HEADER
 
 #include <orm/db.hpp>
 #include <orm/utils/nullvariant.hpp>
+#include <orm/utils/type.hpp>
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
@@ -64,10 +65,24 @@ namespace Concerns
         template<SeederConcept ...T, typename ...Args>
         void callSilent(Args &&...args) const;
 
+        /*! Run the given independent seeder classes in parallel, every seeder runs
+            on its own thread using its own database connections. */
+        template<SeederConcept ...T>
+        void callParallel(bool silent = false) const;
+
         /*! Set the console input/ouput. */
         Seeder &setIO(const InteractsWithIO &io);
 
     private:
+        /*! Alias for the optional console input/output reference. */
+        using OptionalIO = std::optional<std::reference_wrapper<const InteractsWithIO>>;
+        /*! Alias for the seeder name and the callback that runs the seeder. */
+        using ParallelSeeder = std::pair<QString, std::function<void()>>;
+
+        /*! Set the console input/ouput (nested seeders in the parallel seeders run
+            without the IO). */
+        Seeder &setIO(OptionalIO io) noexcept;
+
         /*! Run the given seeder classes. */
         template<typename ...Args>
         void callUnfolded(bool silent = false, Args &&...args);
@@ -78,10 +93,12 @@ namespace Concerns
         /*! Run the given seeder classes captured in the callback (helps to avoid
             duplicates). */
         void callInternal(bool silent, std::function<void()> &&callback) const;
+        /*! Run the given seeders in parallel and wait for all of them. */
+        void callParallelInternal(bool silent,
+                                  std::vector<ParallelSeeder> &&seeders) const;
 
         /*! Reference to the IO. */
-        std::optional<
-                std::reference_wrapper<const InteractsWithIO>> m_io = std::nullopt;
+        OptionalIO m_io = std::nullopt;
     };
 
     /* public */
@@ -99,14 +116,14 @@ namespace Concerns
     template<SeederConcept ...T, typename ...Args>
     void Seeder::call(const bool silent, Args &&...args)
     {
-        (T().setIO(m_io.value())
+        (T().setIO(m_io)
             .callUnfolded(silent, std::forward<Args>(args)...), ...);
     }
 
     template<SeederConcept ...T, typename ...Args>
     void Seeder::call(const bool silent, Args &&...args) const
     {
-        (std::add_const_t<T>().setIO(m_io.value())
+        (std::add_const_t<T>().setIO(m_io)
                               .callUnfolded(silent, std::forward<Args>(args)...), ...);
     }
 
@@ -134,6 +151,17 @@ namespace Concerns
         call(true, std::forward<Args>(args)...);
     }
 
+    template<SeederConcept ...T>
+    void Seeder::callParallel(const bool silent) const
+    {
+        callParallelInternal(silent, {
+            {Orm::Utils::Type::classPureBasename<T>(true), []
+            {
+                T().run();
+            }}...
+        });
+    }
+
     /* private */
 
     template<typename ...Args>
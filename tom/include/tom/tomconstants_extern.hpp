@@ -150,12 +150,23 @@ namespace Tom::Constants
     SHAREDLIB_EXPORT extern const QString reset;
     // integrate
     SHAREDLIB_EXPORT extern const QString stdout_;
+    // migrate, migrate:fresh
+    SHAREDLIB_EXPORT extern const QString schema_path;
+    // schema:dump
+    SHAREDLIB_EXPORT extern const QString prune;
+    // db:snapshot
+    SHAREDLIB_EXPORT extern const QString restore;
+    SHAREDLIB_EXPORT extern const QString drop_;
+    // migrate, migrate:rollback, migrate:reset, migrate:refresh
+    SHAREDLIB_EXPORT extern const QString report_;
+    SHAREDLIB_EXPORT extern const QString sql_path;
 
     // Namespace names
     SHAREDLIB_EXPORT extern const QString NsGlobal;
     SHAREDLIB_EXPORT extern const QString NsDb;
     SHAREDLIB_EXPORT extern const QString NsMake;
     SHAREDLIB_EXPORT extern const QString NsMigrate;
+    SHAREDLIB_EXPORT extern const QString NsSchema;
     SHAREDLIB_EXPORT extern const QString NsNamespaced;
     SHAREDLIB_EXPORT extern const QString NsAll;
 
@@ -168,6 +179,7 @@ namespace Tom::Constants
     SHAREDLIB_EXPORT extern const QString About;
     SHAREDLIB_EXPORT extern const QString Complete;
     SHAREDLIB_EXPORT extern const QString DbSeed;
+    SHAREDLIB_EXPORT extern const QString DbSnapshot;
     SHAREDLIB_EXPORT extern const QString DbWipe;
     SHAREDLIB_EXPORT extern const QString Inspire;
     SHAREDLIB_EXPORT extern const QString List;
@@ -186,6 +198,7 @@ namespace Tom::Constants
     SHAREDLIB_EXPORT extern const QString MigrateStatus;
     SHAREDLIB_EXPORT extern const QString MigrateUninstall;
     SHAREDLIB_EXPORT extern const QString Integrate;
+    SHAREDLIB_EXPORT extern const QString SchemaDump;
 
 } // namespace Tom::Constants
 
@@ -150,12 +150,23 @@ namespace Tom::Constants
     inline const QString reset                = QStringLiteral("reset");
     // integrate
     inline const QString stdout_              = QStringLiteral("stdout");
+    // migrate, migrate:fresh
+    inline const QString schema_path          = QStringLiteral("schema-path");
+    // schema:dump
+    inline const QString prune                = QStringLiteral("prune");
+    // db:snapshot
+    inline const QString restore              = QStringLiteral("restore");
+    inline const QString drop_                = QStringLiteral("drop");
+    // migrate, migrate:rollback, migrate:reset, migrate:refresh
+    inline const QString report_              = QStringLiteral("report");
+    inline const QString sql_path             = QStringLiteral("sql-path");
 
     // Namespace names
     inline const QString NsGlobal     = QStringLiteral("global");
     inline const QString NsDb         = QStringLiteral("db");
     inline const QString NsMake       = QStringLiteral("make");
     inline const QString NsMigrate    = QStringLiteral("migrate");
+    inline const QString NsSchema     = QStringLiteral("schema");
     inline const QString NsNamespaced = QStringLiteral("namespaced");
     inline const QString NsAll        = QStringLiteral("all");
 
@@ -168,6 +179,7 @@ namespace Tom::Constants
     inline const QString About            = QStringLiteral("about");
     inline const QString Complete         = QStringLiteral("complete");
     inline const QString DbSeed           = QStringLiteral("db:seed");
+    inline const QString DbSnapshot       = QStringLiteral("db:snapshot");
     inline const QString DbWipe           = QStringLiteral("db:wipe");
     inline const QString Inspire          = QStringLiteral("inspire");
     inline const QString List             = QStringLiteral("list");
@@ -186,6 +198,7 @@ namespace Tom::Constants
     inline const QString MigrateStatus    = QStringLiteral("migrate:status");
     inline const QString MigrateUninstall = QStringLiteral("migrate:uninstall");
     inline const QString Integrate        = QStringLiteral("integrate");
+    inline const QString SchemaDump       = QStringLiteral("schema:dump");
 
 } // namespace Tom::Constants
 
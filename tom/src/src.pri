@@ -8,6 +8,7 @@ sourcesList += \
     $$PWD/tom/commands/command.cpp \
     $$PWD/tom/commands/completecommand.cpp \
     $$PWD/tom/commands/database/seedcommand.cpp \
+    $$PWD/tom/commands/database/snapshotcommand.cpp \
     $$PWD/tom/commands/database/wipecommand.cpp \
     $$PWD/tom/commands/environmentcommand.cpp \
     $$PWD/tom/commands/helpcommand.cpp \
@@ -33,6 +34,7 @@ sourcesList += \
     $$PWD/tom/commands/migrations/rollbackcommand.cpp \
     $$PWD/tom/commands/migrations/statuscommand.cpp \
     $$PWD/tom/commands/migrations/uninstallcommand.cpp \
+    $$PWD/tom/commands/schema/dumpcommand.cpp \
     $$PWD/tom/concerns/callscommands.cpp \
     $$PWD/tom/concerns/confirmable.cpp \
     $$PWD/tom/concerns/guesscommandname.cpp \
@@ -42,8 +44,13 @@ sourcesList += \
     $$PWD/tom/concerns/usingconnection.cpp \
     $$PWD/tom/exceptions/tomlogicerror.cpp \
     $$PWD/tom/exceptions/tomruntimeerror.cpp \
+    $$PWD/tom/migrationreport.cpp \
     $$PWD/tom/migrationrepository.cpp \
     $$PWD/tom/migrator.cpp \
+    $$PWD/tom/schema/mysqlschemastate.cpp \
+    $$PWD/tom/schema/postgresschemastate.cpp \
+    $$PWD/tom/schema/schemastate.cpp \
+    $$PWD/tom/schema/sqliteschemastate.cpp \
     $$PWD/tom/seeder.cpp \
     $$PWD/tom/terminal.cpp \
     $$PWD/tom/tomutils.cpp \
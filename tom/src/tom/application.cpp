@@ -24,6 +24,7 @@
 #include "tom/commands/aboutcommand.hpp"
 #include "tom/commands/completecommand.hpp"
 #include "tom/commands/database/seedcommand.hpp"
+#include "tom/commands/database/snapshotcommand.hpp"
 #include "tom/commands/database/wipecommand.hpp"
 #include "tom/commands/environmentcommand.hpp"
 #include "tom/commands/helpcommand.hpp"
@@ -42,6 +43,7 @@
 #include "tom/commands/migrations/rollbackcommand.hpp"
 #include "tom/commands/migrations/statuscommand.hpp"
 #include "tom/commands/migrations/uninstallcommand.hpp"
+#include "tom/commands/schema/dumpcommand.hpp"
 #include "tom/exceptions/runtimeerror.hpp"
 #include "tom/migrationrepository.hpp"
 #include "tom/migrator.hpp"
@@ -69,6 +71,7 @@ using Tom::Commands::AboutCommand;
 using Tom::Commands::Command;
 using Tom::Commands::CompleteCommand;
 using Tom::Commands::Database::SeedCommand;
+using Tom::Commands::Database::SnapshotCommand;
 using Tom::Commands::Database::WipeCommand;
 using Tom::Commands::EnvironmentCommand;
 using Tom::Commands::HelpCommand;
@@ -87,10 +90,12 @@ using Tom::Commands::Migrations::ResetCommand;
 using Tom::Commands::Migrations::RollbackCommand;
 using Tom::Commands::Migrations::StatusCommand;
 using Tom::Commands::Migrations::UninstallCommand;
+using Tom::Commands::Schema::DumpCommand;
 
 using Tom::Constants::About;
 using Tom::Constants::Complete;
 using Tom::Constants::DbSeed;
+using Tom::Constants::DbSnapshot;
 using Tom::Constants::DbWipe;
 using Tom::Constants::Env;
 using Tom::Constants::Help;
@@ -115,6 +120,8 @@ using Tom::Constants::NsGlobal;
 using Tom::Constants::NsMake;
 using Tom::Constants::NsMigrate;
 using Tom::Constants::NsNamespaced;
+using Tom::Constants::NsSchema;
+using Tom::Constants::SchemaDump;
 using Tom::Constants::ansi;
 using Tom::Constants::env;
 using Tom::Constants::env_up;
@@ -555,6 +562,9 @@ Application::createCommand(const QString &command, const OptionalParserRef parse
     if (command == DbSeed)
         return std::make_unique<SeedCommand>(*this, parserRef);
 
+    if (command == DbSnapshot)
+        return std::make_unique<SnapshotCommand>(*this, parserRef);
+
     if (command == DbWipe)
         return std::make_unique<WipeCommand>(*this, parserRef);
 
@@ -608,6 +618,9 @@ Application::createCommand(const QString &command, const OptionalParserRef parse
         return std::make_unique<UninstallCommand>(*this, parserRef,
                                                   createMigrationRepository());
 
+    if (command == SchemaDump)
+        return std::make_unique<DumpCommand>(*this, parserRef, createMigrator());
+
     if (command == Integrate)
         return std::make_unique<IntegrateCommand>(*this, parserRef);
 
@@ -705,12 +718,14 @@ Application::commandNames()
         // global namespace
         About, Complete, Env, Help, Inspire, Integrate, List, Migrate,
         // db
-        DbSeed, DbWipe,
+        DbSeed, DbSnapshot, DbWipe,
         // make
         MakeMigration, MakeModel, /*MakeProject,*/ MakeSeeder,
         // migrate
         MigrateFresh,  MigrateInstall,  MigrateRefresh, MigrateReset, MigrateRollback,
-        MigrateStatus, MigrateUninstall
+        MigrateStatus, MigrateUninstall,
+        // schema
+        SchemaDump,
     };
 
     return cached;
@@ -724,7 +739,7 @@ Application::namespaceNames()
         // global namespace
         EMPTY, NsGlobal,
         // all other namespaces
-        NsDb, NsMake, NsMigrate,
+        NsDb, NsMake, NsMigrate, NsSchema,
         /* The special index used by the command name guesser, it doesn't name
            the namespace but rather returns all namespaced commands. I leave it
            accessible also by the list command so a user can also display all namespaced
@@ -751,11 +766,12 @@ const std::vector<std::tuple<int, int>> &Application::commandsIndexes()
     static const std::vector<std::tuple<int, int>> cached {
         {0,   8}, // "" - also global
         {0,   8}, // global
-        {8,  10}, // db
-        {10, 13}, // make
-        {13, 20}, // migrate
-        {8,  20}, // namespaced
-        {0,  20}, // all
+        {8,  11}, // db
+        {11, 14}, // make
+        {14, 21}, // migrate
+        {21, 22}, // schema
+        {8,  22}, // namespaced
+        {0,  22}, // all
     };
 
     return cached;
@@ -848,4 +864,4 @@ bool Application::inUnitTests() noexcept
 
 TINYORM_END_COMMON_NAMESPACE
 
-// CUR tom, commands I want to implement; test, schema:dump, model:show silverqx
+// CUR tom, commands I want to implement; test, model:show silverqx
@@ -0,0 +1,113 @@
+#include "tom/commands/database/snapshotcommand.hpp"
+
+#include <QCommandLineParser>
+
+#include <orm/constants.hpp>
+#include <orm/databaseconnection.hpp>
+
+#include "tom/exceptions/invalidargumenterror.hpp"
+#include "tom/tomconstants.hpp"
+
+/*! Alias for the QStringLiteral(). */
+#define sl(str) QStringLiteral(str)
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::NAME;
+using Orm::Constants::database_;
+
+using Tom::Constants::database_up;
+using Tom::Constants::drop_;
+using Tom::Constants::force;
+using Tom::Constants::restore;
+
+namespace Tom::Commands::Database
+{
+
+/* public */
+
+SnapshotCommand::SnapshotCommand(Application &application, QCommandLineParser &parser)
+    : Command(application, parser)
+    , Concerns::UsingConnection(connectionResolver())
+{}
+
+const std::vector<PositionalArgument> &SnapshotCommand::positionalArguments() const
+{
+    static const std::vector<PositionalArgument> cached {
+        {NAME, sl("The name of the snapshot"), {}, true, sl("default")},
+    };
+
+    return cached;
+}
+
+QList<CommandLineOption> SnapshotCommand::optionsSignature() const
+{
+    return {
+        {database_, sl("The database connection to use <comment>(multiple values "
+                       "allowed)</comment>"), database_up}, // Value
+        {restore,   sl("Restore the database from the snapshot")},
+        {drop_,     sl("Drop the snapshot")},
+
+        {{QChar('f'),
+          force},   sl("Force the operation to run when in production")},
+    };
+}
+
+int SnapshotCommand::run()
+{
+    Command::run();
+
+    throwIfRestoreAndDrop();
+
+    // Restoring replaces the whole database, ask for confirmation in the production
+    if (isSet(restore) && !confirmToProceed())
+        return EXIT_FAILURE;
+
+    const auto snapshot = argument(NAME);
+
+    // Database connection to use (multiple connections supported)
+    return usingConnections(values(database_), isDebugVerbosity(),
+                            [this, &snapshot](const QString &database)
+    {
+        auto &schemaBuilder = connection(database).getSchemaBuilder();
+
+        if (isSet(restore)) {
+            schemaBuilder.restoreSnapshot(snapshot);
+
+            info(QStringLiteral("Restored the database from the '%1' snapshot "
+                                "successfully.").arg(snapshot));
+
+            return EXIT_SUCCESS;
+        }
+
+        if (isSet(drop_)) {
+            schemaBuilder.dropSnapshotIfExists(snapshot);
+
+            info(QStringLiteral("Dropped the '%1' snapshot successfully.")
+                 .arg(snapshot));
+
+            return EXIT_SUCCESS;
+        }
+
+        schemaBuilder.createSnapshot(snapshot);
+
+        info(QStringLiteral("Created the '%1' snapshot successfully.").arg(snapshot));
+
+        return EXIT_SUCCESS;
+    });
+}
+
+/* protected */
+
+void SnapshotCommand::throwIfRestoreAndDrop() const
+{
+    if (!isSet(restore) || !isSet(drop_))
+        return;
+
+    throw Exceptions::InvalidArgumentError(
+                "The --restore and --drop options can't be used together.");
+}
+
+} // namespace Tom::Commands::Database
+
+TINYORM_END_COMMON_NAMESPACE
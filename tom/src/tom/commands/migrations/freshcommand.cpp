@@ -18,6 +18,8 @@ using Tom::Constants::database_up;
 using Tom::Constants::drop_types;
 using Tom::Constants::drop_views;
 using Tom::Constants::force;
+using Tom::Constants::path_up;
+using Tom::Constants::schema_path;
 using Tom::Constants::seed;
 using Tom::Constants::seeder;
 using Tom::Constants::seeder_up;
@@ -58,7 +60,7 @@ QList<CommandLineOption> FreshCommand::optionsSignature() const
         {drop_types,    sl("Drop all tables and types (Postgres only)")},
         {{QChar('f'),
           force},       sl("Force the operation to run when in production")},
-//        {"schema-path", sl("The path to a schema dump file")}, // Value
+        {schema_path,   sl("The path to a schema dump file"), path_up}, // Value
         {seed,          sl("Indicates if the seed task should be re-run")},
         {seeder,        sl("The class name of the root seeder"), seeder_up}, // Value
         {step_,         sl("Force the migrations to be run so they can be rolled back "
@@ -89,8 +91,8 @@ int FreshCommand::run()
 
         exitCode |= call(Migrate, {databaseCmd,
                                    longOption(force),
-                                   boolCmd(step_)});
-//                                   valueCmd("schema-path")});
+                                   boolCmd(step_),
+                                   valueCmd(schema_path)});
 
         // Invoke seeder
         if (needsSeeding())
@@ -1,26 +1,39 @@
 #include "tom/commands/migrations/migratecommand.hpp"
 
 #include <QCommandLineParser>
+#include <QElapsedTimer>
 
 #include <orm/constants.hpp>
 
+#include "tom/application.hpp"
+#include "tom/migrationrepository.hpp"
+#include "tom/migrationreport.hpp"
 #include "tom/migrator.hpp"
+#include "tom/schema/schemastate.hpp"
 
 /*! Alias for the QStringLiteral(). */
 #define sl(str) QStringLiteral(str)
 
 TINYORM_BEGIN_COMMON_NAMESPACE
 
+namespace fs = std::filesystem;
+
 using Orm::Constants::database_;
 
 using Tom::Constants::database_up;
 using Tom::Constants::force;
+using Tom::Constants::path_up;
 using Tom::Constants::pretend;
+using Tom::Constants::report_;
+using Tom::Constants::schema_path;
 using Tom::Constants::seed;
+using Tom::Constants::sql_path;
 using Tom::Constants::step_;
 using Tom::Constants::DbSeed;
 using Tom::Constants::MigrateInstall;
 
+using Tom::Schema::SchemaState;
+
 namespace Tom::Commands::Migrations
 {
 
@@ -43,8 +56,12 @@ QList<CommandLineOption> MigrateCommand::optionsSignature() const
         {{QChar('f'),
           force},       sl("Force the operation to run when in production")},
         {pretend,       sl("Dump the SQL queries that would be run")},
-//        {"schema-path", sl("The path to a schema dump file")}, // Value
+        {report_,       sl("Write the migration report in the JSON format to the given "
+                           "file"), path_up}, // Value
+        {schema_path,   sl("The path to a schema dump file"), path_up}, // Value
         {seed,          sl("Indicates if the seed task should be re-run")},
+        {sql_path,      sl("Write the executed (or pretended) SQL queries to the given "
+                           "file"), path_up}, // Value
         {step_,         sl("Force the migrations to be run so they can be rolled back "
                            "individually")},
     };
@@ -58,31 +75,38 @@ int MigrateCommand::run()
     if (!confirmToProceed())
         return EXIT_FAILURE;
 
+    // Record executed migrations for the --report and --sql-path options
+    const auto report = MigrationReport::make(name(), isSet(pretend), value(report_),
+                                              value(sql_path));
+
     // Database connection to use (multiple connections supported)
-    return usingConnections(
-                values(database_), isDebugVerbosity(), m_migrator->repository(),
-                [this](const auto &database)
+    return m_migrator->withReport(report, [this]
     {
-        // Install db repository and load schema state
-        prepareDatabase(database);
-
-        /* Next, we will check to see if a path option has been defined. If it has
-               we will use the path relative to the root of this installation folder
-               so that migrations may be run for any path within the applications. */
-        m_migrator->run({isSet(pretend), isSet(step_)});
-
-        info(QStringLiteral("Database migaration completed successfully."));
-
-        int exitCode = EXIT_SUCCESS; // NOLINT(misc-const-correctness)
-
-        /* Finally, if the "seed" option has been given, we will re-run the database
-           seed task to re-populate the database, which is convenient when adding
-           a migration and a seed at the same time, as it is only this command. */
-        if (isSet(seed))
-            exitCode |= runSeeder(database);
-
-        // Return success only, if all executed commands were successful
-        return exitCode == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+        return usingConnections(
+                    values(database_), isDebugVerbosity(), m_migrator->repository(),
+                    [this](const auto &database)
+        {
+            // Install db repository and load schema state
+            prepareDatabase(database);
+
+            /* Next, we will check to see if a path option has been defined. If it has
+                   we will use the path relative to the root of this installation folder
+                   so that migrations may be run for any path within the applications. */
+            m_migrator->run({isSet(pretend), isSet(step_)});
+
+            info(QStringLiteral("Database migaration completed successfully."));
+
+            int exitCode = EXIT_SUCCESS; // NOLINT(misc-const-correctness)
+
+            /* Finally, if the "seed" option has been given, we will re-run the database
+               seed task to re-populate the database, which is convenient when adding
+               a migration and a seed at the same time, as it is only this command. */
+            if (isSet(seed))
+                exitCode |= runSeeder(database);
+
+            // Return success only, if all executed commands were successful
+            return exitCode == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+        });
     });
 }
 
@@ -101,14 +125,44 @@ void MigrateCommand::prepareDatabase(const QString &database) const
     if (!m_migrator->repositoryExists())
         call(MigrateInstall, {longOption(database_, database)});
 
-//    if (!m_migrator->hasRunAnyMigrations() && !isSet(pretend))
-//        loadSchemaState();
+    if (!m_migrator->hasRunAnyMigrations() && !isSet(pretend))
+        loadSchemaState(database);
 }
 
-//void MigrateCommand::loadSchemaState() const
-//{
-//    // CUR tom, finish load schema silverqx
-//}
+void MigrateCommand::loadSchemaState(const QString &database) const
+{
+    const auto schemaPath = isSet(schema_path)
+                            ? fs::path(value(schema_path).toStdString())
+                            : SchemaState::defaultPath(
+                                  application().getMigrationsPath(), database);
+
+    /* First, we will make sure that the schema file exists before we proceed any
+       further. If not, we will just return out of the method and the migrations
+       will be run from the scratch. */
+    if (!fs::exists(schemaPath))
+        return;
+
+    const auto schemaPathString = QString::fromStdString(schemaPath.string());
+
+    comment(QStringLiteral("Loading stored database schema: "), false)
+            .note(schemaPathString);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    /* Since the schema file will create the migrations table and reload it, we will
+       delete it here so that we don't collide with the table, the schema file also
+       contains all migrations that are a part of the schema dump. */
+    m_migrator->repository().deleteRepository();
+
+    SchemaState::make(connection(database), m_migrator->repository())
+            ->load(schemaPath);
+
+    const auto elapsedTime = timer.elapsed();
+
+    info(QStringLiteral("Loaded stored database schema:"), false);
+    note(QStringLiteral("  %1 (%2ms)").arg(schemaPathString).arg(elapsedTime));
+}
 
 int MigrateCommand::runSeeder(const QString &database) const
 {
@@ -4,6 +4,7 @@
 
 #include <orm/constants.hpp>
 
+#include "tom/migrationreport.hpp"
 #include "tom/migrator.hpp"
 
 /*! Alias for the QStringLiteral(). */
@@ -16,9 +17,12 @@ using Orm::Constants::database_;
 using Tom::Constants::class_;
 using Tom::Constants::database_up;
 using Tom::Constants::force;
+using Tom::Constants::path_up;
+using Tom::Constants::report_;
 using Tom::Constants::seed;
 using Tom::Constants::seeder;
 using Tom::Constants::seeder_up;
+using Tom::Constants::sql_path;
 using Tom::Constants::step_;
 using Tom::Constants::step_up;
 using Tom::Constants::step_migrate;
@@ -59,8 +63,12 @@ QList<CommandLineOption> RefreshCommand::optionsSignature() const
                           "allowed)</comment>"), database_up}, // Value
         {{QChar('f'),
           force},      sl("Force the operation to run when in production")},
+        {report_,      sl("Write the migration report in the JSON format to the given "
+                          "file"), path_up}, // Value
         {seed,         sl("Indicates if the seed task should be re-run")},
         {seeder,       sl("The class name of the root seeder"), seeder_up}, // Value
+        {sql_path,     sl("Write the executed SQL queries to the given file"),
+                       path_up}, // Value
         {step_,        sl("The number of migrations to be reverted & re-run"), step_up}, // Value
         {step_migrate, sl("Force the migrations to be run so they can be rolled back "
                           "individually")},
@@ -75,34 +83,41 @@ int RefreshCommand::run()
     if (!confirmToProceed())
         return EXIT_FAILURE;
 
+    // Record executed migrations for the --report and --sql-path options
+    const auto report = MigrationReport::make(name(), false, value(report_),
+                                              value(sql_path));
+
     // Database connection to use (multiple connections supported)
-    return usingConnections(values(database_), isDebugVerbosity(),
-                            [this](const QString &database)
+    return m_migrator->withReport(report, [this]
     {
-        // Database connection to use
-        auto databaseCmd = longOption(database_, database);
-        int exitCode = EXIT_SUCCESS; // NOLINT(misc-const-correctness)
-
-        /* If the "step" option is specified it means we only want to rollback a small
-           number of migrations before migrating again. For example, the user might
-           only rollback and remigrate the latest four migrations instead of all. */
-        if (const auto step = value(step_).toInt(); step > 0)
-            exitCode |= call(MigrateRollback, {databaseCmd,
-                                               longOption(force),
-                                               valueCmd(step_)});
-        else
-            exitCode |= call(MigrateReset, {databaseCmd, longOption(force)});
-
-        exitCode |= call(Migrate, {databaseCmd,
-                                   longOption(force),
-                                   boolCmd(step_migrate, step_)});
-
-        // Invoke seeder
-        if (needsSeeding())
-            exitCode |= runSeeder(std::move(databaseCmd));
-
-        // Return success only, if all executed commands were successful
-        return exitCode == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+        return usingConnections(values(database_), isDebugVerbosity(),
+                                [this](const QString &database)
+        {
+            // Database connection to use
+            auto databaseCmd = longOption(database_, database);
+            int exitCode = EXIT_SUCCESS; // NOLINT(misc-const-correctness)
+
+            /* If the "step" option is specified it means we only want to rollback a small
+               number of migrations before migrating again. For example, the user might
+               only rollback and remigrate the latest four migrations instead of all. */
+            if (const auto step = value(step_).toInt(); step > 0)
+                exitCode |= call(MigrateRollback, {databaseCmd,
+                                                   longOption(force),
+                                                   valueCmd(step_)});
+            else
+                exitCode |= call(MigrateReset, {databaseCmd, longOption(force)});
+
+            exitCode |= call(Migrate, {databaseCmd,
+                                       longOption(force),
+                                       boolCmd(step_migrate, step_)});
+
+            // Invoke seeder
+            if (needsSeeding())
+                exitCode |= runSeeder(std::move(databaseCmd));
+
+            // Return success only, if all executed commands were successful
+            return exitCode == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+        });
     });
 }
 
@@ -4,6 +4,7 @@
 
 #include <orm/constants.hpp>
 
+#include "tom/migrationreport.hpp"
 #include "tom/migrator.hpp"
 
 /*! Alias for the QStringLiteral(). */
@@ -15,7 +16,10 @@ using Orm::Constants::database_;
 
 using Tom::Constants::database_up;
 using Tom::Constants::force;
+using Tom::Constants::path_up;
 using Tom::Constants::pretend;
+using Tom::Constants::report_;
+using Tom::Constants::sql_path;
 
 namespace Tom::Commands::Migrations
 {
@@ -39,6 +43,10 @@ QList<CommandLineOption> ResetCommand::optionsSignature() const
         {{QChar('f'),
           force},     sl("Force the operation to run when in production")},
         {pretend,     sl("Dump the SQL queries that would be run")},
+        {report_,     sl("Write the migration report in the JSON format to the given "
+                         "file"), path_up}, // Value
+        {sql_path,    sl("Write the executed (or pretended) SQL queries to the given "
+                         "file"), path_up}, // Value
     };
 }
 
@@ -50,20 +58,27 @@ int ResetCommand::run()
     if (!confirmToProceed())
         return EXIT_FAILURE;
 
+    // Record executed migrations for the --report and --sql-path options
+    const auto report = MigrationReport::make(name(), isSet(pretend), value(report_),
+                                              value(sql_path));
+
     // Database connection to use (multiple connections supported)
-    return usingConnections(
-                values(database_), isDebugVerbosity(), m_migrator->repository(),
-                [this]
+    return m_migrator->withReport(report, [this]
     {
-        if (!m_migrator->repositoryExists()) {
-            comment(QStringLiteral("Migration table not found."));
+        return usingConnections(
+                    values(database_), isDebugVerbosity(), m_migrator->repository(),
+                    [this]
+        {
+            if (!m_migrator->repositoryExists()) {
+                comment(QStringLiteral("Migration table not found."));
 
-            return EXIT_FAILURE;
-        }
+                return EXIT_FAILURE;
+            }
 
-        m_migrator->reset(isSet(pretend));
+            m_migrator->reset(isSet(pretend));
 
-        return EXIT_SUCCESS;
+            return EXIT_SUCCESS;
+        });
     });
 }
 
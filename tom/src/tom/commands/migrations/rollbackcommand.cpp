@@ -4,6 +4,7 @@
 
 #include <orm/constants.hpp>
 
+#include "tom/migrationreport.hpp"
 #include "tom/migrator.hpp"
 
 /*! Alias for the QStringLiteral(). */
@@ -17,7 +18,10 @@ using Tom::Constants::batch_;
 using Tom::Constants::batch_up;
 using Tom::Constants::database_up;
 using Tom::Constants::force;
+using Tom::Constants::path_up;
 using Tom::Constants::pretend;
+using Tom::Constants::report_;
+using Tom::Constants::sql_path;
 using Tom::Constants::step_;
 using Tom::Constants::step_up;
 
@@ -43,6 +47,10 @@ QList<CommandLineOption> RollbackCommand::optionsSignature() const
         {{QChar('f'),
           force},     sl("Force the operation to run when in production")},
         {pretend,     sl("Dump the SQL queries that would be run")},
+        {report_,     sl("Write the migration report in the JSON format to the given "
+                         "file"), path_up}, // Value
+        {sql_path,    sl("Write the executed (or pretended) SQL queries to the given "
+                         "file"), path_up}, // Value
         {step_,       sl("The number of migrations to be reverted"), step_up}, // Value
         {batch_,      sl("The batch of migrations (identified by their batch number) "
                          "to be reverted"), batch_up}, // Value
@@ -57,17 +65,24 @@ int RollbackCommand::run()
     if (!confirmToProceed())
         return EXIT_FAILURE;
 
+    // Record executed migrations for the --report and --sql-path options
+    const auto report = MigrationReport::make(name(), isSet(pretend), value(report_),
+                                              value(sql_path));
+
     // Database connection to use (multiple connections supported)
-    return usingConnections(
-                values(database_), isDebugVerbosity(), m_migrator->repository(),
-                [this]
+    return m_migrator->withReport(report, [this]
     {
-        // Validation not needed as the toInt() returns 0 if conversion fails, like it
-        m_migrator->rollback({.pretend   = isSet(pretend),
-                              .stepValue = value(step_).toInt(),
-                              .batch     = value(batch_).toInt()});
-
-        return EXIT_SUCCESS;
+        return usingConnections(
+                    values(database_), isDebugVerbosity(), m_migrator->repository(),
+                    [this]
+        {
+            // Validation not needed as the toInt() returns 0 if conversion fails, like it
+            m_migrator->rollback({.pretend   = isSet(pretend),
+                                  .stepValue = value(step_).toInt(),
+                                  .batch     = value(batch_).toInt()});
+
+            return EXIT_SUCCESS;
+        });
     });
 }
 
@@ -0,0 +1,149 @@
+#include "tom/commands/schema/dumpcommand.hpp"
+
+#include <QCommandLineParser>
+
+#include <orm/constants.hpp>
+
+#include "tom/application.hpp"
+#include "tom/exceptions/invalidargumenterror.hpp"
+#include "tom/migrationrepository.hpp"
+#include "tom/migrator.hpp"
+#include "tom/schema/schemastate.hpp"
+
+/*! Alias for the QStringLiteral(). */
+#define sl(str) QStringLiteral(str)
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+namespace fs = std::filesystem;
+
+using fspath = std::filesystem::path;
+
+using Orm::Constants::database_;
+
+using Tom::Constants::database_up;
+using Tom::Constants::path_;
+using Tom::Constants::path_up;
+using Tom::Constants::prune;
+
+using Tom::Schema::SchemaState;
+
+namespace Tom::Commands::Schema
+{
+
+/* public */
+
+DumpCommand::DumpCommand(
+        Application &application, QCommandLineParser &parser,
+        std::shared_ptr<Migrator> migrator
+)
+    : Command(application, parser)
+    , Concerns::UsingConnection(connectionResolver())
+    , m_migrator(std::move(migrator))
+{}
+
+QList<CommandLineOption> DumpCommand::optionsSignature() const
+{
+    return {
+        {database_, sl("The database connection to use <comment>(multiple values "
+                       "allowed)</comment>"), database_up}, // Value
+        {path_,     sl("The path where the schema dump file should be stored"),
+                    path_up}, // Value
+        {prune,     sl("Show all existing migration files that are a part of "
+                       "the schema dump and can be pruned")},
+    };
+}
+
+int DumpCommand::run()
+{
+    Command::run();
+
+    auto databases = values(database_);
+
+    // All dumps would be written to the same file
+    if (isSet(path_) && databases.size() > 1)
+        throw Exceptions::InvalidArgumentError(
+                "The --path option can't be used with more database connections.");
+
+    // Database connection to use (multiple connections supported)
+    return usingConnections(
+                std::move(databases), isDebugVerbosity(), m_migrator->repository(),
+                [this](const QString &database)
+    {
+        const auto path = schemaPath(database);
+
+        // Create the schema folder if it doesn't exist
+        if (const auto parentPath = path.parent_path(); !parentPath.empty())
+            fs::create_directories(parentPath);
+
+        SchemaState::make(connection(database), m_migrator->repository())
+                ->dump(path);
+
+        info(QStringLiteral("Database schema dumped successfully."));
+        comment(QStringLiteral("Schema file: "), false)
+                .note(QString::fromStdString(path.string()));
+
+        if (isSet(prune))
+            pruneMigrations();
+
+        return EXIT_SUCCESS;
+    });
+}
+
+/* protected */
+
+fspath DumpCommand::schemaPath(const QString &database) const
+{
+    if (const auto path = value(path_); !path.isEmpty())
+        return path.toStdString();
+
+    return SchemaState::defaultPath(application().getMigrationsPath(), database);
+}
+
+void DumpCommand::pruneMigrations() const
+{
+    const auto &migrationsPath = application().getMigrationsPath();
+
+    // Nothing to prune
+    if (!fs::is_directory(migrationsPath)) {
+        comment(QStringLiteral("Migrations folder doesn't exist, nothing to prune."));
+
+        return;
+    }
+
+    // Prune only migrations that are a part of the dumped schema
+    const auto ran = m_migrator->repository().getRanSimple();
+
+    std::vector<fspath> migrationFiles;
+
+    for (const auto &entry : fs::directory_iterator(migrationsPath))
+        if (entry.is_regular_file() &&
+            ran.contains(QString::fromStdString(entry.path().stem().string()))
+        )
+            migrationFiles.push_back(entry.path());
+
+    if (migrationFiles.empty()) {
+        comment(QStringLiteral("No migration files are a part of the schema dump."));
+
+        return;
+    }
+
+    std::ranges::sort(migrationFiles);
+
+    /* The migrations are compiled into the tom application, deleting their files
+       would break the build, so only show which migrations can be removed. */
+    comment(QStringLiteral("Migrations that are a part of the schema dump and can be "
+                           "pruned:"));
+
+    for (const auto &migrationFile : migrationFiles)
+        note(QStringLiteral("  %1")
+             .arg(QString::fromStdString(migrationFile.filename().string())));
+
+    comment(QStringLiteral(
+                "Remove them from the TomApplication::migrations<>() list, delete "
+                "their #include-s and files, and rebuild the tom application."));
+}
+
+} // namespace Tom::Commands::Schema
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,157 @@
+#include "tom/migrationreport.hpp"
+
+#include <QJsonArray>
+#include <QJsonObject>
+
+#include <fstream>
+
+#include <orm/utils/query.hpp>
+
+#include "tom/concerns/interactswithio.hpp"
+#include "tom/exceptions/runtimeerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Types::Log;
+
+using QueryUtils = Orm::Utils::Query;
+
+namespace Tom
+{
+
+/* public */
+
+MigrationReport::MigrationReport(QString command, const bool pretend,
+                                 QString reportPath, QString sqlPath)
+    : m_command(std::move(command))
+    , m_pretend(pretend)
+    , m_reportPath(std::move(reportPath))
+    , m_sqlPath(std::move(sqlPath))
+    , m_startedAt(QDateTime::currentDateTimeUtc())
+{}
+
+std::shared_ptr<MigrationReport>
+MigrationReport::make(const QString &command, const bool pretend,
+                      const QString &reportPath, const QString &sqlPath)
+{
+    // Nothing to record
+    if (reportPath.isEmpty() && sqlPath.isEmpty())
+        return nullptr;
+
+    return std::make_shared<MigrationReport>(command, pretend, reportPath, sqlPath);
+}
+
+void MigrationReport::addMigration(Item &&item)
+{
+    m_migrations.push_back(std::move(item));
+}
+
+void MigrationReport::markFailed(QString error)
+{
+    m_failed = true;
+    m_error = std::move(error);
+}
+
+QJsonDocument MigrationReport::toJson() const
+{
+    QJsonArray migrations;
+    qint64 elapsedTotal = 0;
+
+    for (const auto &[migration, method, connection, elapsed, queries] : m_migrations) {
+        QJsonArray queriesJson;
+
+        for (const auto &query : queries)
+            queriesJson << QJsonObject {
+                {QStringLiteral("query"),
+                 QueryUtils::parseExecutedQueryForPretend(query.query,
+                                                          query.boundValues)},
+                {QStringLiteral("transaction"), query.type == Log::Type::TRANSACTION},
+                {QStringLiteral("elapsed"),     query.elapsed},
+                {QStringLiteral("affected"),    query.affected},
+            };
+
+        migrations << QJsonObject {
+            {QStringLiteral("migration"),  migration},
+            {QStringLiteral("method"),     method},
+            {QStringLiteral("connection"), connection},
+            {QStringLiteral("elapsed"),    elapsed},
+            {QStringLiteral("queries"),    queriesJson},
+        };
+
+        if (elapsed > 0)
+            elapsedTotal += elapsed;
+    }
+
+    QJsonObject report {
+        {QStringLiteral("command"),    m_command},
+        {QStringLiteral("pretend"),    m_pretend},
+        {QStringLiteral("started_at"), m_startedAt.toString(Qt::ISODateWithMs)},
+        {QStringLiteral("elapsed"),    elapsedTotal},
+        {QStringLiteral("failed"),     m_failed},
+        {QStringLiteral("migrations"), migrations},
+    };
+
+    if (m_failed)
+        report.insert(QStringLiteral("error"), m_error);
+
+    return QJsonDocument(report);
+}
+
+QString MigrationReport::toSql() const
+{
+    QString sql;
+
+    // The failed migration isn't a part of the script, its transaction was rolled back
+    if (m_failed)
+        sql += QStringLiteral("-- Partial script, the %1 command failed: %2\n\n")
+               .arg(m_command, m_error);
+
+    for (const auto &[migration, method, connection, _, queries] : m_migrations) {
+        sql += QStringLiteral("-- %1 (%2, connection: %3)\n")
+               .arg(migration, method, connection);
+
+        for (const auto &query : queries)
+            sql += QStringLiteral("%1;\n").arg(
+                       QueryUtils::parseExecutedQueryForPretend(query.query,
+                                                                query.boundValues));
+
+        sql += QChar('\n');
+    }
+
+    return sql;
+}
+
+void MigrationReport::write(const InteractsWithIO &io) const
+{
+    if (!m_reportPath.isEmpty()) {
+        writeFile(m_reportPath, toJson().toJson(QJsonDocument::Indented));
+
+        io.comment(QStringLiteral("Migration report written to: "), false)
+                .note(m_reportPath);
+    }
+
+    if (!m_sqlPath.isEmpty()) {
+        writeFile(m_sqlPath, toSql().toUtf8());
+
+        io.comment(QStringLiteral("SQL script written to: "), false)
+                .note(m_sqlPath);
+    }
+}
+
+/* protected */
+
+void MigrationReport::writeFile(const QString &path, const QByteArray &content)
+{
+    std::ofstream stream(path.toStdString(),
+                         std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!stream.is_open())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("Failed to open the '%1' file for writing.").arg(path));
+
+    stream.write(content.constData(), content.size());
+}
+
+} // namespace Tom
+
+TINYORM_END_COMMON_NAMESPACE
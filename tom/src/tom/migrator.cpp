@@ -3,6 +3,7 @@
 #include <typeinfo>
 
 #include <orm/databaseconnection.hpp>
+#include <orm/exceptions/nontransactionalcommanderror.hpp>
 #include <orm/utils/query.hpp>
 #include <orm/utils/type.hpp>
 
@@ -14,6 +15,7 @@
 #include "tom/exceptions/invalidtemplateargumenterror.hpp"
 #include "tom/exceptions/runtimeerror.hpp"
 #include "tom/migration.hpp"
+#include "tom/migrationreport.hpp"
 #include "tom/migrationrepository.hpp"
 #include "tom/tomutils.hpp"
 
@@ -21,6 +23,8 @@ TINYORM_BEGIN_COMMON_NAMESPACE
 
 using Orm::DatabaseConnection;
 
+using Orm::Exceptions::NonTransactionalCommandError;
+
 using Orm::Constants::DESC;
 using Orm::Constants::UNDERSCORE;
 
@@ -105,6 +109,47 @@ std::vector<RollbackItem> Migrator::reset(const bool pretend) const
                               pretend);
 }
 
+/* Migration report */
+
+int Migrator::withReport(const std::shared_ptr<MigrationReport> &report,
+                         const std::function<int()> &callback) const
+{
+    /* Nothing to record, keep the current report, eg. the migrate:refresh command
+       records the report and calls the migrate:rollback and migrate commands. */
+    if (!report)
+        return std::invoke(callback);
+
+    auto previousReport = std::exchange(m_report, report);
+
+    try {
+        const auto exitCode = std::invoke(callback);
+
+        m_report = std::move(previousReport);
+
+        // Write the JSON report and the SQL script
+        report->write(*this);
+
+        return exitCode;
+
+    } catch (const std::exception &e) {
+
+        m_report = std::move(previousReport);
+
+        // Write the partial report, the migrations executed before the failure
+        writeFailedReport(*report, QString::fromUtf8(e.what()));
+        // Re-throw
+        throw;
+
+    } catch (...) {
+
+        m_report = std::move(previousReport);
+
+        writeFailedReport(*report, QStringLiteral("Unknown exception."));
+        // Re-throw
+        throw;
+    }
+}
+
 /* Proxies to MigrationRepository */
 
 bool Migrator::repositoryExists() const
@@ -112,10 +157,10 @@ bool Migrator::repositoryExists() const
     return m_repository->repositoryExists();
 }
 
-//bool Migrator::hasRunAnyMigrations() const
-//{
-//    return repositoryExists() && !m_repository->getRanSimple().isEmpty();
-//}
+bool Migrator::hasRunAnyMigrations() const
+{
+    return repositoryExists() && !m_repository->getRanSimple().isEmpty();
+}
 
 /* protected */
 
@@ -223,7 +268,7 @@ void Migrator::runUp(const Migration &migration, const int batch,
     QElapsedTimer timer;
     timer.start();
 
-    runMigration(migration, MigrateMethod::Up);
+    auto queries = runMigration(migration, MigrateMethod::Up);
 
     const auto elapsedTime = timer.elapsed();
 
@@ -232,6 +277,9 @@ void Migrator::runUp(const Migration &migration, const int batch,
        in the application. A migration repository keeps the migrate order. */
     m_repository->log(migrationName, batch);
 
+    recordMigration(migration, migrationName, MigrateMethod::Up, elapsedTime,
+                    std::move(queries));
+
     info(QStringLiteral("Migrated:"), false);
     note(QStringLiteral("  %1 (%2ms)").arg(migrationName).arg(elapsedTime));
 }
@@ -318,7 +366,7 @@ void Migrator::runDown(const RollbackItem &migrationToRollback, const bool prete
     QElapsedTimer timer;
     timer.start();
 
-    runMigration(*migration, MigrateMethod::Down);
+    auto queries = runMigration(*migration, MigrateMethod::Down);
 
     const auto elapsedTime = timer.elapsed();
 
@@ -327,6 +375,9 @@ void Migrator::runDown(const RollbackItem &migrationToRollback, const bool prete
        by the application then will be able to fire by any later operation. */
     m_repository->deleteMigration(id);
 
+    recordMigration(*migration, migrationName, MigrateMethod::Down, elapsedTime,
+                    std::move(queries));
+
     info(QStringLiteral("Rolled back:"), false);
     note(QStringLiteral("  %1 (%2ms)").arg(migrationName).arg(elapsedTime));
 }
@@ -335,12 +386,17 @@ void Migrator::runDown(const RollbackItem &migrationToRollback, const bool prete
 
 void Migrator::pretendToRun(const Migration &migration, const MigrateMethod method) const
 {
-    for (auto &&query : getQueries(migration, method)) {
+    auto queries = getQueries(migration, method);
+
+    for (const auto &query : queries) {
         info(QStringLiteral("%1: ").arg(cachedMigrationName(migration)), false);
 
         note(QueryUtils::parseExecutedQueryForPretend(query.query,
                                                       query.boundValues));
     }
+
+    recordMigration(migration, cachedMigrationName(migration), method, -1,
+                    std::move(queries));
 }
 
 QVector<Migrator::Log>
@@ -362,7 +418,8 @@ Migrator::getQueries(const Migration &migration, const MigrateMethod method) con
 
 /* Migrate up/down common */
 
-void Migrator::runMigration(const Migration &migration, const MigrateMethod method) const
+QVector<Migrator::Log>
+Migrator::runMigration(const Migration &migration, const MigrateMethod method) const
 {
     const auto &migrationTypeId = typeid (migration);
 
@@ -377,6 +434,65 @@ void Migrator::runMigration(const Migration &migration, const MigrateMethod meth
             connection.getSchemaGrammar().supportsSchemaTransactions() &&
             migartionProperties.withinTransaction;
 
+    // Collect executed queries for the migration report
+    if (m_report)
+        return runMigrationWithQueryLog(migration, method, connection,
+                                        withinTransaction);
+
+    runMigrationInternal(migration, method, connection, withinTransaction);
+
+    return {};
+}
+
+QVector<Migrator::Log>
+Migrator::runMigrationWithQueryLog(
+        const Migration &migration, const MigrateMethod method,
+        DatabaseConnection &connection, const bool withinTransaction)
+{
+    /* Enable the query log and the elapsed counter only for this migration and take
+       the queries executed by this migration, the previous state is restored. */
+    const auto wasLogging = connection.logging();
+    const auto wasCountingElapsed = connection.countingElapsed();
+
+    connection.enableQueryLog();
+    if (!wasCountingElapsed)
+        connection.enableElapsedCounter();
+
+    const auto queryLog = connection.getQueryLog();
+    const auto logSize = queryLog->size();
+
+    const auto restoreConnection = [&connection, &queryLog, logSize, wasLogging,
+                                    wasCountingElapsed]
+    {
+        if (!wasLogging) {
+            queryLog->resize(logSize);
+            connection.disableQueryLog();
+        }
+        if (!wasCountingElapsed)
+            connection.disableElapsedCounter();
+    };
+
+    try {
+        runMigrationInternal(migration, method, connection, withinTransaction);
+
+    } catch (...) {
+
+        restoreConnection();
+        // Re-throw
+        throw;
+    }
+
+    auto queries = queryLog->mid(logSize);
+
+    restoreConnection();
+
+    return queries;
+}
+
+void Migrator::runMigrationInternal(
+        const Migration &migration, const MigrateMethod method,
+        DatabaseConnection &connection, const bool withinTransaction)
+{
     // Without transaction
     if (!withinTransaction)
         return migrateByMethod(migration, method); // clazy:exclude=returning-void-expression
@@ -387,6 +503,16 @@ void Migrator::runMigration(const Migration &migration, const MigrateMethod meth
     try {
         migrateByMethod(migration, method);
 
+    } catch (const NonTransactionalCommandError &) {
+
+        /* The migration contains a command that can't be executed inside a transaction
+           block (eg. PostgreSQL create index concurrently), this exception is thrown
+           before the command is executed, so roll back everything and run the whole
+           migration again outside of the transaction. */
+        connection.rollBack();
+
+        return migrateByMethod(migration, method); // clazy:exclude=returning-void-expression
+
     }  catch (...) {
 
         connection.rollBack();
@@ -397,6 +523,45 @@ void Migrator::runMigration(const Migration &migration, const MigrateMethod meth
     connection.commit();
 }
 
+void Migrator::writeFailedReport(MigrationReport &report, QString error) const
+{
+    report.markFailed(std::move(error));
+
+    // Don't replace the original exception with the write error
+    try {
+        report.write(*this);
+
+    } catch (const std::exception &e) {
+        this->error(QStringLiteral("Failed to write the partial migration report: %1")
+                    .arg(QString::fromUtf8(e.what())));
+    }
+}
+
+void Migrator::recordMigration(
+        const Migration &migration, QString migrationName, const MigrateMethod method,
+        const qint64 elapsed, QVector<Log> &&queries) const
+{
+    // Not recording
+    if (!m_report)
+        return;
+
+    m_report->addMigration({std::move(migrationName),
+                            method == MigrateMethod::Up ? QStringLiteral("up")
+                                                        : QStringLiteral("down"),
+                            migrationConnectionName(migration), elapsed,
+                            std::move(queries)});
+}
+
+QString Migrator::migrationConnectionName(const Migration &migration) const
+{
+    const auto &migrationTypeId = typeid (migration);
+
+    Q_ASSERT(m_migrationsProperties.get().contains(migrationTypeId));
+
+    return resolveConnection(m_migrationsProperties.get().at(migrationTypeId).connection)
+            .getName();
+}
+
 void Migrator::migrateByMethod(const Migration &migration, const MigrateMethod method)
 {
     switch (method) {
@@ -0,0 +1,111 @@
+#include "tom/schema/mysqlschemastate.hpp"
+
+#include <QRegularExpression>
+
+#include <orm/constants.hpp>
+
+#include "tom/exceptions/runtimeerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::database_;
+using Orm::Constants::host_;
+using Orm::Constants::password_;
+using Orm::Constants::port_;
+using Orm::Constants::username_;
+
+namespace Tom::Schema
+{
+
+/* public */
+
+void MySqlSchemaState::dump(const fspath &path) const
+{
+    try {
+        runDump(path, true);
+
+    } catch (const Exceptions::RuntimeError &e) {
+
+        /* The MariaDB's mysqldump and mysqldump older than 8.0 don't know
+           the --column-statistics option, so try it again without it. */
+        if (!e.message().contains(QStringLiteral("column-statistics")))
+            throw;
+
+        runDump(path, false);
+    }
+
+    removeAutoIncrementingState(path);
+
+    appendMigrationData(path);
+}
+
+void MySqlSchemaState::load(const fspath &path) const
+{
+    auto arguments = baseArguments();
+    arguments << QStringLiteral("--database=%1").arg(configValue(database_));
+
+    runProcess(QStringLiteral("mysql"), arguments, path);
+}
+
+/* protected */
+
+QStringList MySqlSchemaState::baseArguments() const
+{
+    QStringList arguments;
+    arguments.reserve(8);
+
+    if (const auto host = configValue(host_); !host.isEmpty())
+        arguments << QStringLiteral("--host=%1").arg(host);
+
+    if (const auto port = configValue(port_); !port.isEmpty())
+        arguments << QStringLiteral("--port=%1").arg(port);
+
+    if (const auto username = configValue(username_); !username.isEmpty())
+        arguments << QStringLiteral("--user=%1").arg(username);
+
+    return arguments;
+}
+
+void MySqlSchemaState::runDump(const fspath &path, const bool columnStatistics) const
+{
+    auto arguments = baseArguments();
+
+    arguments << QStringLiteral("--no-tablespaces")
+              << QStringLiteral("--skip-add-locks")
+              << QStringLiteral("--skip-comments")
+              << QStringLiteral("--skip-set-charset")
+              << QStringLiteral("--tz-utc")
+              << QStringLiteral("--routines")
+              << QStringLiteral("--no-data");
+
+    if (columnStatistics)
+        arguments << QStringLiteral("--column-statistics=0");
+
+    arguments << QStringLiteral("--result-file=%1")
+                 .arg(QString::fromStdString(path.string()))
+              << configValue(database_);
+
+    runProcess(QStringLiteral("mysqldump"), arguments);
+}
+
+void MySqlSchemaState::removeAutoIncrementingState(const fspath &path)
+{
+    static const QRegularExpression autoIncrement(
+                QStringLiteral(R"(\s+AUTO_INCREMENT=\d+)"));
+
+    writeSchemaFile(path, readSchemaFile(path).remove(autoIncrement));
+}
+
+QProcessEnvironment MySqlSchemaState::processEnvironment() const
+{
+    auto environment = SchemaState::processEnvironment();
+
+    // Don't pass the password on the command-line, it would be visible in the ps
+    environment.insert(QStringLiteral("MYSQL_PWD"), configValue(password_));
+
+    return environment;
+}
+
+} // namespace Tom::Schema
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,95 @@
+#include "tom/schema/postgresschemastate.hpp"
+
+#include <orm/constants.hpp>
+#include <orm/databaseconnection.hpp>
+
+#include "tom/migrationrepository.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::ID;
+using Orm::Constants::database_;
+using Orm::Constants::host_;
+using Orm::Constants::password_;
+using Orm::Constants::port_;
+using Orm::Constants::username_;
+
+namespace Tom::Schema
+{
+
+/* public */
+
+void PostgresSchemaState::dump(const fspath &path) const
+{
+    auto arguments = baseArguments();
+
+    arguments << QStringLiteral("--no-owner")
+              << QStringLiteral("--no-acl")
+              << QStringLiteral("--schema-only")
+              << QStringLiteral("--file=%1").arg(QString::fromStdString(path.string()));
+
+    runProcess(QStringLiteral("pg_dump"), arguments);
+
+    appendMigrationData(path);
+}
+
+void PostgresSchemaState::load(const fspath &path) const
+{
+    auto arguments = baseArguments();
+
+    arguments << QStringLiteral("--quiet")
+              << QStringLiteral("--no-psqlrc")
+              << QStringLiteral("--set=ON_ERROR_STOP=1")
+              << QStringLiteral("--file=%1").arg(QString::fromStdString(path.string()));
+
+    runProcess(QStringLiteral("psql"), arguments);
+}
+
+/* protected */
+
+QStringList PostgresSchemaState::baseArguments() const
+{
+    QStringList arguments;
+    arguments.reserve(8);
+
+    if (const auto host = configValue(host_); !host.isEmpty())
+        arguments << QStringLiteral("--host=%1").arg(host);
+
+    if (const auto port = configValue(port_); !port.isEmpty())
+        arguments << QStringLiteral("--port=%1").arg(port);
+
+    if (const auto username = configValue(username_); !username.isEmpty())
+        arguments << QStringLiteral("--username=%1").arg(username);
+
+    arguments << QStringLiteral("--dbname=%1").arg(configValue(database_));
+
+    return arguments;
+}
+
+QString PostgresSchemaState::migrationDataEpilogue() const
+{
+    /* Inserting the explicit ids doesn't move the sequence, it has to be synced,
+       otherwise logging the next migration fails on the duplicate primary key. */
+    const auto &connection = m_connection.get();
+    const auto &grammar = connection.getQueryGrammar();
+    const auto &table = m_repository.get().getTable();
+
+    return QStringLiteral("select setval(pg_get_serial_sequence('%1%2', '%3'), "
+                          "(select max(%4) from %5))")
+            .arg(connection.getTablePrefix(), table, ID, grammar.wrap(ID),
+                 grammar.wrapTable(table));
+}
+
+QProcessEnvironment PostgresSchemaState::processEnvironment() const
+{
+    auto environment = SchemaState::processEnvironment();
+
+    // Don't pass the password on the command-line, it would be visible in the ps
+    environment.insert(QStringLiteral("PGPASSWORD"), configValue(password_));
+
+    return environment;
+}
+
+} // namespace Tom::Schema
+
+TINYORM_END_COMMON_NAMESPACE
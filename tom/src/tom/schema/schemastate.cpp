@@ -0,0 +1,191 @@
+#include "tom/schema/schemastate.hpp"
+
+#include <QProcess>
+
+#include <fstream>
+
+#include <orm/databaseconnection.hpp>
+#include <orm/utils/query.hpp>
+
+#include "tom/exceptions/runtimeerror.hpp"
+#include "tom/migrationrepository.hpp"
+#include "tom/schema/mysqlschemastate.hpp"
+#include "tom/schema/postgresschemastate.hpp"
+#include "tom/schema/sqliteschemastate.hpp"
+#include "tom/tomconstants.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using fspath = std::filesystem::path;
+
+using Orm::Constants::ASC;
+using Orm::Constants::ID;
+using Orm::Constants::NEWLINE;
+using Orm::Constants::QMYSQL;
+using Orm::Constants::QPSQL;
+using Orm::Constants::QSQLITE;
+
+using Tom::Constants::batch_;
+using Tom::Constants::migration_;
+
+using QueryUtils = Orm::Utils::Query;
+
+namespace Tom::Schema
+{
+
+/* public */
+
+SchemaState::SchemaState(DatabaseConnection &connection,
+                         MigrationRepository &repository)
+    : m_connection(connection)
+    , m_repository(repository)
+{}
+
+std::unique_ptr<SchemaState>
+SchemaState::make(DatabaseConnection &connection, MigrationRepository &repository)
+{
+    const auto driverName = connection.driverName();
+
+    if (driverName == QMYSQL)
+        return std::make_unique<MySqlSchemaState>(connection, repository);
+
+    if (driverName == QPSQL)
+        return std::make_unique<PostgresSchemaState>(connection, repository);
+
+    if (driverName == QSQLITE)
+        return std::make_unique<SQLiteSchemaState>(connection, repository);
+
+    throw Exceptions::RuntimeError(
+                QStringLiteral("The schema dump and load is not supported for the '%1' "
+                               "database driver.")
+                .arg(driverName));
+}
+
+fspath SchemaState::defaultPath(const fspath &migrationsPath, const QString &connection)
+{
+    // Eg. database/migrations -> database/schema/mysql-schema.sql
+    return (migrationsPath.parent_path() / "schema" /
+            QStringLiteral("%1-schema.sql").arg(connection).toStdString())
+            .make_preferred();
+}
+
+/* protected */
+
+void SchemaState::appendMigrationData(const fspath &path) const
+{
+    const auto migrations = m_repository.get().getRan(ASC);
+
+    // Nothing to append
+    if (migrations.empty())
+        return;
+
+    QVector<QVariantMap> values;
+    values.reserve(static_cast<decltype (values)::size_type>(migrations.size()));
+
+    for (const auto &[id, migration, batch] : migrations)
+        values.append(QVariantMap {{ID,         id},
+                                   {migration_, migration},
+                                   {batch_,     batch}});
+
+    /* Compile the insert statement using the connection's query grammar, it's always
+       correctly quoted for the given database driver. Migration names are validated
+       by the Migrator so they can be safely inlined. */
+    const auto queries = m_connection.get().pretend([this, &values]
+    {
+        m_connection.get().table(m_repository.get().getTable())->insert(values);
+    });
+
+    QString content;
+
+    for (const auto &query : queries)
+        content += QStringLiteral("%1;%2")
+                   .arg(QueryUtils::parseExecutedQueryForPretend(query.query,
+                                                                 query.boundValues),
+                        NEWLINE);
+
+    if (auto epilogue = migrationDataEpilogue(); !epilogue.isEmpty())
+        content += QStringLiteral("%1;%2").arg(epilogue, NEWLINE);
+
+    writeSchemaFile(path, QStringLiteral("%1%2").arg(NEWLINE, content), true);
+}
+
+QString SchemaState::migrationDataEpilogue() const
+{
+    return {};
+}
+
+void SchemaState::runProcess(
+        const QString &program, const QStringList &arguments,
+        const fspath &inputFile, const fspath &outputFile) const
+{
+    QProcess process;
+    process.setProcessEnvironment(processEnvironment());
+
+    if (!inputFile.empty())
+        process.setStandardInputFile(QString::fromStdString(inputFile.string()));
+
+    if (!outputFile.empty())
+        process.setStandardOutputFile(QString::fromStdString(outputFile.string()));
+
+    process.start(program, arguments);
+
+    if (!process.waitForStarted())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("Failed to start the '%1' program, verify that it's "
+                               "installed and available on the system PATH.")
+                .arg(program));
+
+    process.waitForFinished(-1);
+
+    if (process.exitStatus() == QProcess::NormalExit && process.exitCode() == 0)
+        return;
+
+    throw Exceptions::RuntimeError(
+                QStringLiteral("The '%1' program failed with exit code %2: %3")
+                .arg(program)
+                .arg(process.exitCode())
+                .arg(QString::fromUtf8(process.readAllStandardError()).trimmed()));
+}
+
+QProcessEnvironment SchemaState::processEnvironment() const
+{
+    return QProcessEnvironment::systemEnvironment();
+}
+
+QString SchemaState::configValue(const QString &option) const
+{
+    return m_connection.get().getConfig(option).value<QString>();
+}
+
+QString SchemaState::readSchemaFile(const fspath &path)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+    if (!stream.is_open())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("Failed to open the '%1' schema file for reading.")
+                .arg(QString::fromStdString(path.string())));
+
+    const std::string content {std::istreambuf_iterator<char>(stream),
+                              std::istreambuf_iterator<char>()};
+
+    return QString::fromStdString(content);
+}
+
+void SchemaState::writeSchemaFile(const fspath &path, const QString &content,
+                                  const bool append)
+{
+    std::ofstream stream(path, std::ios::out | std::ios::binary |
+                               (append ? std::ios::app : std::ios::trunc));
+
+    if (!stream.is_open())
+        throw Exceptions::RuntimeError(
+                QStringLiteral("Failed to open the '%1' schema file for writing.")
+                .arg(QString::fromStdString(path.string())));
+
+    stream << content.toStdString();
+}
+
+} // namespace Tom::Schema
+
+TINYORM_END_COMMON_NAMESPACE
@@ -0,0 +1,60 @@
+#include "tom/schema/sqliteschemastate.hpp"
+
+#include <QRegularExpression>
+
+#include <orm/constants.hpp>
+
+#include "tom/exceptions/runtimeerror.hpp"
+
+TINYORM_BEGIN_COMMON_NAMESPACE
+
+using Orm::Constants::database_;
+
+namespace Tom::Schema
+{
+
+/* public */
+
+void SQLiteSchemaState::dump(const fspath &path) const
+{
+    runProcess(QStringLiteral("sqlite3"), {databasePath(), QStringLiteral(".schema")},
+               {}, path);
+
+    removeSequenceTable(path);
+
+    appendMigrationData(path);
+}
+
+void SQLiteSchemaState::load(const fspath &path) const
+{
+    runProcess(QStringLiteral("sqlite3"), {databasePath()}, path);
+}
+
+/* protected */
+
+QString SQLiteSchemaState::databasePath() const
+{
+    auto database = configValue(database_);
+
+    if (database != QStringLiteral(":memory:"))
+        return database;
+
+    throw Exceptions::RuntimeError(
+                "The schema dump and load is not supported for the in-memory "
+                "SQLite database.");
+}
+
+void SQLiteSchemaState::removeSequenceTable(const fspath &path)
+{
+    /* The sqlite_sequence table is created by the SQLite internally for tables with
+       the AUTOINCREMENT column and it can't be created manually. */
+    static const QRegularExpression sequenceTable(
+                QStringLiteral(R"(^CREATE TABLE sqlite_sequence\(.*\);\r?\n?)"),
+                QRegularExpression::MultilineOption);
+
+    writeSchemaFile(path, readSchemaFile(path).remove(sequenceTable));
+}
+
+} // namespace Tom::Schema
+
+TINYORM_END_COMMON_NAMESPACE
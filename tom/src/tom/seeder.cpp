@@ -2,6 +2,8 @@
 
 #include <QElapsedTimer>
 
+#include <future>
+
 #include <orm/utils/type.hpp>
 
 #include "tom/concerns/interactswithio.hpp"
@@ -24,6 +26,13 @@ Seeder &Seeder::setIO(const InteractsWithIO &io)
 
 /* private */
 
+Seeder &Seeder::setIO(OptionalIO io) noexcept
+{
+    m_io = io;
+
+    return *this;
+}
+
 void Seeder::callInternal(const bool silent, std::function<void()> &&callback) const
 {
     QElapsedTimer timer;
@@ -52,6 +61,65 @@ void Seeder::callInternal(const bool silent, std::function<void()> &&callback) c
                                                   .arg(elapsedTime));
 }
 
+void Seeder::callParallelInternal(const bool silent,
+                                  std::vector<ParallelSeeder> &&seeders) const
+{
+    const auto shouldLog = !silent && m_io;
+
+    if (shouldLog)
+        for (const auto &seeder : seeders)
+            m_io->get().comment(QStringLiteral("Seeding: "), false)
+                       .note(QStringLiteral("%1 (parallel)").arg(seeder.first));
+
+    std::vector<std::future<qint64>> futures;
+    futures.reserve(seeders.size());
+
+    for (auto &seeder : seeders)
+        futures.push_back(std::async(std::launch::async,
+                                     [callback = std::move(seeder.second)]
+        {
+            QElapsedTimer timer;
+            timer.start();
+
+            try {
+                std::invoke(callback);
+
+            } catch (...) {
+                Orm::DB::removeThreadConnections();
+
+                throw;
+            }
+
+            /* Database connections are thread-local, remove them with their QSqlDatabase
+               connections, otherwise every worker thread leaks them. */
+            Orm::DB::removeThreadConnections();
+
+            return timer.elapsed();
+        }));
+
+    /* Wait for all seeders to finish, the first exception is re-thrown after all
+       seeders finished. */
+    std::exception_ptr exception;
+
+    for (std::size_t index = 0; index < futures.size(); ++index)
+        try {
+            const auto elapsedTime = futures[index].get();
+
+            if (!shouldLog)
+                continue;
+
+            m_io->get().info(QStringLiteral("Seeded:"), false);
+            m_io->get().note(QStringLiteral("  %1 (%2ms)").arg(seeders[index].first)
+                                                          .arg(elapsedTime));
+        } catch (...) {
+            if (!exception)
+                exception = std::current_exception();
+        }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
 } // namespace Tom
 
 TINYORM_END_COMMON_NAMESPACE
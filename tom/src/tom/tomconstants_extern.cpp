@@ -139,12 +139,23 @@ namespace Tom::Constants
     const QString reset                = QStringLiteral("reset");
     // integrate
     const QString stdout_              = QStringLiteral("stdout");
+    // migrate, migrate:fresh
+    const QString schema_path          = QStringLiteral("schema-path");
+    // schema:dump
+    const QString prune                = QStringLiteral("prune");
+    // db:snapshot
+    const QString restore              = QStringLiteral("restore");
+    const QString drop_                = QStringLiteral("drop");
+    // migrate, migrate:rollback, migrate:reset, migrate:refresh
+    const QString report_              = QStringLiteral("report");
+    const QString sql_path             = QStringLiteral("sql-path");
 
     // Namespace names
     const QString NsGlobal     = QStringLiteral("global");
     const QString NsDb         = QStringLiteral("db");
     const QString NsMake       = QStringLiteral("make");
     const QString NsMigrate    = QStringLiteral("migrate");
+    const QString NsSchema     = QStringLiteral("schema");
     const QString NsNamespaced = QStringLiteral("namespaced");
     const QString NsAll        = QStringLiteral("all");
 
@@ -157,6 +168,7 @@ namespace Tom::Constants
     const QString About            = QStringLiteral("about");
     const QString Complete         = QStringLiteral("complete");
     const QString DbSeed           = QStringLiteral("db:seed");
+    const QString DbSnapshot       = QStringLiteral("db:snapshot");
     const QString DbWipe           = QStringLiteral("db:wipe");
     const QString Inspire          = QStringLiteral("inspire");
     const QString List             = QStringLiteral("list");
@@ -175,6 +187,7 @@ namespace Tom::Constants
     const QString MigrateStatus    = QStringLiteral("migrate:status");
     const QString MigrateUninstall = QStringLiteral("migrate:uninstall");
     const QString Integrate        = QStringLiteral("integrate");
+    const QString SchemaDump       = QStringLiteral("schema:dump");
 
 } // namespace Tom::Constants
 
@@ -102,12 +102,12 @@ _tom()
 
     # Inaccurate completion if the tom command is not on the system path, it doesn't
     # provide all options
-    commands='env help inspire integrate list migrate db:seed db:wipe
-        make:migration make:model make:seeder migrate:fresh migrate:install
+    commands='env help inspire integrate list migrate db:seed db:snapshot
+        db:wipe make:migration make:model make:seeder migrate:fresh migrate:install
         migrate:refresh migrate:reset migrate:rollback migrate:status
-        migrate:uninstall'
+        migrate:uninstall schema:dump'
 
-    namespaces='global db make migrate namespaced all'
+    namespaces='global db make migrate schema namespaced all'
 
     common_options='--ansi --no-ansi --env= --help --no-interaction --quiet
         --version --verbose'